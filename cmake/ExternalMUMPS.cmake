@@ -17,7 +17,7 @@ list(APPEND MUMPS_OPTIONS
   "-DMUMPS_parallel=ON"
   "-Dopenmp=${PALACE_WITH_OPENMP}"
   "-Dintsize64=OFF"
-  "-DBUILD_SINGLE=OFF"
+  "-DBUILD_SINGLE=ON"
   "-DBUILD_DOUBLE=ON"
   "-DBUILD_COMPLEX=OFF"
   "-DBUILD_COMPLEX16=OFF"
@@ -217,6 +217,7 @@ void BaseSolver::SolveEstimateMarkRefine(std::vector<std::unique_ptr<Mesh>> &mes
       mfem::ParMesh &fine_mesh = *mesh.back();
       const auto initial_elem_count = fine_mesh.GetGlobalNE();
       fine_mesh.GeneralRefinement(marked_elements, -1, refinement.max_nc_levels);
+      TransferSolution(false);
       const auto final_elem_count = fine_mesh.GetGlobalNE();
       Mpi::Print(" {} mesh refinement added {:d} elements (initial = {:d}, final = {:d})\n",
                  fine_mesh.Nonconforming() ? "Nonconforming" : "Conforming",
@@ -226,7 +227,9 @@ void BaseSolver::SolveEstimateMarkRefine(std::vector<std::unique_ptr<Mesh>> &mes
 
     // Optionally rebalance and write the adapted mesh to file.
     {
+      const mfem::ParMesh *prev_mesh = &mesh.back()->Get();
       const auto ratio_pre = mesh::RebalanceMesh(*mesh.back(), iodata);
+      TransferSolution(&mesh.back()->Get() != prev_mesh);
       if (ratio_pre > refinement.maximum_imbalance)
       {
         int min_elem, max_elem;
@@ -761,13 +764,28 @@ void BaseSolver::PostprocessFields(const PostOperator &post_op, int step, double
 void BaseSolver::PostprocessErrorIndicator(const PostOperator &post_op,
                                            const ErrorIndicator &indicator,
                                            bool fields) const
+{
+  if (post_dir.length() == 0)
+  {
+    return;
+  }
+  PostprocessErrorIndicator(post_op.GetComm(), indicator);
+  if (fields)
+  {
+    BlockTimer bt(Timer::IO);
+    post_op.WriteFieldsFinal(&indicator);
+    Mpi::Barrier(post_op.GetComm());
+  }
+}
+
+void BaseSolver::PostprocessErrorIndicator(MPI_Comm comm,
+                                           const ErrorIndicator &indicator) const
 {
   // Write the indicator statistics.
   if (post_dir.length() == 0)
   {
     return;
   }
-  MPI_Comm comm = post_op.GetComm();
   std::array<double, 4> data = {indicator.Norml2(comm), indicator.Min(comm),
                                 indicator.Max(comm), indicator.Mean(comm)};
   if (root)
@@ -787,12 +805,6 @@ void BaseSolver::PostprocessErrorIndicator(const PostOperator &post_op,
                  data[3], table.w, table.p);
     // clang-format on
   }
-  if (fields)
-  {
-    BlockTimer bt(Timer::IO);
-    post_op.WriteFieldsFinal(&indicator);
-    Mpi::Barrier(post_op.GetComm());
-  }
 }
 
 template void BaseSolver::SaveMetadata<KspSolver>(const KspSolver &) const;
@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <mpi.h>
 #include <fmt/os.h>
 
 namespace palace
@@ -68,15 +69,22 @@ protected:
   // Common field visualization postprocessing for all simulation types.
   void PostprocessFields(const PostOperator &post_op, int step, double time) const;
 
-  // Common error indicator postprocessing for all simulation types.
+  // Common error indicator postprocessing for all simulation types. The statistics can
+  // also be written without a PostOperator, in which case no fields are written.
   void PostprocessErrorIndicator(const PostOperator &post_op,
                                  const ErrorIndicator &indicator, bool fields) const;
+  void PostprocessErrorIndicator(MPI_Comm comm, const ErrorIndicator &indicator) const;
 
   // Performs a solve using the mesh sequence, then reports error indicators and the number
   // of global true dofs.
   virtual std::pair<ErrorIndicator, long long int>
   Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const = 0;
 
+  // Called after each refinement or rebalancing of the finest mesh during adaptive mesh
+  // refinement, for drivers which transfer solution data between iterations. When the mesh
+  // object has been replaced rather than modified, the data cannot be transferred.
+  virtual void TransferSolution(bool mesh_replaced) const {}
+
 public:
   BaseSolver(const IoData &iodata, bool root, int size = 0, int num_thread = 0,
              const char *git_tag = nullptr);
@@ -3,13 +3,22 @@
 
 #include "drivensolver.hpp"
 
+#include <algorithm>
 #include <complex>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <Eigen/Dense>
 #include <mfem.hpp>
+#include <nlohmann/json.hpp>
 #include "fem/errorindicator.hpp"
+#include "fem/interpolator.hpp"
 #include "fem/mesh.hpp"
 #include "linalg/errorestimator.hpp"
 #include "linalg/ksp.hpp"
 #include "linalg/operator.hpp"
+#include "linalg/solutionhistory.hpp"
 #include "linalg/vector.hpp"
 #include "models/lumpedportoperator.hpp"
 #include "models/postoperator.hpp"
@@ -18,6 +27,8 @@
 #include "models/surfacecurrentoperator.hpp"
 #include "models/waveportoperator.hpp"
 #include "utils/communication.hpp"
+#include "utils/filesystem.hpp"
+#include "utils/geodata.hpp"
 #include "utils/iodata.hpp"
 #include "utils/prettyprint.hpp"
 #include "utils/timer.hpp"
@@ -25,6 +36,7 @@
 namespace palace
 {
 
+using json = nlohmann::json;
 using namespace std::complex_literals;
 
 std::pair<ErrorIndicator, long long int>
@@ -32,35 +44,39 @@ DrivenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
 {
   // Set up the spatial discretization and frequency sweep.
   BlockTimer bt0(Timer::CONSTRUCT);
-  SpaceOperator space_op(iodata, mesh);
+  auto space_op = std::make_unique<SpaceOperator>(iodata, mesh);
   int n_step = GetNumSteps(iodata.solver.driven.min_f, iodata.solver.driven.max_f,
                            iodata.solver.driven.delta_f);
   int step0 = (iodata.solver.driven.rst > 0) ? iodata.solver.driven.rst - 1 : 0;
   double delta_omega = iodata.solver.driven.delta_f;
   double omega0 = iodata.solver.driven.min_f + step0 * delta_omega;
-  bool adaptive = (iodata.solver.driven.adaptive_tol > 0.0);
-  if (adaptive && n_step <= 2)
+  const bool load_model = !iodata.solver.driven.adaptive_load_model.empty();
+  bool adaptive = (iodata.solver.driven.adaptive_tol > 0.0 || load_model);
+  MFEM_VERIFY(!load_model || iodata.model.refinement.max_it == 0,
+              "Adaptive mesh refinement is not supported when loading a saved PROM model!");
+  MFEM_VERIFY(iodata.solver.driven.estimator_step > 0 ||
+                  iodata.model.refinement.max_it == 0,
+              "Adaptive mesh refinement requires error estimation for driven simulations "
+              "(config[\"Driven\"][\"EstimatorStep\"] > 0)!");
+  if (adaptive && !load_model && n_step <= 2)
   {
     Mpi::Warning("Adaptive frequency sweep requires > 2 total frequency samples!\n"
                  "Reverting to uniform sweep!\n");
     adaptive = false;
   }
-  SaveMetadata(space_op.GetNDSpaces());
+  SaveMetadata(space_op->GetNDSpaces());
 
-  // Frequencies will be sampled uniformly in the frequency domain. Index sets are for
-  // computing things like S-parameters in postprocessing.
-  PostOperator post_op(iodata, space_op, "driven");
   {
     Mpi::Print("\nComputing {}frequency response for:\n", adaptive ? "adaptive fast " : "");
     bool first = true;
-    for (const auto &[idx, data] : space_op.GetLumpedPortOp())
+    for (const auto &[idx, data] : space_op->GetLumpedPortOp())
     {
       if (data.excitation)
       {
         if (first)
         {
           Mpi::Print(" Lumped port excitation specified on port{}",
-                     (space_op.GetLumpedPortOp().Size() > 1) ? "s" : "");
+                     (space_op->GetLumpedPortOp().Size() > 1) ? "s" : "");
           first = false;
         }
         Mpi::Print(" {:d}", idx);
@@ -68,14 +84,14 @@ DrivenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
     }
     int excitations = first;
     first = true;
-    for (const auto &[idx, data] : space_op.GetWavePortOp())
+    for (const auto &[idx, data] : space_op->GetWavePortOp())
     {
       if (data.excitation)
       {
         if (first)
         {
           Mpi::Print(" Wave port excitation specified on port{}",
-                     (space_op.GetWavePortOp().Size() > 1) ? "s" : "");
+                     (space_op->GetWavePortOp().Size() > 1) ? "s" : "");
           first = false;
         }
         Mpi::Print(" {:d}", idx);
@@ -83,12 +99,12 @@ DrivenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
     }
     excitations += first;
     first = true;
-    for (const auto &[idx, data] : space_op.GetSurfaceCurrentOp())
+    for (const auto &[idx, data] : space_op->GetSurfaceCurrentOp())
     {
       if (first)
       {
         Mpi::Print(" Surface current excitation specified on port{}",
-                   (space_op.GetSurfaceCurrentOp().Size() > 1) ? "s" : "");
+                   (space_op->GetSurfaceCurrentOp().Size() > 1) ? "s" : "");
         first = false;
       }
       Mpi::Print(" {:d}", idx);
@@ -97,16 +113,37 @@ DrivenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
     MFEM_VERIFY(excitations > 0, "No excitation specified for driven simulation!");
   }
   Mpi::Print("\n");
+  if (iodata.solver.driven.multi_excitation)
+  {
+    MFEM_VERIFY(space_op->GetSurfaceCurrentOp().Size() == 0,
+                "Multi-excitation driven simulations do not support surface current "
+                "excitations!");
+    Mpi::Print(" Solving separately for each of {:d} excited ports\n",
+               space_op->GetExcitationIndices().size());
+  }
 
-  // Main frequency sweep loop.
-  return {adaptive ? SweepAdaptive(space_op, post_op, n_step, step0, omega0, delta_omega)
-                   : SweepUniform(space_op, post_op, n_step, step0, omega0, delta_omega),
-          space_op.GlobalTrueVSize()};
+  // Main frequency sweep loop. Uniform sweeps can optionally distribute the frequencies
+  // over groups of processes, in which case the operators on the full communicator are
+  // freed before the groups construct their own.
+  const auto ndof = space_op->GlobalTrueVSize();
+  if (!adaptive && iodata.solver.driven.frequency_groups > 1)
+  {
+    space_op.reset();
+    return {SweepUniformGroups(mesh, n_step, step0, omega0, delta_omega), ndof};
+  }
+
+  // Frequencies will be sampled uniformly in the frequency domain. Index sets are for
+  // computing things like S-parameters in postprocessing.
+  PostOperator post_op(iodata, *space_op, "driven");
+  return {adaptive ? SweepAdaptive(mesh, *space_op, post_op, n_step, step0, omega0,
+                                   delta_omega)
+                   : SweepUniform(*space_op, post_op, n_step, step0, omega0, delta_omega),
+          ndof};
 }
 
 ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &space_op, PostOperator &post_op,
                                           int n_step, int step0, double omega0,
-                                          double delta_omega) const
+                                          double delta_omega, int step_stride) const
 {
   // Construct the system matrices defining the linear operator. PEC boundaries are handled
   // simply by setting diagonal entries of the system matrix for the corresponding dofs.
@@ -131,6 +168,11 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &space_op, PostOperator
   ComplexKspSolver ksp(iodata, space_op.GetNDSpaces(), &space_op.GetH1Spaces());
   ksp.SetOperators(*A, *P);
 
+  // The preconditioner can optionally be reused across nearby frequencies, in which case
+  // the Krylov solver acts as an iterative refinement for the existing factorization.
+  const double pc_reuse_tol = iodata.solver.linear.pc_reuse_tol;
+  double omega_pc = omega0;
+
   // Set up RHS vector for the incident field at port boundaries, and the vector for the
   // first frequency step.
   ComplexVector RHS(Curl.Width()), E(Curl.Width()), B(Curl.Height());
@@ -140,13 +182,54 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &space_op, PostOperator
   E = 0.0;
   B = 0.0;
 
-  // Initialize structures for storing and reducing the results of error estimation.
-  TimeDependentFluxErrorEstimator<ComplexVector> estimator(
-      space_op.GetMaterialOp(), space_op.GetNDSpaces(), space_op.GetRTSpaces(),
-      iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
-      iodata.solver.linear.estimator_mg);
+  // For multi-excitation sweeps, the right-hand sides for all excited ports are solved for
+  // one after another with the same system matrix and preconditioner, and the S-matrix is
+  // accumulated over the excitations at each frequency.
+  const auto excitations = iodata.solver.driven.multi_excitation
+                               ? space_op.GetExcitationIndices()
+                               : std::vector<int>();
+  std::vector<ComplexVector> RHSe, Ee;
+  if (excitations.size() > 1)
+  {
+    RHSe.resize(excitations.size());
+    Ee.resize(excitations.size());
+    for (std::size_t e = 0; e < excitations.size(); e++)
+    {
+      RHSe[e].SetSize(Curl.Width());
+      Ee[e].SetSize(Curl.Width());
+      RHSe[e].UseDevice(true);
+      Ee[e].UseDevice(true);
+      Ee[e] = 0.0;
+    }
+  }
+  SParameterMap S;
+
+  // Initialize structures for storing and reducing the results of error estimation. The
+  // estimator is only constructed if error estimates are requested, since each estimate
+  // requires global flux projections.
+  const int estimator_step = iodata.solver.driven.estimator_step;
+  std::unique_ptr<TimeDependentFluxErrorEstimator<ComplexVector>> estimator;
+  if (estimator_step > 0)
+  {
+    estimator = std::make_unique<TimeDependentFluxErrorEstimator<ComplexVector>>(
+        space_op.GetMaterialOp(), space_op.GetNDSpaces(), space_op.GetRTSpaces(),
+        iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
+        iodata.solver.linear.estimator_mg);
+  }
   ErrorIndicator indicator;
 
+  // Optionally, the initial guess for each linear solve is computed from the solutions at
+  // previous frequencies, with separate histories for each excitation.
+  std::vector<SolutionHistory> history;
+  if (iodata.solver.linear.initial_guess && iodata.solver.linear.initial_guess_history > 0)
+  {
+    for (std::size_t e = 0; e < std::max<std::size_t>(excitations.size(), 1); e++)
+    {
+      history.emplace_back(space_op.GetComm(), iodata.solver.linear.initial_guess_history,
+                           *K, C.get(), *M);
+    }
+  }
+
   // Main frequency sweep loop.
   int step = step0;
   double omega = omega0;
@@ -165,13 +248,78 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &space_op, PostOperator
       A = space_op.GetSystemMatrix(std::complex<double>(1.0, 0.0), 1i * omega,
                                    std::complex<double>(-omega * omega, 0.0), K.get(),
                                    C.get(), M.get(), A2.get());
-      P = space_op.GetPreconditionerMatrix<ComplexOperator>(1.0, omega, -omega * omega,
-                                                            omega);
-      ksp.SetOperators(*A, *P);
+      if (std::abs(omega - omega_pc) > pc_reuse_tol * std::abs(omega_pc))
+      {
+        P = space_op.GetPreconditionerMatrix<ComplexOperator>(1.0, omega, -omega * omega,
+                                                              omega);
+        ksp.SetOperators(*A, *P);
+        omega_pc = omega;
+      }
+      else
+      {
+        Mpi::Print(" Reusing preconditioner from ω/2π = {:.3e} GHz\n",
+                   iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, omega_pc));
+        ksp.SetOperator(*A);
+      }
+    }
+    if (excitations.size() > 1)
+    {
+      // Solve for each excitation reusing the system matrix and preconditioner (the Krylov
+      // solver solves the right-hand sides independently), and compute the corresponding
+      // columns of the S-matrix. The remaining postprocessing
+      // uses the sum of the solutions, which corresponds to all ports being excited.
+      RHS = 0.0;
+      E = 0.0;
+      S.clear();
+      for (std::size_t e = 0; e < excitations.size(); e++)
+      {
+        space_op.SetExcitationIndex(excitations[e]);
+        space_op.GetExcitationVector(omega, RHSe[e]);
+        if (!history.empty())
+        {
+          history[e].GetInitialGuess(omega, A2.get(), RHSe[e], Ee[e]);
+        }
+      }
+      Mpi::Print("\n");
+      ksp.ArrayMult(RHSe, Ee);
+      for (std::size_t e = 0; e < excitations.size(); e++)
+      {
+        const int idx = excitations[e];
+        if (!history.empty())
+        {
+          history[e].AddSolution(Ee[e]);
+        }
+        RHS += RHSe[e];
+        E += Ee[e];
+
+        BlockTimer bt0(Timer::POSTPRO);
+        Mpi::Print("\n Excitation on port {:d}:\n", idx);
+        space_op.SetExcitationIndex(idx);
+        Curl.Mult(Ee[e].Real(), B.Real());
+        Curl.Mult(Ee[e].Imag(), B.Imag());
+        B *= -1.0 / (1i * omega);
+        post_op.SetEGridFunction(Ee[e]);
+        post_op.SetBGridFunction(B);
+        post_op.UpdatePorts(space_op.GetLumpedPortOp(), space_op.GetWavePortOp(), omega);
+        PostprocessSParameters(post_op, space_op.GetLumpedPortOp(),
+                               space_op.GetWavePortOp(), step, omega, &S);
+      }
+      space_op.SetExcitationIndex(-1);
+    }
+    else
+    {
+      space_op.GetExcitationVector(omega, RHS);
+      Mpi::Print("\n");
+      if (!history.empty())
+      {
+        history[0].GetInitialGuess(omega, A2.get(), RHS, E);
+      }
+      ksp.Mult(RHS, E);
+      if (!history.empty())
+      {
+        history[0].AddSolution(E);
+      }
     }
-    space_op.GetExcitationVector(omega, RHS);
-    Mpi::Print("\n");
-    ksp.Mult(RHS, E);
 
     // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
     // PostOperator for all postprocessing operations.
@@ -193,25 +341,435 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &space_op, PostOperator
                  E_mag * J, (E_elec + E_mag) * J);
     }
 
-    // Calculate and record the error indicators.
-    Mpi::Print(" Updating solution error estimates\n");
-    estimator.AddErrorIndicator(E, B, E_elec + E_mag, indicator);
+    // Calculate and record the error indicators, optionally only for a subset of the
+    // frequencies.
+    if (estimator && ((step - step0) / step_stride) % estimator_step == 0)
+    {
+      Mpi::Print(" Updating solution error estimates\n");
+      estimator->AddErrorIndicator(E, B, E_elec + E_mag, indicator);
+    }
 
-    // Postprocess S-parameters and optionally write solution to disk.
+    // Postprocess S-parameters and optionally write solution to disk. The step index is
+    // global, so that field output and CSV headers are the same for strided sweeps.
+    const bool last = (step_stride == 1 && step == n_step - 1);
     Postprocess(post_op, space_op.GetLumpedPortOp(), space_op.GetWavePortOp(),
                 space_op.GetSurfaceCurrentOp(), step, omega, E_elec, E_mag,
-                (step == n_step - 1) ? &indicator : nullptr);
+                (last && estimator) ? &indicator : nullptr);
+    PostprocessSMatrix(step, omega, S);
 
     // Increment frequency.
-    step++;
-    omega += delta_omega;
+    step += step_stride;
+    omega += step_stride * delta_omega;
   }
   BlockTimer bt0(Timer::POSTPRO);
   SaveMetadata(ksp);
   return indicator;
 }
 
-ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &space_op, PostOperator &post_op,
+namespace
+{
+
+Vector TransferGroupIndicator(MPI_Comm comm, int ne, const std::vector<int> &elem_map,
+                              const Vector &group_local, double weight)
+{
+  // Each process of the full mesh owns a contiguous range of elements in the global
+  // ordering. The element map of a redistributed mesh hierarchy is not increasing, so the
+  // local elements are sorted by their global index to make the elements for each
+  // destination process contiguous.
+  const int size = Mpi::Size(comm), rank = Mpi::Rank(comm);
+  std::vector<int> elem_offsets(size + 1, 0);
+  MPI_Allgather(&ne, 1, MPI_INT, elem_offsets.data() + 1, 1, MPI_INT, comm);
+  std::partial_sum(elem_offsets.begin(), elem_offsets.end(), elem_offsets.begin());
+  std::vector<std::pair<int, double>> elem_data(elem_map.size());
+  {
+    const double *data = group_local.HostRead();
+    for (std::size_t i = 0; i < elem_map.size(); i++)
+    {
+      elem_data[i] = {elem_map[i], data[i]};
+    }
+  }
+  std::sort(elem_data.begin(), elem_data.end());
+  std::vector<int> send_elems(elem_data.size()), send_counts(size, 0),
+      send_displs(size + 1, 0);
+  std::vector<double> send_data(elem_data.size());
+  for (std::size_t i = 0; i < elem_data.size(); i++)
+  {
+    std::tie(send_elems[i], send_data[i]) = elem_data[i];
+    const auto it =
+        std::upper_bound(elem_offsets.begin(), elem_offsets.end(), send_elems[i]);
+    send_counts[static_cast<int>(it - elem_offsets.begin()) - 1]++;
+  }
+  std::partial_sum(send_counts.begin(), send_counts.end(), send_displs.begin() + 1);
+  std::vector<int> recv_counts(size), recv_displs(size + 1, 0);
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, comm);
+  std::partial_sum(recv_counts.begin(), recv_counts.end(), recv_displs.begin() + 1);
+  std::vector<int> recv_elems(recv_displs.back());
+  std::vector<double> recv_data(recv_displs.back());
+  MPI_Alltoallv(send_elems.data(), send_counts.data(), send_displs.data(), MPI_INT,
+                recv_elems.data(), recv_counts.data(), recv_displs.data(), MPI_INT, comm);
+  MPI_Alltoallv(send_data.data(), send_counts.data(), send_displs.data(), MPI_DOUBLE,
+                recv_data.data(), recv_counts.data(), recv_displs.data(), MPI_DOUBLE,
+                comm);
+
+  // Every element of the full mesh receives one indicator from each group, which are
+  // combined as a weighted average of the squares as in ErrorIndicator::AddIndicator.
+  Vector local(ne);
+  local = 0.0;
+  for (std::size_t k = 0; k < recv_elems.size(); k++)
+  {
+    local(recv_elems[k] - elem_offsets[rank]) += weight * recv_data[k] * recv_data[k];
+  }
+  for (int i = 0; i < ne; i++)
+  {
+    local(i) = std::sqrt(local(i));
+  }
+  return local;
+}
+
+// Helper class for solving the HDM at several frequencies concurrently during the adaptive
+// frequency sweep offline phase. The processes are split into contiguous groups, each with
+// its own copy of the mesh hierarchy, and the frequencies are distributed over the groups.
+// The solutions are transferred back to the finite element space on the original mesh.
+class GroupHDMSolver
+{
+private:
+  MPI_Comm group_comm;
+  int n_groups, group;
+  std::vector<int> groups, elem_map;
+  std::vector<std::unique_ptr<Mesh>> group_mesh;
+  std::unique_ptr<SpaceOperator> group_space_op;
+  std::unique_ptr<RomOperator> group_prom_op;
+
+public:
+  GroupHDMSolver(const IoData &iodata, const std::vector<std::unique_ptr<Mesh>> &mesh,
+                 int n_groups)
+    : n_groups(n_groups)
+  {
+    MPI_Comm comm = mesh.back()->GetComm();
+    MFEM_VERIFY(n_groups <= Mpi::Size(comm),
+                "Frequency groups require at least one MPI process per group!");
+    group = static_cast<int>(static_cast<long long int>(Mpi::Rank(comm)) * n_groups /
+                             Mpi::Size(comm));
+    MPI_Comm_split(comm, group, Mpi::Rank(comm), &group_comm);
+    groups.resize(Mpi::Size(comm));
+    MPI_Allgather(&group, 1, MPI_INT, groups.data(), 1, MPI_INT, comm);
+
+    // Redistribute the mesh hierarchy over the processes of the group (preserving the
+    // levels for geometric multigrid).
+    std::vector<const mfem::ParMesh *> levels;
+    for (const auto &m : mesh)
+    {
+      levels.push_back(&m->Get());
+    }
+    for (auto &m : mesh::RedistributeMesh(levels, group_comm, elem_map))
+    {
+      group_mesh.push_back(std::make_unique<Mesh>(std::move(m)));
+    }
+    group_space_op = std::make_unique<SpaceOperator>(iodata, group_mesh);
+    group_space_op->GetWavePortOp().SetSuppressOutput(true);
+    group_prom_op = std::make_unique<RomOperator>(iodata, *group_space_op, 1);
+    Mpi::Print("\nConfiguring {:d} process groups for concurrent HDM solves on {:d} "
+               "processes\n",
+               n_groups, Mpi::Size(comm));
+  }
+
+  ~GroupHDMSolver()
+  {
+    group_prom_op.reset();
+    group_space_op.reset();
+    group_mesh.clear();
+    MPI_Comm_free(&group_comm);
+  }
+
+  const auto &GetLinearSolver() const { return group_prom_op->GetLinearSolver(); }
+
+  // Solve the HDM at the given frequencies for all excitations, where the sample i is
+  // solved by group i % G. The solutions are returned in E for each frequency and
+  // excitation.
+  void Solve(const std::vector<double> &omega, FiniteElementSpace &nd_fespace,
+             std::vector<std::vector<ComplexVector>> &E)
+  {
+    const int n_exc = group_prom_op->GetNumExcitations();
+    std::vector<ComplexVector> E_group, Ei(n_exc);
+    std::vector<std::pair<int, int>> idx;
+    for (auto &Eie : Ei)
+    {
+      Eie.SetSize(group_space_op->GetNDSpace().GetTrueVSize());
+      Eie.UseDevice(true);
+      Eie = 0.0;
+    }
+    for (std::size_t i = 0; i < omega.size(); i++)
+    {
+      const int g = static_cast<int>(i) % n_groups;
+      for (int e = 0; e < n_exc; e++)
+      {
+        idx.emplace_back(g, static_cast<int>(i) / n_groups * n_exc + e);
+      }
+      if (g == group)
+      {
+        group_prom_op->SolveHDM(omega[i], Ei);
+        E_group.insert(E_group.end(), Ei.begin(), Ei.end());
+      }
+    }
+    std::vector<ComplexVector> E_full;
+    BlockTimer bt(Timer::CONSTRUCT_PROM);
+    fem::TransferGroupVectors(nd_fespace, group_space_op->GetNDSpace(), elem_map, groups,
+                              E_group, idx, E_full);
+    for (std::size_t k = 0; k < E_full.size(); k++)
+    {
+      E[k / n_exc][k % n_exc] = E_full[k];
+    }
+  }
+};
+
+}  // namespace
+
+ErrorIndicator
+DrivenSolver::SweepUniformGroups(const std::vector<std::unique_ptr<Mesh>> &mesh, int n_step,
+                                 int step0, double omega0, double delta_omega) const
+{
+  // Split the processes into contiguous groups, where group g sweeps the frequency steps
+  // step0 + g + G k for k = 0, 1, ... using its own copy of the mesh hierarchy.
+  MPI_Comm comm = mesh.back()->GetComm();
+  const int n_groups = iodata.solver.driven.frequency_groups;
+  MFEM_VERIFY(n_groups <= Mpi::Size(comm),
+              "Frequency groups require at least one MPI process per group!");
+  MFEM_VERIFY(n_groups <= n_step - step0,
+              "Number of frequency groups must not exceed the number of frequency steps!");
+  MFEM_VERIFY(iodata.model.refinement.max_it == 0,
+              "Adaptive mesh refinement is not supported with frequency groups!");
+  const int group = static_cast<int>(static_cast<long long int>(Mpi::Rank(comm)) *
+                                     n_groups / Mpi::Size(comm));
+  MPI_Comm group_comm;
+  MPI_Comm_split(comm, group, Mpi::Rank(comm), &group_comm);
+  auto GetGroupSteps = [&](int g)
+  { return (n_step - step0 - g + n_groups - 1) / n_groups; };
+  auto GetGroupDir = [&](int g)
+  { return post_dir.empty() ? post_dir : fmt::format("{}group{:d}/", post_dir, g + 1); };
+  Mpi::Print("\nConfiguring {:d} frequency groups on {:d} processes\n", n_groups,
+             Mpi::Size(comm));
+  Mpi::Print(" Postprocessing for group 1 is shown, results are merged at the end of the "
+             "sweep\n");
+  if (root && !post_dir.empty())
+  {
+    // Remove any output of the groups left from a previous simulation, since the group
+    // output files are appended to.
+    for (int g = 0; g < n_groups; g++)
+    {
+      std::filesystem::remove_all(GetGroupDir(g));
+    }
+  }
+  Mpi::Barrier(comm);
+
+  Vector group_local;
+  std::vector<int> elem_map;
+  {
+    // Each group writes its results to a separate subdirectory of the output directory,
+    // which are merged below.
+    IoData group_iodata(iodata);
+    group_iodata.problem.output = GetGroupDir(group);
+    DrivenSolver group_solver(group_iodata, Mpi::Root(group_comm), Mpi::Size(group_comm));
+
+    // Redistribute the mesh hierarchy over the processes of the group (preserving the
+    // levels for geometric multigrid), and sweep the group's frequencies. The steps are
+    // numbered globally, so the field output uses the same steps as an ungrouped sweep.
+    BlockTimer bt0(Timer::CONSTRUCT);
+    std::vector<const mfem::ParMesh *> levels;
+    for (const auto &m : mesh)
+    {
+      levels.push_back(&m->Get());
+    }
+    std::vector<std::unique_ptr<Mesh>> group_mesh;
+    for (auto &m : mesh::RedistributeMesh(levels, group_comm, elem_map))
+    {
+      group_mesh.push_back(std::make_unique<Mesh>(std::move(m)));
+    }
+    SpaceOperator group_space_op(group_iodata, group_mesh);
+    PostOperator group_post_op(group_iodata, group_space_op, "driven");
+    auto group_indicator = group_solver.SweepUniform(group_space_op, group_post_op, n_step,
+                                                     step0 + group,
+                                                     omega0 + group * delta_omega,
+                                                     delta_omega, n_groups);
+    group_local = group_indicator.Local();
+  }
+
+  // Transfer the error indicators to the original mesh, averaging over all estimated
+  // frequencies.
+  const int estimator_step = iodata.solver.driven.estimator_step;
+  ErrorIndicator indicator;
+  if (estimator_step > 0)
+  {
+    auto GetGroupEstimates = [&](int g)
+    { return (GetGroupSteps(g) + estimator_step - 1) / estimator_step; };
+    int n_estimates = 0;
+    for (int g = 0; g < n_groups; g++)
+    {
+      n_estimates += GetGroupEstimates(g);
+    }
+    indicator = ErrorIndicator(TransferGroupIndicator(
+        comm, mesh.back()->GetNE(), elem_map, group_local,
+        static_cast<double>(GetGroupEstimates(group)) / n_estimates));
+  }
+  Mpi::Barrier(comm);
+  MPI_Comm_free(&group_comm);
+
+  // Merge the output of all groups into the output directory, so that it has the same
+  // layout as for an ungrouped sweep. The group directories are removed unless some of
+  // their output could not be merged.
+  if (root && !post_dir.empty())
+  {
+    namespace fs = std::filesystem;
+    BlockTimer bt(Timer::IO);
+    bool merged = true;
+
+    // The CSV files contain one row for each frequency of the group, which are interleaved
+    // in frequency order. Only the group with the first step of the sweep writes headers.
+    std::vector<std::string> names;
+    for (const auto &f : fs::directory_iterator(GetGroupDir(0)))
+    {
+      if (f.path().extension() == ".csv")
+      {
+        names.push_back(f.path().filename().string());
+      }
+    }
+    std::sort(names.begin(), names.end());
+    for (const auto &name : names)
+    {
+      std::vector<std::vector<std::string>> lines(n_groups);
+      std::vector<int> n_header(n_groups);
+      bool valid = true;
+      for (int g = 0; g < n_groups; g++)
+      {
+        std::ifstream fi(GetGroupDir(g) + name);
+        for (std::string line; std::getline(fi, line);)
+        {
+          lines[g].push_back(std::move(line));
+        }
+        n_header[g] = static_cast<int>(lines[g].size()) - GetGroupSteps(g);
+        valid = valid && (n_header[g] >= 0);
+      }
+      if (!valid)
+      {
+        Mpi::Warning(MPI_COMM_SELF, "Unable to merge frequency group output file {}!\n",
+                     name);
+        merged = false;
+        continue;
+      }
+      auto output = OutputFile(post_dir + name, (step0 > 0));
+      for (int i = 0; i < n_header[0]; i++)
+      {
+        output.print("{}\n", lines[0][i]);
+      }
+      for (int s = 0; s < n_step - step0; s++)
+      {
+        const int g = s % n_groups;
+        output.print("{}\n", lines[g][n_header[g] + s / n_groups]);
+      }
+    }
+
+    // The fields of each group are saved with global cycle numbers, so the cycles are
+    // moved into a single ParaView data collection and the entries of the collection
+    // files are combined in cycle order.
+    const fs::path paraview = fs::path(GetGroupDir(0)) / "paraview";
+    for (const auto &d : fs::exists(paraview) ? fs::directory_iterator(paraview)
+                                              : fs::directory_iterator())
+    {
+      const fs::path dst = fs::path(post_dir) / "paraview" / d.path().filename();
+      fs::create_directories(dst);
+      std::string pvd;
+      std::vector<std::string> header, footer, datasets;
+      for (int g = 0; g < n_groups; g++)
+      {
+        const fs::path src = fs::path(GetGroupDir(g)) / "paraview" / d.path().filename();
+        for (const auto &f :
+             fs::exists(src) ? fs::directory_iterator(src) : fs::directory_iterator())
+        {
+          if (f.path().extension() != ".pvd")
+          {
+            fs::remove_all(dst / f.path().filename());
+            fs::rename(f.path(), dst / f.path().filename());
+            continue;
+          }
+          pvd = f.path().filename().string();
+          std::ifstream fi(f.path());
+          std::vector<std::string> group_header, group_footer;
+          const std::size_t n_datasets = datasets.size();
+          for (std::string line; std::getline(fi, line);)
+          {
+            if (line.find("<DataSet") != std::string::npos)
+            {
+              datasets.push_back(std::move(line));
+            }
+            else
+            {
+              auto &block = (datasets.size() == n_datasets) ? group_header : group_footer;
+              block.push_back(std::move(line));
+            }
+          }
+          if (header.empty())
+          {
+            header = std::move(group_header);
+            footer = std::move(group_footer);
+          }
+        }
+      }
+      if (pvd.empty())
+      {
+        continue;
+      }
+      auto Cycle = [](const std::string &line) { return line.substr(line.find("file=")); };
+      std::sort(datasets.begin(), datasets.end(), [&](const auto &a, const auto &b)
+                { return Cycle(a) < Cycle(b); });
+      std::ofstream fo(dst / pvd);
+      for (const auto *block : {&header, &datasets, &footer})
+      {
+        for (const auto &line : *block)
+        {
+          fo << line << '\n';
+        }
+      }
+    }
+
+    // Accumulate the linear solver statistics of the groups in the simulation metadata.
+    auto LoadMetadata = [](const std::string &dir)
+    {
+      std::ifstream fi(dir + "palace.json");
+      return json::parse(fi);
+    };
+    json meta = LoadMetadata(post_dir);
+    long long int solves = 0, its = 0;
+    for (int g = 0; g < n_groups; g++)
+    {
+      const json group_meta = LoadMetadata(GetGroupDir(g));
+      if (group_meta.contains("LinearSolver"))
+      {
+        solves += group_meta["LinearSolver"]["TotalSolves"].get<long long int>();
+        its += group_meta["LinearSolver"]["TotalIts"].get<long long int>();
+      }
+    }
+    meta["LinearSolver"]["TotalSolves"] = solves;
+    meta["LinearSolver"]["TotalIts"] = its;
+    std::ofstream fo(post_dir + "palace.json");
+    fo << meta.dump(2) << '\n';
+
+    if (merged)
+    {
+      for (int g = 0; g < n_groups; g++)
+      {
+        fs::remove_all(GetGroupDir(g));
+      }
+    }
+  }
+  if (estimator_step > 0)
+  {
+    BlockTimer bt0(Timer::POSTPRO);
+    PostprocessErrorIndicator(comm, indicator);
+  }
+  return indicator;
+}
+
+ErrorIndicator DrivenSolver::SweepAdaptive(const std::vector<std::unique_ptr<Mesh>> &mesh,
+                                           SpaceOperator &space_op, PostOperator &post_op,
                                            int n_step, int step0, double omega0,
                                            double delta_omega) const
 {
@@ -226,6 +784,8 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &space_op, PostOperator
   }
   max_size = std::min(max_size, n_step - step0);  // Maximum size dictated by sweep
   int convergence_memory = iodata.solver.driven.adaptive_memory;
+  const bool load_model = !iodata.solver.driven.adaptive_load_model.empty();
+  const bool group_hdm = !load_model && iodata.solver.driven.frequency_groups > 1;
 
   // Allocate negative curl matrix for postprocessing the B-field and vectors for the
   // high-dimensional field solution.
@@ -238,11 +798,17 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &space_op, PostOperator
   Eh = 0.0;
   B = 0.0;
 
-  // Initialize structures for storing and reducing the results of error estimation.
-  TimeDependentFluxErrorEstimator<ComplexVector> estimator(
-      space_op.GetMaterialOp(), space_op.GetNDSpaces(), space_op.GetRTSpaces(),
-      iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
-      iodata.solver.linear.estimator_mg);
+  // Initialize structures for storing and reducing the results of error estimation. Error
+  // estimates are computed only at the PROM sample points, and not at all when the PROM is
+  // loaded from disk.
+  std::unique_ptr<TimeDependentFluxErrorEstimator<ComplexVector>> estimator;
+  if (iodata.solver.driven.estimator_step > 0 && !load_model)
+  {
+    estimator = std::make_unique<TimeDependentFluxErrorEstimator<ComplexVector>>(
+        space_op.GetMaterialOp(), space_op.GetNDSpaces(), space_op.GetRTSpaces(),
+        iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
+        iodata.solver.linear.estimator_mg);
+  }
   ErrorIndicator indicator;
 
   // Configure the PROM operator which performs the parameter space sampling and basis
@@ -250,99 +816,252 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &space_op, PostOperator
   // phase.
   auto t0 = Timer::Now();
   const double f0 = iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, 1.0);
-  Mpi::Print("\nBeginning PROM construction offline phase:\n"
+  Mpi::Print("\n{}:\n"
              " {:d} points for frequency sweep over [{:.3e}, {:.3e}] GHz\n",
+             load_model ? "Loading saved PROM model"
+                        : "Beginning PROM construction offline phase",
              n_step - step0, omega0 * f0,
              (omega0 + (n_step - step0 - 1) * delta_omega) * f0);
   RomOperator prom_op(iodata, space_op, max_size);
-  space_op.GetWavePortOp().SetSuppressOutput(
-      true);  // Suppress wave port output for offline
-
-  // Initialize the basis with samples from the top and bottom of the frequency
-  // range of interest. Each call for an HDM solution adds the frequency sample to P_S and
-  // removes it from P \ P_S. Timing for the HDM construction and solve is handled inside
-  // of the RomOperator.
-  auto UpdatePROM = [&](double omega)
+  const int n_exc = prom_op.GetNumExcitations();
+  if (load_model)
   {
-    // Add the HDM solution to the PROM reduced basis.
-    prom_op.UpdatePROM(omega, E);
+    // Skip the offline phase and load the reduced-order basis from a previous simulation.
+    std::string dir = iodata.solver.driven.adaptive_load_model;
+    if (dir.back() != '/')
+    {
+      dir += '/';
+    }
+    prom_op.LoadModel(dir + "prom_");
+    const auto &z = prom_op.GetSamplePoints();
+    Mpi::Print(" n = {:d}\n", prom_op.GetReducedDimension());
+    utils::PrettyPrint(z, f0, " Sampled frequencies (GHz):");
+    const double omega1 = omega0 + (n_step - step0 - 1) * delta_omega;
+    if (std::min(omega0, omega1) < *std::min_element(z.begin(), z.end()) ||
+        std::max(omega0, omega1) > *std::max_element(z.begin(), z.end()))
+    {
+      Mpi::Warning("Frequency sweep extends beyond the range sampled by the loaded PROM "
+                   "model, results outside of the sampled range may be inaccurate!\n");
+    }
+  }
+  else
+  {
+    space_op.GetWavePortOp().SetSuppressOutput(
+        true);  // Suppress wave port output for offline
 
-    // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
-    // PostOperator for energy postprocessing and error estimation.
-    BlockTimer bt0(Timer::POSTPRO);
-    Curl.Mult(E.Real(), B.Real());
-    Curl.Mult(E.Imag(), B.Imag());
-    B *= -1.0 / (1i * omega);
-    post_op.SetEGridFunction(E, false);
-    post_op.SetBGridFunction(B, false);
-    const double E_elec = post_op.GetEFieldEnergy();
-    const double E_mag = post_op.GetHFieldEnergy();
-    estimator.AddErrorIndicator(E, B, E_elec + E_mag, indicator);
-  };
-  prom_op.SolveHDM(omega0, E);
-  UpdatePROM(omega0);
-  prom_op.SolveHDM(omega0 + (n_step - step0 - 1) * delta_omega, E);
-  UpdatePROM(omega0 + (n_step - step0 - 1) * delta_omega);
-
-  // Greedy procedure for basis construction (offline phase). Basis is initialized with
-  // solutions at frequency sweep endpoints.
-  int it = 2, it0 = it, memory = 0;
-  std::vector<double> max_errors = {0.0, 0.0};
-  while (true)
-  {
-    // Compute the location of the maximum error in parameter domain (bounded by the
-    // previous samples).
-    double omega_star = prom_op.FindMaxError()[0];
-
-    // Compute the actual solution error at the given parameter point.
-    prom_op.SolveHDM(omega_star, E);
-    prom_op.SolvePROM(omega_star, Eh);
-    linalg::AXPY(-1.0, E, Eh);
-    max_errors.push_back(linalg::Norml2(space_op.GetComm(), Eh) /
-                         linalg::Norml2(space_op.GetComm(), E));
-    if (max_errors.back() < offline_tol)
-    {
-      if (++memory == convergence_memory)
+    // Optionally, the HDM solves for the samples of each batch are distributed over groups
+    // of processes and run concurrently.
+    std::unique_ptr<GroupHDMSolver> group_solver;
+    if (group_hdm)
+    {
+      BlockTimer bt0(Timer::CONSTRUCT);
+      group_solver = std::make_unique<GroupHDMSolver>(
+          iodata, mesh, iodata.solver.driven.frequency_groups);
+    }
+
+    // Initialize the basis with samples from the top and bottom of the frequency
+    // range of interest. Each call for an HDM solution adds the frequency sample to P_S and
+    // removes it from P \ P_S. Timing for the HDM construction and solve is handled inside
+    // of the RomOperator.
+    auto AddErrorIndicator = [&](double omega, const ComplexVector &E)
+    {
+      if (!estimator)
       {
-        break;
+        return;
+      }
+      // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
+      // PostOperator for energy postprocessing and error estimation.
+      BlockTimer bt0(Timer::POSTPRO);
+      Curl.Mult(E.Real(), B.Real());
+      Curl.Mult(E.Imag(), B.Imag());
+      B *= -1.0 / (1i * omega);
+      post_op.SetEGridFunction(E, false);
+      post_op.SetBGridFunction(B, false);
+      const double E_elec = post_op.GetEFieldEnergy();
+      const double E_mag = post_op.GetHFieldEnergy();
+      estimator->AddErrorIndicator(E, B, E_elec + E_mag, indicator);
+    };
+    // HDM solutions for a batch of samples are stored for all excitations at each sample
+    // point, and the excitations at each sample point share the system matrix and
+    // preconditioner.
+    const int batch_size = iodata.solver.driven.adaptive_batch_size;
+    std::vector<std::vector<ComplexVector>> E_batch(std::max(batch_size, 2),
+                                                    std::vector<ComplexVector>(n_exc));
+    for (auto &Ei : E_batch)
+    {
+      for (auto &Eie : Ei)
+      {
+        Eie.SetSize(E.Size());
+        Eie.UseDevice(true);
+        Eie = 0.0;
       }
     }
-    else
+    auto SolveHDM = [&](const std::vector<double> &omega)
     {
-      memory = 0;
+      // Compute the HDM solutions for all excitations at the given frequencies. With
+      // process groups, the HDM terms needed for the PROM at the sampled frequencies are
+      // still computed on the original mesh.
+      if (group_solver)
+      {
+        group_solver->Solve(omega, space_op.GetNDSpace(), E_batch);
+        for (auto w : omega)
+        {
+          prom_op.AddHDMSample(w);
+        }
+        return;
+      }
+      for (std::size_t i = 0; i < omega.size(); i++)
+      {
+        prom_op.SolveHDM(omega[i], E_batch[i]);
+      }
+    };
+    auto UpdatePROM = [&](const std::vector<double> &omega)
+    {
+      // Add the HDM solutions to the PROM reduced basis.
+      std::vector<const ComplexVector *> u(omega.size() * n_exc);
+      for (std::size_t i = 0; i < u.size(); i++)
+      {
+        u[i] = &E_batch[i / n_exc][i % n_exc];
+      }
+      prom_op.UpdatePROM(omega, u);
+      for (std::size_t i = 0; i < u.size(); i++)
+      {
+        AddErrorIndicator(omega[i / n_exc], *u[i]);
+      }
+    };
+    {
+      const std::vector<double> omega_init = {omega0,
+                                              omega0 + (n_step - step0 - 1) * delta_omega};
+      SolveHDM(omega_init);
+      UpdatePROM(omega_init);
     }
-    if (it == max_size)
+
+    // Greedy procedure for basis construction (offline phase). Basis is initialized with
+    // solutions at frequency sweep endpoints. Each iteration samples up to batch_size
+    // frequencies at distinct local maxima of the error estimate, and the PROM is updated
+    // once for the whole batch. When the system is affine in the frequency, the PROM
+    // residual norm over the sweep frequencies is used both to select the samples and to
+    // assess convergence. Otherwise, the samples are selected using the MRI error indicator
+    // and the error is computed with an HDM solve at each.
+    const bool use_residual = prom_op.HasResidualEstimate();
+    std::vector<double> omega_sweep;
+    if (use_residual)
     {
-      break;
+      Mpi::Print("\nUsing PROM residual for adaptive sampling error estimate\n");
+      for (int step = step0; step < n_step; step++)
+      {
+        omega_sweep.push_back(omega0 + (step - step0) * delta_omega);
+      }
     }
+    int it = 2, it0 = it, memory = 0;
+    std::vector<double> max_errors = {0.0, 0.0};
+    while (true)
+    {
+      // Compute the locations of the maximum error in parameter domain (bounded by the
+      // previous samples).
+      const int n_batch = std::min(batch_size, std::max(max_size - it, 1));
+      double max_error = 0.0;
+      const auto omega_star = use_residual
+                                  ? prom_op.FindMaxResidual(omega_sweep, n_batch, max_error)
+                                  : prom_op.FindMaxError(n_batch);
 
-    // Sample HDM and add solution to basis.
-    Mpi::Print("\nGreedy iteration {:d} (n = {:d}): ω* = {:.3e} GHz ({:.3e}), error = "
-               "{:.3e}{}\n",
-               it - it0 + 1, prom_op.GetReducedDimension(), omega_star * f0, omega_star,
-               max_errors.back(),
-               (memory == 0)
-                   ? ""
-                   : fmt::format(", memory = {:d}/{:d}", memory, convergence_memory));
-    UpdatePROM(omega_star);
-    it++;
+      // Compute the actual solution error at the given parameter points.
+      if (!use_residual)
+      {
+        SolveHDM(omega_star);
+      }
+      for (std::size_t i = 0; !use_residual && i < omega_star.size() * n_exc; i++)
+      {
+        const auto &Ei = E_batch[i / n_exc][i % n_exc];
+        prom_op.SolvePROM(omega_star[i / n_exc], Eh, static_cast<int>(i % n_exc));
+        linalg::AXPY(-1.0, Ei, Eh);
+        max_error = std::max(max_error, linalg::Norml2(space_op.GetComm(), Eh) /
+                                            linalg::Norml2(space_op.GetComm(), Ei));
+      }
+      max_errors.push_back(max_error);
+      if (max_errors.back() < offline_tol)
+      {
+        if (++memory == convergence_memory)
+        {
+          break;
+        }
+      }
+      else
+      {
+        memory = 0;
+      }
+      if (it == max_size || omega_star.empty())
+      {
+        break;
+      }
+
+      // Sample HDM and add solutions to basis.
+      Mpi::Print("\nGreedy iteration {:d} (n = {:d}): ω* = {:.3e} GHz ({:.3e}), error = "
+                 "{:.3e}{}\n",
+                 it - it0 + 1, prom_op.GetReducedDimension(), omega_star[0] * f0,
+                 omega_star[0], max_errors.back(),
+                 (memory == 0)
+                     ? ""
+                     : fmt::format(", memory = {:d}/{:d}", memory, convergence_memory));
+      if (omega_star.size() > 1)
+      {
+        utils::PrettyPrint(omega_star, f0, " Batch frequencies (GHz):");
+      }
+      if (use_residual)
+      {
+        SolveHDM(omega_star);
+      }
+      UpdatePROM(omega_star);
+      it += static_cast<int>(omega_star.size());
+    }
+    Mpi::Print("\nAdaptive sampling{} {:d} frequency samples:\n"
+               " n = {:d}, error = {:.3e}, tol = {:.3e}, memory = {:d}/{:d}\n",
+               (it == max_size) ? " reached maximum" : " converged with", it,
+               prom_op.GetReducedDimension(), max_errors.back(), offline_tol, memory,
+               convergence_memory);
+    utils::PrettyPrint(prom_op.GetSamplePoints(), f0, " Sampled frequencies (GHz):");
+    utils::PrettyPrint(max_errors, 1.0, " Sample errors:");
+    Mpi::Print(" Total offline phase elapsed time: {:.2e} s\n",
+               Timer::Duration(Timer::Now() - t0).count());  // Timing on root
+    if (iodata.solver.driven.adaptive_save_model && post_dir.length() > 0)
+    {
+      const std::string dir = post_dir + "prom/";
+      if (Mpi::Root(space_op.GetComm()) && !std::filesystem::exists(dir))
+      {
+        std::filesystem::create_directories(dir);
+      }
+      Mpi::Barrier(space_op.GetComm());
+      prom_op.SaveModel(dir + "prom_");
+    }
+    if (group_solver)
+    {
+      // Linear solver statistics are reported for the HDM solves of the first group.
+      BlockTimer bt0(Timer::POSTPRO);
+      SaveMetadata(group_solver->GetLinearSolver());
+    }
   }
-  Mpi::Print("\nAdaptive sampling{} {:d} frequency samples:\n"
-             " n = {:d}, error = {:.3e}, tol = {:.3e}, memory = {:d}/{:d}\n",
-             (it == max_size) ? " reached maximum" : " converged with", it,
-             prom_op.GetReducedDimension(), max_errors.back(), offline_tol, memory,
-             convergence_memory);
-  utils::PrettyPrint(prom_op.GetSamplePoints(), f0, " Sampled frequencies (GHz):");
-  utils::PrettyPrint(max_errors, 1.0, " Sample errors:");
-  Mpi::Print(" Total offline phase elapsed time: {:.2e} s\n",
-             Timer::Duration(Timer::Now() - t0).count());  // Timing on root
 
   // XX TODO: Add output of eigenvalue estimates from the PROM system (and nonlinear EVP in
   //          the general case with wave ports, etc.?)
 
-  // Main fast frequency sweep loop (online phase).
+  // Main fast frequency sweep loop (online phase). When the postprocessing configuration
+  // allows, quantities are computed directly from the PROM solution coefficients using
+  // functionals projected onto the reduced basis, and the solution is only expanded into
+  // the high-dimensional space for field output.
   Mpi::Print("\nBeginning fast frequency sweep online phase\n");
   space_op.GetWavePortOp().SetSuppressOutput(false);  // Disable output suppression
+  const bool reduced_post = [&]()
+  {
+    BlockTimer bt0(Timer::POSTPRO);
+    return post_op.SetReducedBasis(prom_op.GetReducedBasis(),
+                                   prom_op.GetReducedDimension(), Curl,
+                                   space_op.GetLumpedPortOp(), space_op.GetWavePortOp());
+  }();
+  const int delta_post = iodata.solver.driven.delta_post;
+  const auto excitations =
+      (n_exc > 1) ? space_op.GetExcitationIndices() : std::vector<int>();
+  SParameterMap S;
+  Eigen::VectorXcd y, y_sum;
   int step = step0;
   double omega = omega0;
   while (step < n_step)
@@ -351,22 +1070,71 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &space_op, PostOperator
     Mpi::Print("\nIt {:d}/{:d}: ω/2π = {:.3e} GHz (elapsed time = {:.2e} s)\n", step + 1,
                n_step, freq, Timer::Duration(Timer::Now() - t0).count());
 
-    // Assemble and solve the PROM linear system.
-    prom_op.SolvePROM(omega, E);
+    // Assemble and solve the PROM linear system. For multi-excitation sweeps, the column of
+    // the S-matrix for each excitation is computed from its solution, and the remaining
+    // postprocessing uses the sum of the solutions.
+    if (n_exc > 1)
+    {
+      y_sum.setZero(prom_op.GetReducedDimension());
+      S.clear();
+      for (int e = 0; e < n_exc; e++)
+      {
+        prom_op.SolvePROM(omega, y, e);
+        y_sum += y;
+        Mpi::Print("\n Excitation on port {:d}:\n", excitations[e]);
+
+        BlockTimer bt0(Timer::POSTPRO);
+        space_op.SetExcitationIndex(excitations[e]);
+        if (reduced_post)
+        {
+          post_op.SetReducedSolution(y, omega);
+        }
+        else
+        {
+          prom_op.ProlongatePROM(y, E);
+          Curl.Mult(E.Real(), B.Real());
+          Curl.Mult(E.Imag(), B.Imag());
+          B *= -1.0 / (1i * omega);
+          post_op.SetEGridFunction(E);
+          post_op.SetBGridFunction(B);
+        }
+        post_op.UpdatePorts(space_op.GetLumpedPortOp(), space_op.GetWavePortOp(), omega);
+        PostprocessSParameters(post_op, space_op.GetLumpedPortOp(),
+                               space_op.GetWavePortOp(), step, omega, &S);
+      }
+      space_op.SetExcitationIndex(-1);
+      y = y_sum;
+    }
+    else
+    {
+      prom_op.SolvePROM(omega, y);
+    }
     Mpi::Print("\n");
 
     // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
-    // PostOperator for all postprocessing operations.
+    // PostOperator for all postprocessing operations, unless the postprocessing can be
+    // performed in the reduced space. The basis is orthonormal, so ||E|| = ||y||.
     BlockTimer bt0(Timer::POSTPRO);
-    Curl.Mult(E.Real(), B.Real());
-    Curl.Mult(E.Imag(), B.Imag());
-    B *= -1.0 / (1i * omega);
-    post_op.SetEGridFunction(E);
-    post_op.SetBGridFunction(B);
+    double E_norm;
+    if (!reduced_post || (delta_post > 0 && step % delta_post == 0))
+    {
+      prom_op.ProlongatePROM(y, E);
+      Curl.Mult(E.Real(), B.Real());
+      Curl.Mult(E.Imag(), B.Imag());
+      B *= -1.0 / (1i * omega);
+      post_op.SetEGridFunction(E);
+      post_op.SetBGridFunction(B);
+      E_norm = linalg::Norml2(space_op.GetComm(), E);
+    }
+    else
+    {
+      post_op.SetReducedSolution(y, omega);
+      E_norm = y.norm();
+    }
     post_op.UpdatePorts(space_op.GetLumpedPortOp(), space_op.GetWavePortOp(), omega);
     const double E_elec = post_op.GetEFieldEnergy();
     const double E_mag = post_op.GetHFieldEnergy();
-    Mpi::Print(" Sol. ||E|| = {:.6e}\n", linalg::Norml2(space_op.GetComm(), E));
+    Mpi::Print(" Sol. ||E|| = {:.6e}\n", E_norm);
     {
       const double J = iodata.DimensionalizeValue(IoData::ValueType::ENERGY, 1.0);
       Mpi::Print(" Field energy E ({:.3e} J) + H ({:.3e} J) = {:.3e} J\n", E_elec * J,
@@ -376,14 +1144,18 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &space_op, PostOperator
     // Postprocess S-parameters and optionally write solution to disk.
     Postprocess(post_op, space_op.GetLumpedPortOp(), space_op.GetWavePortOp(),
                 space_op.GetSurfaceCurrentOp(), step, omega, E_elec, E_mag,
-                (step == n_step - 1) ? &indicator : nullptr);
+                (step == n_step - 1 && estimator) ? &indicator : nullptr);
+    PostprocessSMatrix(step, omega, S);
 
     // Increment frequency.
     step++;
     omega += delta_omega;
   }
   BlockTimer bt0(Timer::POSTPRO);
-  SaveMetadata(prom_op.GetLinearSolver());
+  if (!group_hdm)
+  {
+    SaveMetadata(prom_op.GetLinearSolver());
+  }
   return indicator;
 }
 
@@ -651,7 +1423,7 @@ void DrivenSolver::PostprocessPorts(const PostOperator &post_op,
 void DrivenSolver::PostprocessSParameters(const PostOperator &post_op,
                                           const LumpedPortOperator &lumped_port_op,
                                           const WavePortOperator &wave_port_op, int step,
-                                          double omega) const
+                                          double omega, SParameterMap *S) const
 {
   // Postprocess S-parameters. This computes a column of the S matrix corresponding to the
   // excited port index specified in the configuration file, storing |S_ij| and arg
@@ -724,23 +1496,37 @@ void DrivenSolver::PostprocessSParameters(const PostOperator &post_op,
     // clang-format on
   }
 
-  // Print table to file.
-  if (root && post_dir.length() > 0)
+  // Print table to file, or accumulate the column of the S-matrix.
+  SParameterMap S_j;
+  for (const auto &data : port_data)
+  {
+    (S ? *S : S_j)[{source_idx, data.idx}] = data.S_ij;
+  }
+  if (!S)
+  {
+    PostprocessSMatrix(step, omega, S_j);
+  }
+}
+
+void DrivenSolver::PostprocessSMatrix(int step, double omega, const SParameterMap &S) const
+{
+  // Write the S-parameters for all excitations, ordered by excited port index.
+  if (root && post_dir.length() > 0 && !S.empty())
   {
     std::string path = post_dir + "port-S.csv";
     auto output = OutputFile(path, (step > 0));
     if (step == 0)
     {
       output.print("{:>{}s},", "f (GHz)", table.w1);
-      for (const auto &data : port_data)
+      for (const auto &[ji, S_ij] : S)
       {
         std::string str =
-            "S[" + std::to_string(data.idx) + "][" + std::to_string(source_idx) + "]";
+            "S[" + std::to_string(ji.second) + "][" + std::to_string(ji.first) + "]";
         // clang-format off
         output.print("{:>{}s},{:>{}s}{}",
                      "|" + str + "| (dB)", table.w,
                      "arg(" + str + ") (deg.)", table.w,
-                     (data.idx == port_data.back().idx) ? "" : ",");
+                     (ji == S.rbegin()->first) ? "" : ",");
         // clang-format on
       }
       output.print("\n");
@@ -749,13 +1535,14 @@ void DrivenSolver::PostprocessSParameters(const PostOperator &post_op,
     output.print("{:{}.{}e},",
                  iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, omega),
                  table.w1, table.p1);
-    for (const auto &data : port_data)
+    // clang-format on
+    for (const auto &[ji, S_ij] : S)
     {
       // clang-format off
       output.print("{:>+{}.{}e},{:>+{}.{}e}{}",
-                   20.0 * std::log10(std::abs(data.S_ij)), table.w, table.p,
-                   std::arg(data.S_ij) * 180.0 / M_PI, table.w, table.p,
-                   (data.idx == port_data.back().idx) ? "" : ",");
+                   20.0 * std::log10(std::abs(S_ij)), table.w, table.p,
+                   std::arg(S_ij) * 180.0 / M_PI, table.w, table.p,
+                   (ji == S.rbegin()->first) ? "" : ",");
       // clang-format on
     }
     output.print("\n");
@@ -4,7 +4,10 @@
 #ifndef PALACE_DRIVERS_DRIVEN_SOLVER_HPP
 #define PALACE_DRIVERS_DRIVEN_SOLVER_HPP
 
+#include <complex>
+#include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 #include "drivers/basesolver.hpp"
 
@@ -25,12 +28,24 @@ class WavePortOperator;
 class DrivenSolver : public BaseSolver
 {
 private:
+  // S-parameters S_ij indexed by the pair (j, i) of excited port index and port index.
+  using SParameterMap = std::map<std::pair<int, int>, std::complex<double>>;
+
   int GetNumSteps(double start, double end, double delta) const;
 
+  // Sweep the frequency steps step0, step0 + step_stride, ... < n_step, where omega0 is the
+  // frequency of step0. Strided sweeps are used by the frequency groups, which postprocess
+  // the error indicators for all groups together.
   ErrorIndicator SweepUniform(SpaceOperator &space_op, PostOperator &post_op, int n_step,
-                              int step0, double omega0, double delta_omega) const;
+                              int step0, double omega0, double delta_omega,
+                              int step_stride = 1) const;
+
+  ErrorIndicator SweepUniformGroups(const std::vector<std::unique_ptr<Mesh>> &mesh,
+                                    int n_step, int step0, double omega0,
+                                    double delta_omega) const;
 
-  ErrorIndicator SweepAdaptive(SpaceOperator &space_op, PostOperator &post_op, int n_step,
+  ErrorIndicator SweepAdaptive(const std::vector<std::unique_ptr<Mesh>> &mesh,
+                               SpaceOperator &space_op, PostOperator &post_op, int n_step,
                                int step0, double omega0, double delta_omega) const;
 
   void Postprocess(const PostOperator &post_op, const LumpedPortOperator &lumped_port_op,
@@ -46,10 +61,14 @@ private:
                         const LumpedPortOperator &lumped_port_op, int step,
                         double omega) const;
 
+  // Compute the S-parameters for the single excited port. They are written to disk
+  // directly, or accumulated into S if provided for multi-excitation sweeps.
   void PostprocessSParameters(const PostOperator &post_op,
                               const LumpedPortOperator &lumped_port_op,
-                              const WavePortOperator &wave_port_op, int step,
-                              double omega) const;
+                              const WavePortOperator &wave_port_op, int step, double omega,
+                              SParameterMap *S = nullptr) const;
+
+  void PostprocessSMatrix(int step, double omega, const SParameterMap &S) const;
 
   std::pair<ErrorIndicator, long long int>
   Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const override;
@@ -3,12 +3,24 @@
 
 #include "eigensolver.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <Eigen/Dense>
 #include <mfem.hpp>
 #include "fem/errorindicator.hpp"
+#include "fem/gridfunction.hpp"
+#include "fem/interpolator.hpp"
 #include "fem/mesh.hpp"
+#include "fem/multigrid.hpp"
 #include "linalg/arpack.hpp"
 #include "linalg/divfree.hpp"
 #include "linalg/errorestimator.hpp"
+#include "linalg/krylovschur.hpp"
 #include "linalg/ksp.hpp"
 #include "linalg/operator.hpp"
 #include "linalg/slepc.hpp"
@@ -17,6 +29,8 @@
 #include "models/postoperator.hpp"
 #include "models/spaceoperator.hpp"
 #include "utils/communication.hpp"
+#include "utils/filesystem.hpp"
+#include "utils/geodata.hpp"
 #include "utils/iodata.hpp"
 #include "utils/timer.hpp"
 
@@ -25,31 +39,20 @@ namespace palace
 
 using namespace std::complex_literals;
 
-std::pair<ErrorIndicator, long long int>
-EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
+namespace
 {
-  // Construct and extract the system matrices defining the eigenvalue problem. The diagonal
-  // values for the mass matrix PEC dof shift the Dirichlet eigenvalues out of the
-  // computational range. The damping matrix may be nullptr.
-  BlockTimer bt0(Timer::CONSTRUCT);
-  SpaceOperator space_op(iodata, mesh);
-  auto K = space_op.GetStiffnessMatrix<ComplexOperator>(Operator::DIAG_ONE);
-  auto C = space_op.GetDampingMatrix<ComplexOperator>(Operator::DIAG_ZERO);
-  auto M = space_op.GetMassMatrix<ComplexOperator>(Operator::DIAG_ZERO);
-  const auto &Curl = space_op.GetCurlMatrix();
-  SaveMetadata(space_op.GetNDSpaces());
-
-  // Configure objects for postprocessing.
-  PostOperator post_op(iodata, space_op, "eigenmode");
-  ComplexVector E(Curl.Width()), B(Curl.Height());
-  E.UseDevice(true);
-  B.UseDevice(true);
 
-  // Define and configure the eigensolver to solve the eigenvalue problem:
-  //         (K + λ C + λ² M) u = 0    or    K u = -λ² M u
-  // with λ = iω. In general, the system matrices are complex and symmetric.
-  std::unique_ptr<EigenvalueSolver> eigen;
+config::EigenSolverData::Type GetEigenSolverType(const IoData &iodata)
+{
+  // The native block Krylov-Schur solver is always available, and is used by default when
+  // built without ARPACK or SLEPc. The contour integral eigensolver is implemented directly
+  // by the driver.
   config::EigenSolverData::Type type = iodata.solver.eigenmode.type;
+  if (type == config::EigenSolverData::Type::CONTOUR ||
+      type == config::EigenSolverData::Type::BLOCK_KRYLOV_SCHUR)
+  {
+    return type;
+  }
 #if defined(PALACE_WITH_ARPACK) && defined(PALACE_WITH_SLEPC)
   if (type == config::EigenSolverData::Type::DEFAULT)
   {
@@ -68,9 +71,104 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
   }
   type = config::EigenSolverData::Type::SLEPC;
 #else
-#error "Eigenmode solver requires building with ARPACK or SLEPc!"
+  if (type != config::EigenSolverData::Type::DEFAULT)
+  {
+    Mpi::Warning("ARPACK and SLEPc eigensolvers not available, using block "
+                 "Krylov-Schur!\n");
+  }
+  type = config::EigenSolverData::Type::BLOCK_KRYLOV_SCHUR;
 #endif
-  if (type == config::EigenSolverData::Type::ARPACK)
+  return type;
+}
+
+//
+// Helper class which configures the eigenvalue solver for the problem defined by a space
+// operator, using a shift-and-invert spectral transformation about the given target. The
+// system matrices and linear solver are owned by this object.
+//
+class EigenSolveContext
+{
+private:
+  SpaceOperator &space_op;
+
+  // System matrices, where the damping matrix may be nullptr, and the matrix for the
+  // eigenvector inner product.
+  std::unique_ptr<ComplexOperator> K, C, M;
+  std::unique_ptr<Operator> KM;
+
+  // Divergence-free projector, shifted operator and preconditioner matrix, and linear
+  // solver for the shift-and-invert strategy.
+  std::unique_ptr<DivFreeSolver<ComplexVector>> divfree;
+  std::unique_ptr<ComplexOperator> A, P;
+  std::unique_ptr<ComplexKspSolver> ksp;
+
+  // Eigenvalue solver.
+  config::EigenSolverData::Type type;
+  std::unique_ptr<EigenvalueSolver> eigen;
+
+public:
+  EigenSolveContext(const IoData &iodata, SpaceOperator &space_op, double target);
+
+  // Solve the eigenvalue problem and return the number of converged eigenpairs.
+  int Solve() { return eigen->Solve(); }
+
+  // Set a block of vectors as the initial space for the eigenvalue solve. The vectors are
+  // modified to satisfy the boundary conditions and projected appropriately.
+  void SetInitialSpace(std::vector<ComplexVector> &V0);
+
+  // Configure checkpointing of the eigenvalue solver state to files in the given directory,
+  // if supported by the eigenvalue solver. Warnings can be disabled for repeated calls.
+  void SetCheckpoint(const std::string &dir, int interval, bool restart, bool warn);
+
+  // Normalize the eigenvectors with respect to the mass matrix (unit electric field energy)
+  // if the basis was not computed to be orthogonal with respect to it.
+  void RescaleEigenvectors(int num_conv);
+
+  // Get the eigenvalue of the i-th eigenpair as a complex frequency ω.
+  std::complex<double> GetFrequency(int i) const
+  {
+    std::complex<double> omega = eigen->GetEigenvalue(i);
+    if (!C)
+    {
+      // Linear EVP has eigenvalue μ = -λ² = ω².
+      omega = std::sqrt(omega);
+    }
+    else
+    {
+      // Quadratic EVP solves for eigenvalue λ = iω.
+      omega /= 1i;
+    }
+    return omega;
+  }
+
+  const auto &GetEigenvalueSolver() const { return *eigen; }
+  const auto &GetLinearSolver() const { return *ksp; }
+};
+
+EigenSolveContext::EigenSolveContext(const IoData &iodata, SpaceOperator &space_op,
+                                     double target)
+  : space_op(space_op)
+{
+  // Construct and extract the system matrices defining the eigenvalue problem. The diagonal
+  // values for the mass matrix PEC dof shift the Dirichlet eigenvalues out of the
+  // computational range. The damping matrix may be nullptr.
+  K = space_op.GetStiffnessMatrix<ComplexOperator>(Operator::DIAG_ONE);
+  C = space_op.GetDampingMatrix<ComplexOperator>(Operator::DIAG_ZERO);
+  M = space_op.GetMassMatrix<ComplexOperator>(Operator::DIAG_ZERO);
+
+  // Define and configure the eigensolver to solve the eigenvalue problem:
+  //         (K + λ C + λ² M) u = 0    or    K u = -λ² M u
+  // with λ = iω. In general, the system matrices are complex and symmetric.
+  type = GetEigenSolverType(iodata);
+  if (type == config::EigenSolverData::Type::BLOCK_KRYLOV_SCHUR)
+  {
+    Mpi::Print("\nConfiguring block Krylov-Schur eigenvalue solver:\n");
+    auto ks = std::make_unique<BlockKrylovSchurSolver>(space_op.GetComm(),
+                                                       iodata.problem.verbose);
+    ks->SetBlockSize(iodata.solver.eigenmode.block_size);
+    eigen = std::move(ks);
+  }
+  else if (type == config::EigenSolverData::Type::ARPACK)
   {
 #if defined(PALACE_WITH_ARPACK)
     Mpi::Print("\nConfiguring ARPACK eigenvalue solver:\n");
@@ -139,7 +237,6 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
   // If desired, use an M-inner product for orthogonalizing the eigenvalue subspace. The
   // constructed matrix just references the real SPD part of the mass matrix (no copy is
   // performed). Boundary conditions don't need to be eliminated here.
-  std::unique_ptr<Operator> KM;
   if (iodata.solver.eigenmode.mass_orthog)
   {
     Mpi::Print(" Basis uses M-inner product\n");
@@ -153,7 +250,6 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
 
   // Construct a divergence-free projector so the eigenvalue solve is performed in the space
   // orthogonal to the zero eigenvalues of the stiffness matrix.
-  std::unique_ptr<DivFreeSolver<ComplexVector>> divfree;
   if (iodata.solver.linear.divfree_max_it > 0)
   {
     Mpi::Print(" Configuring divergence-free projection\n");
@@ -197,7 +293,6 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
 
   // Configure the shift-and-invert strategy is employed to solve for the eigenvalues
   // closest to the specified target, σ.
-  const double target = iodata.solver.eigenmode.target;
   {
     const double f_target =
         iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, target);
@@ -240,15 +335,236 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
   // (K - σ² M) or P(iσ) = (K + iσ C - σ² M) during the eigenvalue solve. The
   // preconditioner for complex linear systems is constructed from a real approximation
   // to the complex system matrix.
-  auto A = space_op.GetSystemMatrix(std::complex<double>(1.0, 0.0), 1i * target,
-                                    std::complex<double>(-target * target, 0.0), K.get(),
-                                    C.get(), M.get());
-  auto P = space_op.GetPreconditionerMatrix<ComplexOperator>(1.0, target, -target * target,
-                                                             target);
-  auto ksp = std::make_unique<ComplexKspSolver>(iodata, space_op.GetNDSpaces(),
-                                                &space_op.GetH1Spaces());
+  A = space_op.GetSystemMatrix(std::complex<double>(1.0, 0.0), 1i * target,
+                               std::complex<double>(-target * target, 0.0), K.get(),
+                               C.get(), M.get());
+  P = space_op.GetPreconditionerMatrix<ComplexOperator>(1.0, target, -target * target,
+                                                        target);
+  ksp = std::make_unique<ComplexKspSolver>(iodata, space_op.GetNDSpaces(),
+                                           &space_op.GetH1Spaces());
   ksp->SetOperators(*A, *P);
   eigen->SetLinearSolver(*ksp);
+}
+
+void EigenSolveContext::SetInitialSpace(std::vector<ComplexVector> &V0)
+{
+  for (auto &v : V0)
+  {
+    linalg::SetSubVector(v, space_op.GetNDDbcTDofLists().back(), 0.0);
+    if (divfree)
+    {
+      divfree->Mult(v);
+    }
+  }
+  eigen->SetInitialSpace(V0);
+}
+
+void EigenSolveContext::SetCheckpoint(const std::string &dir, int interval, bool restart,
+                                      bool warn)
+{
+  auto *ks = dynamic_cast<BlockKrylovSchurSolver *>(eigen.get());
+  if (!ks)
+  {
+    if (warn)
+    {
+      Mpi::Warning("Eigenvalue solver checkpointing is only supported for the block "
+                   "Krylov-Schur eigensolver!\n");
+    }
+    return;
+  }
+  if (Mpi::Root(space_op.GetComm()) && !std::filesystem::exists(dir))
+  {
+    std::filesystem::create_directories(dir);
+  }
+  Mpi::Barrier(space_op.GetComm());
+  ks->SetCheckpoint(dir + "eigen_", interval, restart, warn);
+  if (interval > 0 && warn)
+  {
+    Mpi::Print(" Checkpointing solver state every {:d} restart{}\n", interval,
+               (interval > 1) ? "s" : "");
+  }
+}
+
+void EigenSolveContext::RescaleEigenvectors(int num_conv)
+{
+  if (!KM)
+  {
+    KM = space_op.GetInnerProductMatrix(0.0, 1.0, nullptr, M.get());
+    eigen->SetBMat(*KM);
+    eigen->RescaleEigenvectors(num_conv);
+  }
+}
+
+// Pseudo-random vector field used to construct the starting block for the contour integral
+// eigensolver. The field depends only on the spatial coordinates and the seed, so its
+// projection onto the finite element space does not depend on the mesh partitioning.
+void GetContourNoise(const mfem::Vector &x, int seed, mfem::Vector &f)
+{
+  for (int d = 0; d < f.Size(); d++)
+  {
+    double s = 1.618034 * (seed + 1) + 2.718282 * (d + 1);
+    for (int i = 0; i < x.Size(); i++)
+    {
+      s += x(i) * (12.9898 + 65.4321 * i + 7.2318 * d);
+    }
+    s = 43758.5453 * std::sin(s);
+    f(d) = s - std::floor(s) - 0.5;
+  }
+}
+
+// Helper class for writing the eigenmode fields to disk on a background thread, so that
+// the field output overlaps with the postprocessing of the remaining modes. The fields are
+// written from a copy of the finest mesh and its finite element spaces on a duplicate of
+// the mesh communicator, so that the MPI communication for the output on the background
+// thread never interferes with the main thread. This requires MPI_THREAD_MULTIPLE and host
+// execution.
+class BackgroundFieldWriter
+{
+private:
+  // Copy of a parallel mesh, with the same partitioning, on another communicator.
+  class ParMeshCopy : public mfem::ParMesh
+  {
+  public:
+    ParMeshCopy(const mfem::ParMesh &mesh, MPI_Comm comm) : mfem::ParMesh(mesh)
+    {
+      MyComm = comm;
+      gtopo.SetComm(comm);
+    }
+  };
+
+  // Local grid function data for the fields of a mode to be written.
+  struct FieldData
+  {
+    int step;
+    mfem::Vector Er, Ei, Br, Bi;
+  };
+
+  MPI_Comm comm;
+  IoData iodata;
+  std::vector<std::unique_ptr<Mesh>> mesh;
+  std::unique_ptr<SpaceOperator> space_op;
+  std::unique_ptr<PostOperator> post_op;
+
+  std::thread worker;
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::deque<FieldData> queue;
+  bool done;
+
+  void Run()
+  {
+    while (true)
+    {
+      FieldData data;
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this]() { return done || !queue.empty(); });
+        if (queue.empty())
+        {
+          return;
+        }
+        data = std::move(queue.front());
+        queue.pop_front();
+      }
+      auto &E = post_op->GetEGridFunction();
+      auto &B = post_op->GetBGridFunction();
+      E.Real() = data.Er;
+      E.Imag() = data.Ei;
+      B.Real() = data.Br;
+      B.Imag() = data.Bi;
+      E.Real().ExchangeFaceNbrData();
+      E.Imag().ExchangeFaceNbrData();
+      B.Real().ExchangeFaceNbrData();
+      B.Imag().ExchangeFaceNbrData();
+      post_op->WriteFields(data.step, data.step + 1);
+    }
+  }
+
+  void Join()
+  {
+    if (worker.joinable())
+    {
+      {
+        std::lock_guard<std::mutex> lock(mtx);
+        done = true;
+      }
+      cv.notify_one();
+      worker.join();
+    }
+  }
+
+public:
+  BackgroundFieldWriter(const IoData &iodata, const mfem::ParMesh &orig_mesh)
+    : iodata(iodata), done(false)
+  {
+    // Only the finest space is required for the field output.
+    MPI_Comm_dup(orig_mesh.GetComm(), &comm);
+    this->iodata.solver.linear.mg_max_levels = 1;
+    this->iodata.solver.linear.estimator_mg = false;
+    mesh.push_back(std::make_unique<Mesh>(std::make_unique<ParMeshCopy>(orig_mesh, comm)));
+    space_op = std::make_unique<SpaceOperator>(this->iodata, mesh);
+    post_op = std::make_unique<PostOperator>(this->iodata, *space_op, "eigenmode");
+
+    // Set up the face neighbor data on the main thread, so that the background thread only
+    // communicates the grid function values.
+    post_op->GetEGridFunction().Real().ExchangeFaceNbrData();
+    post_op->GetBGridFunction().Real().ExchangeFaceNbrData();
+    worker = std::thread(&BackgroundFieldWriter::Run, this);
+  }
+
+  ~BackgroundFieldWriter()
+  {
+    Join();
+    post_op.reset();
+    space_op.reset();
+    mesh.clear();
+    MPI_Comm_free(&comm);
+  }
+
+  // Returns true if the background field output was requested at MPI initialization and
+  // is supported, otherwise the fields are written synchronously.
+  static bool Supported()
+  {
+    return Mpi::default_thread_requested == MPI_THREAD_MULTIPLE &&
+           Mpi::QueryThread() == MPI_THREAD_MULTIPLE &&
+           !mfem::Device::Allows(mfem::Backend::DEVICE_MASK);
+  }
+
+  // Queue the fields of the PostOperator grid functions for output at the given step.
+  void Write(PostOperator &orig_post_op, int step)
+  {
+    auto &E = orig_post_op.GetEGridFunction();
+    auto &B = orig_post_op.GetBGridFunction();
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      queue.push_back({step, E.Real(), E.Imag(), B.Real(), B.Imag()});
+    }
+    cv.notify_one();
+  }
+
+  // Wait for the queued output to complete, and write the mesh partitioning and (optional)
+  // error indicator.
+  void Finalize(const ErrorIndicator *indicator)
+  {
+    Join();
+    post_op->WriteFieldsFinal(indicator);
+  }
+};
+
+}  // namespace
+
+std::pair<ErrorIndicator, long long int>
+EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
+{
+  BlockTimer bt0(Timer::CONSTRUCT);
+  SpaceOperator space_op(iodata, mesh);
+  const auto &Curl = space_op.GetCurlMatrix();
+  SaveMetadata(space_op.GetNDSpaces());
+
+  // Configure objects for postprocessing.
+  PostOperator post_op(iodata, space_op, "eigenmode");
+  ComplexVector E(Curl.Width());
+  E.UseDevice(true);
 
   // Initialize structures for storing and reducing the results of error estimation.
   TimeDependentFluxErrorEstimator<ComplexVector> estimator(
@@ -257,12 +573,173 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
       iodata.solver.linear.estimator_mg);
   ErrorIndicator indicator;
 
+  // Postprocess the computed modes, where the eigenvector of mode i is returned by GetMode.
+  // The modes are processed in blocks of n modes: B is computed once for each mode of the
+  // block, and the field energies and lumped port quantities for all modes of the block
+  // are computed with a single global reduction. The error indicators are computed for the
+  // first block, with the flux recovery for all of its modes performed using block linear
+  // solves. When enabled, the fields are written to disk on a background thread.
+  auto PostprocessModes = [&](const std::vector<std::complex<double>> &omega,
+                              const std::vector<double> &error_bkwd,
+                              const std::vector<double> &error_abs, auto &&GetMode)
+  {
+    const int num_conv = static_cast<int>(omega.size());
+    const int num_block = std::max(iodata.solver.eigenmode.n, 1);
+    const int num_write = std::min(num_conv, iodata.solver.eigenmode.n_post);
+    std::unique_ptr<BackgroundFieldWriter> writer;
+    if (num_write > 0 && post_dir.length() > 0 && BackgroundFieldWriter::Supported())
+    {
+      writer = std::make_unique<BackgroundFieldWriter>(iodata, mesh.back()->Get());
+    }
+    std::vector<ComplexVector> Es, Bs;
+    for (int i0 = 0; i0 < num_conv; i0 += num_block)
+    {
+      // Compute B = -1/(iω) ∇ x E on the true dofs for each mode of the block.
+      const int nb = std::min(num_block, num_conv - i0);
+      Es.resize(nb);
+      Bs.resize(nb);
+      for (int k = 0; k < nb; k++)
+      {
+        Es[k].SetSize(Curl.Width());
+        Bs[k].SetSize(Curl.Height());
+        Es[k].UseDevice(true);
+        Bs[k].UseDevice(true);
+        GetMode(i0 + k, Es[k]);
+        Curl.Mult(Es[k].Real(), Bs[k].Real());
+        Curl.Mult(Es[k].Imag(), Bs[k].Imag());
+        Bs[k] *= -1.0 / (1i * omega[i0 + k]);
+      }
+      post_op.SetBlockSolutions(Es, Bs, space_op.GetLumpedPortOp());
+      if (i0 == 0)
+      {
+        // Calculate and record the error indicators.
+        std::vector<double> Et(nb);
+        for (int k = 0; k < nb; k++)
+        {
+          post_op.SetBlockIndex(k);
+          Et[k] = post_op.GetEFieldEnergy() + post_op.GetHFieldEnergy();
+        }
+        estimator.AddErrorIndicators(Es, Bs, Et, indicator);
+      }
+      for (int k = 0; k < nb; k++)
+      {
+        // Set the internal GridFunctions in PostOperator for all postprocessing operations,
+        // reusing the precomputed block quantities.
+        const int i = i0 + k;
+        post_op.SetEGridFunction(Es[k]);
+        post_op.SetBGridFunction(Bs[k]);
+        post_op.SetBlockIndex(k);
+        post_op.UpdatePorts(space_op.GetLumpedPortOp(), omega[i].real());
+
+        // Postprocess the mode.
+        Postprocess(post_op, space_op.GetLumpedPortOp(), i, omega[i], error_bkwd[i],
+                    error_abs[i], num_conv, post_op.GetEFieldEnergy(),
+                    post_op.GetHFieldEnergy(),
+                    (i == iodata.solver.eigenmode.n - 1) ? &indicator : nullptr, !writer);
+        if (writer && i < num_write)
+        {
+          writer->Write(post_op, i);
+        }
+      }
+    }
+    if (writer)
+    {
+      BlockTimer bt(Timer::IO);
+      writer->Finalize(&indicator);
+      Mpi::Print(" Wrote {:d} mode{} to disk\n", num_write, (num_write > 1) ? "s" : "");
+    }
+  };
+
+  // With spectrum slicing or the contour integral eigensolver, the eigenpairs are computed
+  // on groups of processes and gathered for postprocessing.
+  const bool contour =
+      (GetEigenSolverType(iodata) == config::EigenSolverData::Type::CONTOUR);
+  if (contour || iodata.solver.eigenmode.n_slices > 1)
+  {
+    std::vector<std::complex<double>> omega;
+    std::vector<double> error_bkwd, error_abs;
+    std::vector<ComplexVector> V;
+    const int num_conv =
+        contour ? SolveContour(mesh, space_op, omega, error_bkwd, error_abs, V)
+                : SolveSlices(mesh, space_op, omega, error_bkwd, error_abs, V);
+    BlockTimer bt2(Timer::POSTPRO);
+    Mpi::Print("\nComputing solution error estimates and performing postprocessing\n\n");
+    omega.resize(num_conv);
+    error_bkwd.resize(num_conv);
+    error_abs.resize(num_conv);
+    PostprocessModes(omega, error_bkwd, error_abs,
+                     [&](int i, ComplexVector &v) { v = V[i]; });
+    return {indicator, space_op.GlobalTrueVSize()};
+  }
+
+  // Configure the eigenvalue solver for the shift-and-invert strategy about the target.
+  EigenSolveContext eps(iodata, space_op, iodata.solver.eigenmode.target);
+  const auto &eigen = eps.GetEigenvalueSolver();
+
+  // With adaptive mesh refinement, the eigenvectors from the previous iteration,
+  // transferred to the refined mesh, are used as the initial space for the eigenvalue
+  // solve.
+  if (!amr_V.empty())
+  {
+    MFEM_VERIFY(amr_nd_fespace->GetTrueVSize() == space_op.GetNDSpace().GetTrueVSize(),
+                "Size mismatch for eigenvectors transferred from the previous mesh!");
+    std::vector<ComplexVector> V0(amr_V.size() / 2);
+    for (std::size_t i = 0; i < V0.size(); i++)
+    {
+      V0[i].SetSize(space_op.GetNDSpace().GetTrueVSize());
+      V0[i].UseDevice(true);
+      amr_V[2 * i]->GetTrueDofs(V0[i].Real());
+      amr_V[2 * i + 1]->GetTrueDofs(V0[i].Imag());
+    }
+    Mpi::Print(" Using {:d} eigenvector{} from the previous mesh as the initial space\n",
+               V0.size(), (V0.size() > 1) ? "s" : "");
+    eps.SetInitialSpace(V0);
+  }
+  amr_V.clear();
+  amr_nd_fespace.reset();
+  amr_nd_fec.reset();
+  if (iodata.solver.eigenmode.checkpoint_it > 0 ||
+      iodata.solver.eigenmode.checkpoint_restart)
+  {
+    // Checkpoints are written to a separate directory for each adaptive mesh refinement
+    // iteration, so that a restarted simulation replays the completed iterations from
+    // their final checkpoints rather than overwriting the state of the interrupted one.
+    // Warnings are only issued for the first solve.
+    if (post_dir.empty())
+    {
+      if (checkpoint_solve == 0)
+      {
+        Mpi::Warning("Eigenvalue solver checkpointing requires an output directory, "
+                     "checkpointing is disabled!\n");
+      }
+    }
+    else
+    {
+      const std::string dir = (iodata.model.refinement.max_it > 0)
+                                  ? fmt::format("{}checkpoint/iteration{:d}/", post_dir,
+                                                checkpoint_solve)
+                                  : post_dir + "checkpoint/";
+      eps.SetCheckpoint(dir, iodata.solver.eigenmode.checkpoint_it,
+                        iodata.solver.eigenmode.checkpoint_restart, checkpoint_solve == 0);
+    }
+    checkpoint_solve++;
+  }
+  if (iodata.model.refinement.max_it > 0 && iodata.solver.eigenmode.init_v0)
+  {
+    amr_nd_fec = std::move(fem::ConstructFECollections<mfem::ND_FECollection>(
+                               iodata.solver.order, mesh.back()->Dimension(), 1,
+                               iodata.solver.linear.mg_coarsen_type, false)
+                               .back());
+    amr_nd_fespace = std::make_unique<mfem::ParFiniteElementSpace>(&mesh.back()->Get(),
+                                                                   amr_nd_fec.get());
+  }
+
   // Eigenvalue problem solve.
   BlockTimer bt1(Timer::EPS);
   Mpi::Print("\n");
-  int num_conv = eigen->Solve();
+  int num_conv = eps.Solve();
   {
-    std::complex<double> lambda = (num_conv > 0) ? eigen->GetEigenvalue(0) : 0.0;
+    std::complex<double> lambda = (num_conv > 0) ? eigen.GetEigenvalue(0) : 0.0;
     Mpi::Print(" Found {:d} converged eigenvalue{}{}\n", num_conv,
                (num_conv > 1) ? "s" : "",
                (num_conv > 0)
@@ -270,67 +747,594 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
                    : "");
   }
   BlockTimer bt2(Timer::POSTPRO);
-  SaveMetadata(*ksp);
+  SaveMetadata(eps.GetLinearSolver());
 
   // Calculate and record the error indicators, and postprocess the results.
   Mpi::Print("\nComputing solution error estimates and performing postprocessing\n");
-  if (!KM)
-  {
-    // Normalize the finalized eigenvectors with respect to mass matrix (unit electric field
-    // energy) even if they are not computed to be orthogonal with respect to it.
-    KM = space_op.GetInnerProductMatrix(0.0, 1.0, nullptr, M.get());
-    eigen->SetBMat(*KM);
-    eigen->RescaleEigenvectors(num_conv);
-  }
+  eps.RescaleEigenvectors(num_conv);
   Mpi::Print("\n");
+  std::vector<std::complex<double>> omega(num_conv);
+  std::vector<double> error_bkwd(num_conv), error_abs(num_conv);
   for (int i = 0; i < num_conv; i++)
   {
     // Get the eigenvalue and relative error.
-    std::complex<double> omega = eigen->GetEigenvalue(i);
-    double error_bkwd = eigen->GetError(i, EigenvalueSolver::ErrorType::BACKWARD);
-    double error_abs = eigen->GetError(i, EigenvalueSolver::ErrorType::ABSOLUTE);
-    if (!C)
+    omega[i] = eps.GetFrequency(i);
+    error_bkwd[i] = eigen.GetError(i, EigenvalueSolver::ErrorType::BACKWARD);
+    error_abs[i] = eigen.GetError(i, EigenvalueSolver::ErrorType::ABSOLUTE);
+    if (amr_nd_fespace && i < iodata.solver.eigenmode.n)
     {
-      // Linear EVP has eigenvalue μ = -λ² = ω².
-      omega = std::sqrt(omega);
+      // Store the eigenvector for the next adaptive mesh refinement iteration.
+      eigen.GetEigenvector(i, E);
+      for (const auto *v : {&E.Real(), &E.Imag()})
+      {
+        amr_V.push_back(std::make_unique<mfem::ParGridFunction>(amr_nd_fespace.get()));
+        amr_V.back()->SetFromTrueDofs(*v);
+      }
     }
-    else
+  }
+  PostprocessModes(omega, error_bkwd, error_abs,
+                   [&](int i, ComplexVector &v) { eigen.GetEigenvector(i, v); });
+  return {indicator, space_op.GlobalTrueVSize()};
+}
+
+EigenSolver::~EigenSolver() = default;
+
+void EigenSolver::TransferSolution(bool mesh_replaced) const
+{
+  // The stored eigenvectors are transferred using the refinement or rebalancing operator
+  // of the finite element space, which requires an update after each mesh modification.
+  if (!amr_nd_fespace)
+  {
+    return;
+  }
+  if (mesh_replaced)
+  {
+    amr_V.clear();
+    amr_nd_fespace.reset();
+    amr_nd_fec.reset();
+    return;
+  }
+  amr_nd_fespace->Update();
+  for (auto &gf : amr_V)
+  {
+    gf->Update();
+  }
+  amr_nd_fespace->UpdatesFinished();
+}
+
+int EigenSolver::SolveSlices(const std::vector<std::unique_ptr<Mesh>> &mesh,
+                             SpaceOperator &space_op,
+                             std::vector<std::complex<double>> &omega,
+                             std::vector<double> &error_bkwd,
+                             std::vector<double> &error_abs,
+                             std::vector<ComplexVector> &V) const
+{
+  // Split the processes into contiguous groups, one for each slice of the frequency band.
+  MPI_Comm comm = space_op.GetComm();
+  const int n_slices = iodata.solver.eigenmode.n_slices;
+  MFEM_VERIFY(n_slices <= Mpi::Size(comm),
+              "Spectrum slicing requires at least one MPI process per slice!");
+  MFEM_VERIFY(iodata.model.refinement.max_it == 0,
+              "Adaptive mesh refinement is not supported with spectrum slicing!");
+  const int slice = static_cast<int>(static_cast<long long int>(Mpi::Rank(comm)) *
+                                     n_slices / Mpi::Size(comm));
+  MPI_Comm slice_comm;
+  MPI_Comm_split(comm, slice, Mpi::Rank(comm), &slice_comm);
+  std::vector<int> slices(Mpi::Size(comm));
+  MPI_Allgather(&slice, 1, MPI_INT, slices.data(), 1, MPI_INT, comm);
+
+  // Each slice solves for the eigenvalues in its interval [ω_lo, ω_hi), with the shift at
+  // the interval center (ARPACK searches above the shift, so it uses the lower end).
+  const double delta =
+      (iodata.solver.eigenmode.slice_target_upper - iodata.solver.eigenmode.target) /
+      n_slices;
+  const double omega_lo = iodata.solver.eigenmode.target + slice * delta;
+  const double omega_hi = omega_lo + delta;
+  Mpi::Print("\nConfiguring spectrum slicing with {:d} slices of width {:.3e} GHz on {:d} "
+             "processes\n",
+             n_slices, iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, delta),
+             Mpi::Size(comm));
+
+  std::vector<std::pair<int, int>> modes;
+  {
+    // Redistribute the mesh hierarchy over the processes of the slice (preserving the
+    // levels for geometric multigrid), and configure the eigenvalue solver on the new mesh.
+    BlockTimer bt0(Timer::CONSTRUCT);
+    std::vector<int> elem_map;
+    std::vector<std::unique_ptr<Mesh>> slice_mesh;
     {
-      // Quadratic EVP solves for eigenvalue λ = iω.
-      omega /= 1i;
+      std::vector<const mfem::ParMesh *> levels;
+      for (const auto &m : mesh)
+      {
+        levels.push_back(&m->Get());
+      }
+      for (auto &m : mesh::RedistributeMesh(levels, slice_comm, elem_map))
+      {
+        slice_mesh.push_back(std::make_unique<Mesh>(std::move(m)));
+      }
     }
+    SpaceOperator slice_space_op(iodata, slice_mesh);
+    const bool arpack =
+        (GetEigenSolverType(iodata) == config::EigenSolverData::Type::ARPACK);
+    EigenSolveContext eps(iodata, slice_space_op,
+                          arpack ? omega_lo : omega_lo + 0.5 * delta);
+    const auto &eigen = eps.GetEigenvalueSolver();
 
-    // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
-    // PostOperator for all postprocessing operations.
-    eigen->GetEigenvector(i, E);
-    Curl.Mult(E.Real(), B.Real());
-    Curl.Mult(E.Imag(), B.Imag());
-    B *= -1.0 / (1i * omega);
-    post_op.SetEGridFunction(E);
-    post_op.SetBGridFunction(B);
-    post_op.UpdatePorts(space_op.GetLumpedPortOp(), omega.real());
-    const double E_elec = post_op.GetEFieldEnergy();
-    const double E_mag = post_op.GetHFieldEnergy();
+    // Eigenvalue problem solve for this slice, keeping only the eigenpairs in the interval.
+    BlockTimer bt1(Timer::EPS);
+    Mpi::Print("\n");
+    const int num_conv = eps.Solve();
+    BlockTimer bt2(Timer::POSTPRO);
+    SaveMetadata(eps.GetLinearSolver());
+    eps.RescaleEigenvectors(num_conv);
+    std::vector<double> data;
+    std::vector<ComplexVector> V_slice;
+    for (int i = 0; i < num_conv; i++)
+    {
+      const std::complex<double> omega_i = eps.GetFrequency(i);
+      if (omega_i.real() < omega_lo ||
+          (omega_i.real() >= omega_hi && slice < n_slices - 1) ||
+          (omega_i.real() > omega_hi && slice == n_slices - 1))
+      {
+        continue;
+      }
+      data.insert(data.end(),
+                  {omega_i.real(), omega_i.imag(),
+                   eigen.GetError(i, EigenvalueSolver::ErrorType::BACKWARD),
+                   eigen.GetError(i, EigenvalueSolver::ErrorType::ABSOLUTE)});
+      V_slice.emplace_back(slice_space_op.GetNDSpace().GetTrueVSize());
+      V_slice.back().UseDevice(true);
+      eigen.GetEigenvector(i, V_slice.back());
+    }
+    if (num_conv > 0 && static_cast<int>(V_slice.size()) == num_conv)
+    {
+      Mpi::Warning(slice_comm,
+                   "All {:d} converged eigenvalues of spectrum slice {:d} are inside the "
+                   "slice interval, some eigenvalues may be missed (consider increasing "
+                   "\"N\" or \"Slices\")!\n",
+                   num_conv, slice + 1);
+    }
 
-    // Calculate and record the error indicators.
-    if (i < iodata.solver.eigenmode.n)
+    // Gather the eigenvalues of all slices, sort by frequency, and remove duplicates found
+    // by neighboring slices near the interval boundaries.
+    struct SliceMode
+    {
+      std::complex<double> omega;
+      double error_bkwd, error_abs;
+      int slice, idx;
+    };
+    std::vector<SliceMode> slice_modes;
     {
-      estimator.AddErrorIndicator(E, B, E_elec + E_mag, indicator);
+      int count = Mpi::Root(slice_comm) ? static_cast<int>(data.size()) : 0;
+      std::vector<int> counts(Mpi::Size(comm)), displs(Mpi::Size(comm) + 1, 0);
+      MPI_Allgather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, comm);
+      std::partial_sum(counts.begin(), counts.end(), displs.begin() + 1);
+      std::vector<double> recv(displs.back());
+      MPI_Allgatherv(data.data(), count, MPI_DOUBLE, recv.data(), counts.data(),
+                     displs.data(), MPI_DOUBLE, comm);
+      for (int s = 0; s < Mpi::Size(comm); s++)
+      {
+        for (int k = displs[s], idx = 0; k < displs[s + 1]; k += 4, idx++)
+        {
+          slice_modes.push_back({std::complex<double>(recv[k], recv[k + 1]), recv[k + 2],
+                                 recv[k + 3], slices[s], idx});
+        }
+      }
+    }
+    std::stable_sort(slice_modes.begin(), slice_modes.end(),
+                     [](const SliceMode &a, const SliceMode &b)
+                     { return a.omega.real() < b.omega.real(); });
+    const double dedup_tol = 10.0 * iodata.solver.eigenmode.tol;
+    std::vector<int> slice_counts(n_slices, 0);
+    for (const auto &mode : slice_modes)
+    {
+      if (!omega.empty() && modes.back().first != mode.slice &&
+          std::abs(mode.omega - omega.back()) <= dedup_tol * std::abs(mode.omega))
+      {
+        continue;
+      }
+      omega.push_back(mode.omega);
+      error_bkwd.push_back(mode.error_bkwd);
+      error_abs.push_back(mode.error_abs);
+      modes.emplace_back(mode.slice, mode.idx);
+      slice_counts[mode.slice]++;
+    }
+    for (int s = 0; s < n_slices; s++)
+    {
+      Mpi::Print(" Slice {:d}: found {:d} eigenvalue{} in [{:.3e}, {:.3e}] GHz\n", s + 1,
+                 slice_counts[s], (slice_counts[s] != 1) ? "s" : "",
+                 iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY,
+                                            iodata.solver.eigenmode.target + s * delta),
+                 iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY,
+                                            iodata.solver.eigenmode.target +
+                                                (s + 1) * delta));
     }
 
-    // Postprocess the mode.
-    Postprocess(post_op, space_op.GetLumpedPortOp(), i, omega, error_bkwd, error_abs,
-                num_conv, E_elec, E_mag,
-                (i == iodata.solver.eigenmode.n - 1) ? &indicator : nullptr);
+    // Transfer the eigenvectors to the original mesh.
+    fem::TransferGroupVectors(space_op.GetNDSpace(), slice_space_op.GetNDSpace(), elem_map,
+                              slices, V_slice, modes, V);
   }
-  return {indicator, space_op.GlobalTrueVSize()};
+  MPI_Comm_free(&slice_comm);
+  return static_cast<int>(modes.size());
+}
+
+int EigenSolver::SolveContour(const std::vector<std::unique_ptr<Mesh>> &mesh,
+                              SpaceOperator &space_op,
+                              std::vector<std::complex<double>> &omega,
+                              std::vector<double> &error_bkwd,
+                              std::vector<double> &error_abs,
+                              std::vector<ComplexVector> &V) const
+{
+  // The elliptical contour encloses the frequency window [ω_lo, ω_hi] on the real axis,
+  // with center c and semi-axes a and b, and is discretized with the trapezoidal rule. The
+  // filtered subspace is spanned by the moments
+  //                   S_k = 1/(2πi) ∮ ζᵏ T(z)⁻¹ Y dz,  k = 0, ..., K-1,
+  // with T(z) = K + iz C - z² M + A2(z) and ζ = (z - c) / a, for a block Y of L vectors.
+  // Reference: Sakurai and Sugiura, A projection method for generalized eigenvalue problems
+  //            using numerical integration, J. Comput. Appl. Math. (2003).
+  const auto &eigenmode = iodata.solver.eigenmode;
+  const int n_points = eigenmode.contour_n_points, n_moments = eigenmode.contour_moments;
+  const double c = 0.5 * (eigenmode.contour_target_upper + eigenmode.target);
+  const double a = 0.5 * (eigenmode.contour_target_upper - eigenmode.target);
+  const double b = eigenmode.contour_aspect_ratio * a;
+  const int n_cols =
+      (std::max((eigenmode.max_size > 0) ? eigenmode.max_size : 2 * eigenmode.n,
+                n_moments) +
+       n_moments - 1) /
+      n_moments;
+
+  // Split the processes into contiguous groups, which compute the contributions from
+  // disjoint subsets of the quadrature points.
+  MPI_Comm comm = space_op.GetComm();
+  const int n_groups = eigenmode.contour_groups;
+  MFEM_VERIFY(n_groups <= Mpi::Size(comm),
+              "Contour integral eigensolver requires at least one MPI process per group!");
+  MFEM_VERIFY(n_groups == 1 || iodata.model.refinement.max_it == 0,
+              "Adaptive mesh refinement is not supported with multiple contour integral "
+              "process groups!");
+  const int group = static_cast<int>(static_cast<long long int>(Mpi::Rank(comm)) *
+                                     n_groups / Mpi::Size(comm));
+  MPI_Comm group_comm;
+  MPI_Comm_split(comm, group, Mpi::Rank(comm), &group_comm);
+  std::vector<int> groups(Mpi::Size(comm));
+  MPI_Allgather(&group, 1, MPI_INT, groups.data(), 1, MPI_INT, comm);
+  Mpi::Print("\nConfiguring contour integral eigenvalue solver:\n");
+  Mpi::Print(" Frequency window [{:.3e}, {:.3e}] GHz, aspect ratio {:.2e}\n",
+             iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, c - a),
+             iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, c + a),
+             eigenmode.contour_aspect_ratio);
+  Mpi::Print(" {:d} quadrature points, {:d} moments, block size {:d}, {:d} process "
+             "group{}\n",
+             n_points, n_moments, n_cols, n_groups, (n_groups > 1) ? "s" : "");
+
+  std::vector<ComplexVector> S(n_moments * n_cols);
+  {
+    // With more than one group, redistribute the mesh hierarchy over the processes of each
+    // group (preserving the levels for geometric multigrid).
+    BlockTimer bt0(Timer::CONSTRUCT);
+    std::vector<int> elem_map;
+    std::vector<std::unique_ptr<Mesh>> group_mesh;
+    std::unique_ptr<SpaceOperator> group_space_op;
+    if (n_groups > 1)
+    {
+      std::vector<const mfem::ParMesh *> levels;
+      for (const auto &m : mesh)
+      {
+        levels.push_back(&m->Get());
+      }
+      for (auto &m : mesh::RedistributeMesh(levels, group_comm, elem_map))
+      {
+        group_mesh.push_back(std::make_unique<Mesh>(std::move(m)));
+      }
+      group_space_op = std::make_unique<SpaceOperator>(iodata, group_mesh);
+    }
+    SpaceOperator &op = group_space_op ? *group_space_op : space_op;
+    auto K = op.GetStiffnessMatrix<ComplexOperator>(Operator::DIAG_ONE);
+    auto C = op.GetDampingMatrix<ComplexOperator>(Operator::DIAG_ZERO);
+    auto M = op.GetMassMatrix<ComplexOperator>(Operator::DIAG_ZERO);
+    std::unique_ptr<DivFreeSolver<ComplexVector>> divfree;
+    if (iodata.solver.linear.divfree_max_it > 0)
+    {
+      constexpr int divfree_verbose = 0;
+      divfree = std::make_unique<DivFreeSolver<ComplexVector>>(
+          op.GetMaterialOp(), op.GetNDSpace(), op.GetH1Spaces(), op.GetAuxBdrTDofLists(),
+          iodata.solver.linear.divfree_tol, iodata.solver.linear.divfree_max_it,
+          divfree_verbose);
+    }
+
+    // Construct the random starting block, which is identical for all groups.
+    const int n = op.GetNDSpace().GetTrueVSize();
+    std::vector<ComplexVector> Y(n_cols);
+    {
+      GridFunction U(op.GetNDSpace(), true);
+      const int dim = op.GetNDSpace().GetParMesh().SpaceDimension();
+      for (int l = 0; l < n_cols; l++)
+      {
+        Y[l].SetSize(n);
+        Y[l].UseDevice(true);
+        mfem::VectorFunctionCoefficient fr(dim, [l](const mfem::Vector &x, mfem::Vector &f)
+                                           { GetContourNoise(x, 2 * l, f); });
+        mfem::VectorFunctionCoefficient fi(dim, [l](const mfem::Vector &x, mfem::Vector &f)
+                                           { GetContourNoise(x, 2 * l + 1, f); });
+        U.Real().ProjectCoefficient(fr);
+        U.Imag().ProjectCoefficient(fi);
+        U.Real().GetTrueDofs(Y[l].Real());
+        U.Imag().GetTrueDofs(Y[l].Imag());
+        linalg::SetSubVector(Y[l], op.GetNDDbcTDofLists().back(), 0.0);
+        if (divfree)
+        {
+          divfree->Mult(Y[l]);
+        }
+      }
+    }
+    for (auto &s : S)
+    {
+      s.SetSize(n);
+      s.UseDevice(true);
+      s = 0.0;
+    }
+
+    // Accumulate the moments from the quadrature points assigned to this group. The linear
+    // solves at each point are independent: a single linear solver is configured and only
+    // its operators are updated for each point. The preconditioner uses the complex shift
+    // z, and the extra boundary matrix A2, which is only defined for real frequencies, is
+    // evaluated at Re{z}.
+    BlockTimer bt1(Timer::EPS);
+    ComplexVector X(n);
+    X.UseDevice(true);
+    ComplexKspSolver ksp(iodata, op.GetNDSpaces(), &op.GetH1Spaces());
+    std::unique_ptr<ComplexOperator> A, A2, P;
+    for (int j = group; j < n_points; j += n_groups)
+    {
+      const double theta = 2.0 * M_PI * (j + 0.5) / n_points;
+      const std::complex<double> z(c + a * std::cos(theta), b * std::sin(theta));
+      const std::complex<double> zeta(std::cos(theta), (b / a) * std::sin(theta));
+      const std::complex<double> w =
+          std::complex<double>(-a * std::sin(theta), b * std::cos(theta)) /
+          (1i * static_cast<double>(n_points));
+      Mpi::Print(" Quadrature point {:d}/{:d}: ω = {:.3e}{:+.3e}i GHz\n", j + 1, n_points,
+                 iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, z.real()),
+                 iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, z.imag()));
+      A2 = op.GetExtraSystemMatrix<ComplexOperator>(z.real(), Operator::DIAG_ZERO);
+      A = op.GetSystemMatrix(std::complex<double>(1.0, 0.0), 1i * z, -z * z, K.get(),
+                             C.get(), M.get(), A2.get());
+      P = op.GetPreconditionerMatrix<ComplexOperator>(std::complex<double>(1.0, 0.0),
+                                                      1i * z, -z * z, z.real());
+      ksp.SetOperators(*A, *P);
+      for (int l = 0; l < n_cols; l++)
+      {
+        ksp.Mult(Y[l], X);
+        if (divfree)
+        {
+          divfree->Mult(X);
+        }
+        std::complex<double> wk = w;
+        for (int k = 0; k < n_moments; k++)
+        {
+          S[k * n_cols + l].Add(wk, X);
+          wk *= zeta;
+        }
+      }
+    }
+    SaveMetadata(ksp);
+
+    // Sum the contributions of all groups on the original mesh.
+    if (n_groups > 1)
+    {
+      std::vector<ComplexVector> S_group;
+      std::vector<std::pair<int, int>> modes(S.size());
+      for (int g = 0; g < n_groups; g++)
+      {
+        for (std::size_t i = 0; i < S.size(); i++)
+        {
+          modes[i] = {g, static_cast<int>(i)};
+        }
+        fem::TransferGroupVectors(space_op.GetNDSpace(), op.GetNDSpace(), elem_map, groups,
+                                  S, modes, (g == 0) ? V : S_group);
+        for (std::size_t i = 0; g > 0 && i < S.size(); i++)
+        {
+          V[i].Add(1.0, S_group[i]);
+        }
+      }
+      S = std::move(V);
+      V.clear();
+    }
+  }
+  MPI_Comm_free(&group_comm);
+
+  // Compute an orthonormal basis for the filtered subspace from the eigendecomposition of
+  // its Gram matrix, truncating the numerically rank-deficient directions.
+  BlockTimer bt2(Timer::EPS);
+  const int m = static_cast<int>(S.size());
+  std::vector<ComplexVector> Q;
+  {
+    Eigen::MatrixXcd G = Eigen::MatrixXcd::Zero(m, m);
+    for (int j = 0; j < m; j++)
+    {
+      for (int i = j; i < m; i++)
+      {
+        G(i, j) = linalg::LocalDot(S[j], S[i]);
+      }
+    }
+    Mpi::GlobalSum(m * m, G.data(), comm);
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXcd> eps(G);
+    const auto &sigma = eps.eigenvalues();
+    for (int i = m - 1; i >= 0 && sigma(i) > 1.0e-14 * sigma(m - 1); i--)
+    {
+      auto &q = Q.emplace_back(S[0].Size());
+      q.UseDevice(true);
+      q = 0.0;
+      for (int j = 0; j < m; j++)
+      {
+        q.Add(eps.eigenvectors()(j, i) / std::sqrt(sigma(i)), S[j]);
+      }
+    }
+  }
+  const int r = static_cast<int>(Q.size());
+  S.clear();
+  if (r == 0)
+  {
+    Mpi::Warning("Contour integral subspace is empty, no eigenvalues found!\n");
+    return 0;
+  }
+
+  // Rayleigh-Ritz projection of the eigenvalue problem onto the subspace. The frequency
+  // dependence of the extra boundary matrix A2(ω) is neglected in the projected problem,
+  // where it is evaluated at the center of the window, but is included in the residuals
+  // used to accept the computed eigenpairs.
+  auto K = space_op.GetStiffnessMatrix<ComplexOperator>(Operator::DIAG_ONE);
+  auto C = space_op.GetDampingMatrix<ComplexOperator>(Operator::DIAG_ZERO);
+  auto M = space_op.GetMassMatrix<ComplexOperator>(Operator::DIAG_ZERO);
+  auto A2 = space_op.GetExtraSystemMatrix<ComplexOperator>(c, Operator::DIAG_ZERO);
+  ComplexVector x(space_op.GetNDSpace().GetTrueVSize()), t(x.Size()), res(x.Size());
+  x.UseDevice(true);
+  t.UseDevice(true);
+  res.UseDevice(true);
+  Eigen::MatrixXcd Kr(r, r), Cr = Eigen::MatrixXcd::Zero(r, r), Mr(r, r);
+  for (int j = 0; j < r; j++)
+  {
+    K->Mult(Q[j], t);
+    if (A2)
+    {
+      A2->AddMult(Q[j], t);
+    }
+    for (int i = 0; i < r; i++)
+    {
+      Kr(i, j) = linalg::LocalDot(t, Q[i]);
+    }
+    M->Mult(Q[j], t);
+    for (int i = 0; i < r; i++)
+    {
+      Mr(i, j) = linalg::LocalDot(t, Q[i]);
+    }
+    if (C)
+    {
+      C->Mult(Q[j], t);
+      for (int i = 0; i < r; i++)
+      {
+        Cr(i, j) = linalg::LocalDot(t, Q[i]);
+      }
+    }
+  }
+  Mpi::GlobalSum(r * r, Kr.data(), comm);
+  Mpi::GlobalSum(r * r, Mr.data(), comm);
+  Mpi::GlobalSum(r * r, Cr.data(), comm);
+
+  // Solve the reduced eigenvalue problem, linearized for the quadratic case with
+  // eigenvalue λ = iω.
+  Eigen::VectorXcd lambda;
+  Eigen::MatrixXcd Z;
+  {
+    const auto Minv = Mr.partialPivLu();
+    if (!C)
+    {
+      Eigen::ComplexEigenSolver<Eigen::MatrixXcd> eps(Minv.solve(Kr));
+      lambda = eps.eigenvalues().cwiseSqrt();
+      Z = eps.eigenvectors();
+    }
+    else
+    {
+      Eigen::MatrixXcd L = Eigen::MatrixXcd::Zero(2 * r, 2 * r);
+      L.topRightCorner(r, r).setIdentity();
+      L.bottomLeftCorner(r, r) = -Minv.solve(Kr);
+      L.bottomRightCorner(r, r) = -Minv.solve(Cr);
+      Eigen::ComplexEigenSolver<Eigen::MatrixXcd> eps(L);
+      lambda = eps.eigenvalues() / 1i;
+      Z = eps.eigenvectors().topRows(r);
+    }
+  }
+
+  // Compute the eigenvectors and errors for the Ritz values inside the contour, keeping
+  // only those which satisfy the eigensolver tolerance.
+  const double normK = linalg::SpectralNorm(comm, *K, K->IsReal());
+  const double normC = C ? linalg::SpectralNorm(comm, *C, C->IsReal()) : 0.0;
+  const double normM = linalg::SpectralNorm(comm, *M, M->IsReal());
+  auto KM = space_op.GetInnerProductMatrix(0.0, 1.0, nullptr, M.get());
+  std::vector<ComplexVector> X;
+  int n_rejected = 0;
+  for (int i = 0; i < lambda.size(); i++)
+  {
+    const std::complex<double> omega_i = lambda(i);
+    if (std::pow((omega_i.real() - c) / a, 2) + std::pow(omega_i.imag() / b, 2) >= 1.0)
+    {
+      continue;
+    }
+    x = 0.0;
+    for (int j = 0; j < r; j++)
+    {
+      x.Add(Z(j, i), Q[j]);
+    }
+    linalg::Normalize(comm, x);
+    K->Mult(x, res);
+    M->Mult(x, t);
+    res.Add(-omega_i * omega_i, t);
+    if (C)
+    {
+      C->Mult(x, t);
+      res.Add(1i * omega_i, t);
+    }
+    if (A2)
+    {
+      A2 = space_op.GetExtraSystemMatrix<ComplexOperator>(omega_i.real(),
+                                                          Operator::DIAG_ZERO);
+      A2->AddMult(x, res);
+    }
+    const double err_abs = linalg::Norml2(comm, res);
+    const double err_bkwd =
+        err_abs / (normK + std::abs(omega_i) * normC + std::norm(omega_i) * normM);
+    if (err_bkwd > eigenmode.tol)
+    {
+      n_rejected++;
+      continue;
+    }
+    linalg::Normalize(comm, x, *KM, t);
+    omega.push_back(omega_i);
+    error_bkwd.push_back(err_bkwd);
+    error_abs.push_back(err_abs);
+    X.push_back(x);
+  }
+  std::vector<int> perm(omega.size());
+  std::iota(perm.begin(), perm.end(), 0);
+  std::sort(perm.begin(), perm.end(),
+            [&omega](int i, int j) { return omega[i].real() < omega[j].real(); });
+  {
+    auto omega_unsorted = std::move(omega);
+    auto error_bkwd_unsorted = std::move(error_bkwd);
+    auto error_abs_unsorted = std::move(error_abs);
+    omega.clear();
+    error_bkwd.clear();
+    error_abs.clear();
+    for (const auto i : perm)
+    {
+      omega.push_back(omega_unsorted[i]);
+      error_bkwd.push_back(error_bkwd_unsorted[i]);
+      error_abs.push_back(error_abs_unsorted[i]);
+      V.push_back(std::move(X[i]));
+    }
+  }
+  const int num_conv = static_cast<int>(omega.size());
+  Mpi::Print(" Found {:d} converged eigenvalue{} inside the contour (subspace dimension "
+             "{:d})\n",
+             num_conv, (num_conv != 1) ? "s" : "", r);
+  if (n_rejected > 0)
+  {
+    Mpi::Warning("{:d} eigenvalue{} inside the contour did not satisfy the tolerance "
+                 "(consider increasing \"ContourNPoints\")!\n",
+                 n_rejected, (n_rejected > 1) ? "s" : "");
+  }
+  if (r == n_moments * n_cols)
+  {
+    Mpi::Warning("Contour integral subspace has full rank, some eigenvalues may be missed "
+                 "(consider increasing \"MaxSize\" or \"ContourMoments\")!\n");
+  }
+  return num_conv;
 }
 
 void EigenSolver::Postprocess(const PostOperator &post_op,
                               const LumpedPortOperator &lumped_port_op, int i,
                               std::complex<double> omega, double error_bkwd,
                               double error_abs, int num_conv, double E_elec, double E_mag,
-                              const ErrorIndicator *indicator) const
+                              const ErrorIndicator *indicator, bool fields) const
 {
   // The internal GridFunctions for PostOperator have already been set from the E and B
   // solutions in the main loop over converged eigenvalues.
@@ -342,14 +1346,15 @@ void EigenSolver::Postprocess(const PostOperator &post_op,
   PostprocessDomains(post_op, "m", i, i + 1, E_elec, E_mag, E_cap, E_ind);
   PostprocessSurfaces(post_op, "m", i, i + 1, E_elec + E_cap, E_mag + E_ind);
   PostprocessProbes(post_op, "m", i, i + 1);
-  if (i < iodata.solver.eigenmode.n_post)
+  if (fields && i < iodata.solver.eigenmode.n_post)
   {
     PostprocessFields(post_op, i, i + 1);
     Mpi::Print(" Wrote mode {:d} to disk\n", i + 1);
   }
   if (indicator)
   {
-    PostprocessErrorIndicator(post_op, *indicator, iodata.solver.eigenmode.n_post > 0);
+    PostprocessErrorIndicator(post_op, *indicator,
+                              fields && iodata.solver.eigenmode.n_post > 0);
   }
 }
 
@@ -9,13 +9,24 @@
 #include <vector>
 #include "drivers/basesolver.hpp"
 
+namespace mfem
+{
+
+class FiniteElementCollection;
+class ParFiniteElementSpace;
+class ParGridFunction;
+
+}  // namespace mfem
+
 namespace palace
 {
 
+class ComplexVector;
 class ErrorIndicator;
 class LumpedPortOperator;
 class Mesh;
 class PostOperator;
+class SpaceOperator;
 
 //
 // Driver class for eigenmode simulations.
@@ -23,10 +34,23 @@ class PostOperator;
 class EigenSolver : public BaseSolver
 {
 private:
+  // Eigenvectors from the previous adaptive mesh refinement iteration, stored as grid
+  // functions (real and imaginary parts) on the finest mesh which are updated along with
+  // it, used to construct the initial space for the eigenvalue solve on the refined mesh.
+  mutable std::unique_ptr<mfem::FiniteElementCollection> amr_nd_fec;
+  mutable std::unique_ptr<mfem::ParFiniteElementSpace> amr_nd_fespace;
+  mutable std::vector<std::unique_ptr<mfem::ParGridFunction>> amr_V;
+
+  // Number of eigenvalue solves which have configured checkpointing, used to separate the
+  // checkpoints of each adaptive mesh refinement iteration.
+  mutable int checkpoint_solve = 0;
+
+  // Postprocess mode i. The fields are not written to disk when fields is false (when they
+  // are written separately in the background).
   void Postprocess(const PostOperator &post_op, const LumpedPortOperator &lumped_port_op,
                    int i, std::complex<double> omega, double error_bkwd, double error_abs,
                    int num_conv, double E_elec, double E_mag,
-                   const ErrorIndicator *indicator) const;
+                   const ErrorIndicator *indicator, bool fields) const;
 
   void PostprocessEigen(int i, std::complex<double> omega, double error_bkwd,
                         double error_abs, int num_conv) const;
@@ -37,11 +61,32 @@ private:
   void PostprocessEPR(const PostOperator &post_op, const LumpedPortOperator &lumped_port_op,
                       int i, std::complex<double> omega, double E_m) const;
 
+  // Solve for the eigenpairs using spectrum slicing, where the slices of the frequency band
+  // are solved concurrently on disjoint groups of processes. The merged eigenpairs are
+  // returned sorted by frequency, with eigenvectors on the space of the given operator,
+  // which is constructed on the given mesh hierarchy.
+  int SolveSlices(const std::vector<std::unique_ptr<Mesh>> &mesh, SpaceOperator &space_op,
+                  std::vector<std::complex<double>> &omega, std::vector<double> &error_bkwd,
+                  std::vector<double> &error_abs, std::vector<ComplexVector> &V) const;
+
+  // Solve for the eigenpairs with frequencies in a window on the real axis using a contour
+  // integral method, where the linear solves at the quadrature points are distributed over
+  // disjoint groups of processes. The eigenpairs are returned sorted by frequency, with
+  // eigenvectors on the space of the given operator, which is constructed on the given
+  // mesh hierarchy.
+  int SolveContour(const std::vector<std::unique_ptr<Mesh>> &mesh, SpaceOperator &space_op,
+                   std::vector<std::complex<double>> &omega,
+                   std::vector<double> &error_bkwd, std::vector<double> &error_abs,
+                   std::vector<ComplexVector> &V) const;
+
   std::pair<ErrorIndicator, long long int>
   Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const override;
 
+  void TransferSolution(bool mesh_replaced) const override;
+
 public:
   using BaseSolver::BaseSolver;
+  ~EigenSolver() override;
 };
 
 }  // namespace palace
@@ -4,6 +4,8 @@
 #include "interpolator.hpp"
 
 #include <algorithm>
+#include <numeric>
+#include "fem/fespace.hpp"
 #include "fem/gridfunction.hpp"
 #include "utils/communication.hpp"
 #include "utils/iodata.hpp"
@@ -298,6 +300,141 @@ void InterpolateFunction(const mfem::Vector &xyz, const mfem::GridFunction &U,
 #endif
 }
 
+void TransferGroupVectors(FiniteElementSpace &fespace, FiniteElementSpace &group_fespace,
+                          const std::vector<int> &elem_map, const std::vector<int> &groups,
+                          const std::vector<ComplexVector> &V_group,
+                          const std::vector<std::pair<int, int>> &idx,
+                          std::vector<ComplexVector> &V)
+{
+  // The element-local coefficients, in the reference element orientation, are sent from
+  // each group process to the process owning the element in the original mesh.
+  MPI_Comm comm = fespace.GetComm();
+  const int size = Mpi::Size(comm), rank = Mpi::Rank(comm), group = groups[rank];
+
+  // Each process of the full mesh owns a contiguous range of elements in the global
+  // ordering.
+  std::vector<int> elem_offsets(size + 1, 0);
+  {
+    const int ne = fespace.GetParMesh().GetNE();
+    MPI_Allgather(&ne, 1, MPI_INT, elem_offsets.data() + 1, 1, MPI_INT, comm);
+    std::partial_sum(elem_offsets.begin(), elem_offsets.end(), elem_offsets.begin());
+  }
+
+  // Exchange the global indices of the elements to be communicated. The elements are
+  // sent in increasing order of their global index, so that elements for each destination
+  // process are contiguous.
+  std::vector<int> order(elem_map.size()), send_elems(elem_map.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&elem_map](int a, int b) { return elem_map[a] < elem_map[b]; });
+  std::vector<int> send_elem_counts(size, 0), send_elem_displs(size + 1, 0);
+  std::vector<int> send_counts(size, 0), recv_counts(size, 0);
+  mfem::Array<int> vdofs;
+  mfem::DofTransformation dof_trans;
+  for (std::size_t k = 0; k < order.size(); k++)
+  {
+    send_elems[k] = elem_map[order[k]];
+    const auto it =
+        std::upper_bound(elem_offsets.begin(), elem_offsets.end(), send_elems[k]);
+    const int dest = static_cast<int>(it - elem_offsets.begin()) - 1;
+    group_fespace.Get().GetElementVDofs(order[k], vdofs, dof_trans);
+    send_elem_counts[dest]++;
+    send_counts[dest] += 2 * vdofs.Size();
+  }
+  std::partial_sum(send_elem_counts.begin(), send_elem_counts.end(),
+                   send_elem_displs.begin() + 1);
+  std::vector<int> recv_elem_counts(size), recv_elem_displs(size + 1, 0);
+  MPI_Alltoall(send_elem_counts.data(), 1, MPI_INT, recv_elem_counts.data(), 1, MPI_INT,
+               comm);
+  std::partial_sum(recv_elem_counts.begin(), recv_elem_counts.end(),
+                   recv_elem_displs.begin() + 1);
+  std::vector<int> recv_elems(recv_elem_displs.back());
+  MPI_Alltoallv(send_elems.data(), send_elem_counts.data(), send_elem_displs.data(),
+                MPI_INT, recv_elems.data(), recv_elem_counts.data(),
+                recv_elem_displs.data(), MPI_INT, comm);
+  for (int s = 0; s < size; s++)
+  {
+    for (int k = recv_elem_displs[s]; k < recv_elem_displs[s + 1]; k++)
+    {
+      fespace.Get().GetElementVDofs(recv_elems[k] - elem_offsets[rank], vdofs,
+                                       dof_trans);
+      recv_counts[s] += 2 * vdofs.Size();
+    }
+  }
+
+  // Communicate the element coefficients for each vector, only the processes of the
+  // group which computed it send data.
+  GridFunction U(fespace, true), U_group(group_fespace, true);
+  std::vector<int> sendcounts(size), recvcounts(size), sdispls(size + 1, 0),
+      rdispls(size + 1, 0);
+  std::vector<double> send, recv;
+  mfem::Vector vals;
+  V.resize(idx.size());
+  for (std::size_t m = 0; m < idx.size(); m++)
+  {
+    const auto [g, j] = idx[m];
+    for (int s = 0; s < size; s++)
+    {
+      sendcounts[s] = (group == g) ? send_counts[s] : 0;
+      recvcounts[s] = (groups[s] == g) ? recv_counts[s] : 0;
+    }
+    std::partial_sum(sendcounts.begin(), sendcounts.end(), sdispls.begin() + 1);
+    std::partial_sum(recvcounts.begin(), recvcounts.end(), rdispls.begin() + 1);
+    send.resize(sdispls.back());
+    recv.resize(rdispls.back());
+    if (group == g)
+    {
+      U_group.Real().SetFromTrueDofs(V_group[j].Real());
+      U_group.Imag().SetFromTrueDofs(V_group[j].Imag());
+      auto *buff = send.data();
+      for (const auto e : order)
+      {
+        group_fespace.Get().GetElementVDofs(e, vdofs, dof_trans);
+        for (auto *gf : {&U_group.Real(), &U_group.Imag()})
+        {
+          gf->GetSubVector(vdofs, vals);
+          if (dof_trans.GetDofTransformation())
+          {
+            dof_trans.InvTransformPrimal(vals);
+          }
+          std::copy_n(vals.HostRead(), vals.Size(), buff);
+          buff += vals.Size();
+        }
+      }
+    }
+    MPI_Alltoallv(send.data(), sendcounts.data(), sdispls.data(), MPI_DOUBLE, recv.data(),
+                  recvcounts.data(), rdispls.data(), MPI_DOUBLE, comm);
+    const auto *buff = recv.data();
+    for (int s = 0; s < size; s++)
+    {
+      if (groups[s] != g)
+      {
+        continue;
+      }
+      for (int k = recv_elem_displs[s]; k < recv_elem_displs[s + 1]; k++)
+      {
+        fespace.Get().GetElementVDofs(recv_elems[k] - elem_offsets[rank], vdofs,
+                                         dof_trans);
+        for (auto *gf : {&U.Real(), &U.Imag()})
+        {
+          vals.SetSize(vdofs.Size());
+          std::copy_n(buff, vals.Size(), vals.HostWrite());
+          buff += vals.Size();
+          if (dof_trans.GetDofTransformation())
+          {
+            dof_trans.TransformPrimal(vals);
+          }
+          gf->SetSubVector(vdofs, vals);
+        }
+      }
+    }
+    V[m].SetSize(fespace.GetTrueVSize());
+    V[m].UseDevice(true);
+    U.Real().GetTrueDofs(V[m].Real());
+    U.Imag().GetTrueDofs(V[m].Imag());
+  }
+}
+
 }  // namespace fem
 
 }  // namespace palace
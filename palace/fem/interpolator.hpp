@@ -5,12 +5,15 @@
 #define PALACE_FEM_INTERPOLATOR_HPP
 
 #include <complex>
+#include <utility>
 #include <vector>
 #include <mfem.hpp>
+#include "linalg/vector.hpp"
 
 namespace palace
 {
 
+class FiniteElementSpace;
 class GridFunction;
 class IoData;
 
@@ -48,6 +51,18 @@ void InterpolateFunction(const mfem::Vector &xyz, const mfem::GridFunction &U,
                          mfem::Vector &V,
                          mfem::Ordering::Type ordering = mfem::Ordering::byNODES);
 
+// Transfer vectors of true dofs computed on disjoint groups of processes, each with a copy
+// of the mesh redistributed by mesh::RedistributeMesh, to the finite element space on the
+// original mesh. The group of each process of the original mesh communicator is given by
+// groups, and elem_map is the element map returned by mesh::RedistributeMesh (not
+// necessarily increasing). Each vector to be transferred is identified by its group and
+// index into V_group on the processes of that group.
+void TransferGroupVectors(FiniteElementSpace &fespace, FiniteElementSpace &group_fespace,
+                          const std::vector<int> &elem_map, const std::vector<int> &groups,
+                          const std::vector<ComplexVector> &V_group,
+                          const std::vector<std::pair<int, int>> &idx,
+                          std::vector<ComplexVector> &V);
+
 }  // namespace fem
 
 }  // namespace palace
@@ -585,13 +585,11 @@ void ArpackEPSSolver::ApplyOp(const std::complex<double> *px,
   {
     opK->Mult(x1, z1);
     opInv->Mult(z1, y1);
-    y1 *= 1.0 / gamma;
   }
   else
   {
     opM->Mult(x1, z1);
     opInv->Mult(z1, y1);
-    y1 *= gamma;
   }
   if (opProj)
   {
@@ -599,7 +597,7 @@ void ArpackEPSSolver::ApplyOp(const std::complex<double> *px,
     opProj->Mult(y1);
     // Mpi::Print(" After projection: {:e}\n", linalg::Norml2(comm, y1));
   }
-  y1.Get(py, n, false);
+  y1.Get(py, n, false, sinvert ? gamma : 1.0 / gamma);  // Scaling fused with copy
 }
 
 void ArpackEPSSolver::ApplyOpB(const std::complex<double> *px,
@@ -609,8 +607,7 @@ void ArpackEPSSolver::ApplyOpB(const std::complex<double> *px,
   x1.Set(px, n, false);
   opB->Mult(x1.Real(), y1.Real());
   opB->Mult(x1.Imag(), y1.Imag());
-  y1 *= delta * gamma;
-  y1.Get(py, n, false);
+  y1.Get(py, n, false, delta * gamma);
 }
 
 double ArpackEPSSolver::GetResidualNorm(std::complex<double> l, const ComplexVector &x,
@@ -758,24 +755,25 @@ void ArpackPEPSolver::ApplyOp(const std::complex<double> *px,
   x2.Set(px + n, n, false);
   if (!sinvert)
   {
-    y1 = x2;
-    if (opProj)
-    {
-      // Mpi::Print(" Before projection: {:e}\n", linalg::Norml2(comm, y1));
-      opProj->Mult(y1);
-      // Mpi::Print(" Before projection: {:e}\n", linalg::Norml2(comm, y1));
-    }
-
     opK->Mult(x1, z1);
     opC->AddMult(x2, z1, std::complex<double>(gamma, 0.0));
     opInv->Mult(z1, y2);
-    y2 *= -1.0 / (gamma * gamma);
     if (opProj)
     {
       // Mpi::Print(" Before projection: {:e}\n", linalg::Norml2(comm, y2));
       opProj->Mult(y2);
       // Mpi::Print(" Before projection: {:e}\n", linalg::Norml2(comm, y2));
     }
+
+    // The first block is the (projected) input x2, which is copied out directly rather than
+    // through y1.
+    if (opProj)
+    {
+      opProj->Mult(x2);
+    }
+    x2.Get(py, n, false);
+    y2.Get(py + n, n, false, -1.0 / (gamma * gamma));
+    return;
   }
   else
   {
@@ -813,10 +811,8 @@ void ArpackPEPSolver::ApplyOpB(const std::complex<double> *px,
   opB->Mult(x1.Imag(), y1.Imag());
   opB->Mult(x2.Real(), y2.Real());
   opB->Mult(x2.Imag(), y2.Imag());
-  y1 *= delta * gamma * gamma;
-  y2 *= delta * gamma * gamma;
-  y1.Get(py, n, false);
-  y2.Get(py + n, n, false);
+  y1.Get(py, n, false, delta * gamma * gamma);
+  y2.Get(py + n, n, false, delta * gamma * gamma);
 }
 
 double ArpackPEPSolver::GetResidualNorm(std::complex<double> l, const ComplexVector &x,
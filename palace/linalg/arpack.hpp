@@ -155,6 +155,7 @@ public:
   void SetShiftInvert(std::complex<double> s, bool precond = false) override;
 
   // Set an initial vector for the solution subspace.
+  using EigenvalueSolver::SetInitialSpace;
   void SetInitialSpace(const ComplexVector &v) override;
 
   // Solve the eigenvalue problem. Returns the number of converged eigenvalues.
@@ -5,6 +5,8 @@
 
 #include <mfem.hpp>
 #include "linalg/chebyshev.hpp"
+#include "linalg/gaussseidel.hpp"
+#include "linalg/gmrespoly.hpp"
 #include "linalg/rap.hpp"
 
 namespace palace
@@ -13,12 +15,20 @@ namespace palace
 template <typename OperType>
 DistRelaxationSmoother<OperType>::DistRelaxationSmoother(
     MPI_Comm comm, const Operator &G, int smooth_it, int cheby_smooth_it, int cheby_order,
-    double cheby_sf_max, double cheby_sf_min, bool cheby_4th_kind)
+    double cheby_sf_max, double cheby_sf_min, bool cheby_4th_kind, bool gs_smooth,
+    bool gmres_poly_smooth)
   : Solver<OperType>(), pc_it(smooth_it), G(&G), A(nullptr), A_G(nullptr),
     dbc_tdof_list_G(nullptr)
 {
   // Initialize smoothers.
-  if (cheby_4th_kind)
+  if (gmres_poly_smooth)
+  {
+    B = std::make_unique<GmresPolynomialSmoother<OperType>>(comm, cheby_smooth_it,
+                                                            cheby_order);
+    B_G = std::make_unique<GmresPolynomialSmoother<OperType>>(comm, cheby_smooth_it,
+                                                              cheby_order);
+  }
+  else if (cheby_4th_kind)
   {
     B = std::make_unique<ChebyshevSmoother<OperType>>(comm, cheby_smooth_it, cheby_order,
                                                       cheby_sf_max);
@@ -32,6 +42,15 @@ DistRelaxationSmoother<OperType>::DistRelaxationSmoother(
     B_G = std::make_unique<ChebyshevSmoother1stKind<OperType>>(
         comm, cheby_smooth_it, cheby_order, cheby_sf_max, cheby_sf_min);
   }
+  if (gs_smooth)
+  {
+    // Symmetric Gauss-Seidel for the primary and auxiliary space operators when assembled,
+    // otherwise the Chebyshev smoothers are used.
+    B = std::make_unique<GaussSeidelSmoother<OperType>>(comm, cheby_smooth_it,
+                                                        std::move(B));
+    B_G = std::make_unique<GaussSeidelSmoother<OperType>>(comm, cheby_smooth_it,
+                                                          std::move(B_G));
+  }
   B_G->SetInitialGuess(false);
 }
 
@@ -5,6 +5,7 @@
 #define PALACE_LINALG_EPS_HPP
 
 #include <complex>
+#include <vector>
 #include "linalg/ksp.hpp"
 #include "linalg/operator.hpp"
 #include "linalg/vector.hpp"
@@ -95,6 +96,21 @@ public:
   // Set an initial vector for the solution subspace.
   virtual void SetInitialSpace(const ComplexVector &v) = 0;
 
+  // Set a block of initial vectors for the solution subspace. By default, for solvers which
+  // only accept a single initial vector, the sum of the given vectors is used.
+  virtual void SetInitialSpace(const std::vector<ComplexVector> &V)
+  {
+    MFEM_VERIFY(!V.empty(), "Invalid empty initial space for eigenvalue solver!");
+    ComplexVector v(V[0].Size());
+    v.UseDevice(true);
+    v = V[0];
+    for (std::size_t i = 1; i < V.size(); i++)
+    {
+      v.Add(1.0, V[i]);
+    }
+    SetInitialSpace(v);
+  }
+
   // Solve the eigenvalue problem. Returns the number of converged eigenvalues.
   virtual int Solve() = 0;
 
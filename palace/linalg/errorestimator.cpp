@@ -156,20 +156,35 @@ void FluxProjector<VecType>::Mult(const VecType &x, VecType &y) const
   ksp->Mult(rhs, y);
 }
 
+template <typename VecType>
+void FluxProjector<VecType>::ArrayMult(const std::vector<VecType> &x,
+                                       std::vector<VecType> &y) const
+{
+  BlockTimer bt(Timer::SOLVE_ESTIMATOR);
+  MFEM_ASSERT(x.size() == y.size(),
+              "Mismatch in number of vectors for FluxProjector::ArrayMult!");
+  rhs_blk.resize(x.size());
+  for (std::size_t i = 0; i < x.size(); i++)
+  {
+    MFEM_ASSERT(x[i].Size() == Flux->Width() && y[i].Size() == rhs.Size(),
+                "Invalid vector dimensions for FluxProjector::ArrayMult!");
+    rhs_blk[i].SetSize(rhs.Size());
+    rhs_blk[i].UseDevice(true);
+    Flux->Mult(x[i], rhs_blk[i]);
+  }
+  ksp->ArrayMult(rhs_blk, y);
+}
+
 namespace
 {
 
 template <typename VecType>
-Vector ComputeErrorEstimates(const VecType &F, VecType &F_gf, VecType &G, VecType &G_gf,
-                             const FiniteElementSpace &fespace,
-                             const FiniteElementSpace &smooth_fespace,
-                             const FluxProjector<VecType> &projector,
-                             const ceed::Operator &integ_op)
+Vector IntegrateErrorEstimates(const VecType &F, VecType &F_gf, const VecType &G,
+                               VecType &G_gf, const FiniteElementSpace &fespace,
+                               const FiniteElementSpace &smooth_fespace,
+                               const ceed::Operator &integ_op)
 {
-  // Compute the projection of the discontinuous flux onto the smooth finite element space
-  // (recovery) and populate the corresponding grid functions.
-  BlockTimer bt(Timer::ESTIMATION);
-  projector.Mult(F, G);
+  // Populate the grid functions for the discontinuous flux and its smooth recovery.
   if constexpr (std::is_same<VecType, ComplexVector>::value)
   {
     fespace.GetProlongationMatrix()->Mult(F.Real(), F_gf.Real());
@@ -247,6 +262,47 @@ Vector ComputeErrorEstimates(const VecType &F, VecType &F_gf, VecType &G, VecTyp
   return estimates;
 }
 
+template <typename VecType>
+Vector ComputeErrorEstimates(const VecType &F, VecType &F_gf, VecType &G, VecType &G_gf,
+                             const FiniteElementSpace &fespace,
+                             const FiniteElementSpace &smooth_fespace,
+                             const FluxProjector<VecType> &projector,
+                             const ceed::Operator &integ_op)
+{
+  // Compute the projection of the discontinuous flux onto the smooth finite element space
+  // (recovery), then integrate the error.
+  BlockTimer bt(Timer::ESTIMATION);
+  projector.Mult(F, G);
+  return IntegrateErrorEstimates(F, F_gf, G, G_gf, fespace, smooth_fespace, integ_op);
+}
+
+template <typename VecType>
+std::vector<Vector> ComputeErrorEstimates(const std::vector<VecType> &F, VecType &F_gf,
+                                          VecType &G_gf, const FiniteElementSpace &fespace,
+                                          const FiniteElementSpace &smooth_fespace,
+                                          const FluxProjector<VecType> &projector,
+                                          const ceed::Operator &integ_op)
+{
+  // Block version: the projections for all fluxes are computed together, and the errors
+  // are then integrated one flux at a time.
+  BlockTimer bt(Timer::ESTIMATION);
+  std::vector<VecType> G(F.size());
+  for (auto &g : G)
+  {
+    g.SetSize(smooth_fespace.GetTrueVSize());
+    g.UseDevice(true);
+  }
+  projector.ArrayMult(F, G);
+  std::vector<Vector> estimates;
+  estimates.reserve(F.size());
+  for (std::size_t i = 0; i < F.size(); i++)
+  {
+    estimates.push_back(
+        IntegrateErrorEstimates(F[i], F_gf, G[i], G_gf, fespace, smooth_fespace, integ_op));
+  }
+  return estimates;
+}
+
 }  // namespace
 
 template <typename VecType>
@@ -511,6 +567,28 @@ void TimeDependentFluxErrorEstimator<VecType>::AddErrorIndicator(
   indicator.AddIndicator(grad_estimates);
 }
 
+template <typename VecType>
+void TimeDependentFluxErrorEstimator<VecType>::AddErrorIndicators(
+    const std::vector<VecType> &E, const std::vector<VecType> &B,
+    const std::vector<double> &Et, ErrorIndicator &indicator) const
+{
+  MFEM_VERIFY(E.size() == B.size() && E.size() == Et.size(),
+              "Mismatch in number of solutions for error estimation!");
+  auto grad_estimates = ComputeErrorEstimates(
+      E, grad_estimator.E_gf, grad_estimator.D_gf, grad_estimator.nd_fespace,
+      grad_estimator.rt_fespace, grad_estimator.projector, grad_estimator.integ_op);
+  auto curl_estimates = ComputeErrorEstimates(
+      B, curl_estimator.B_gf, curl_estimator.H_gf, curl_estimator.rt_fespace,
+      curl_estimator.nd_fespace, curl_estimator.projector, curl_estimator.integ_op);
+  for (std::size_t i = 0; i < E.size(); i++)
+  {
+    grad_estimates[i] += curl_estimates[i];  // Sum of squares
+    linalg::Sqrt(grad_estimates[i],
+                 (Et[i] > 0.0) ? 0.5 / Et[i] : 1.0);  // Correct factor of 1/2 in energy
+    indicator.AddIndicator(grad_estimates[i]);
+  }
+}
+
 template class FluxProjector<Vector>;
 template class FluxProjector<ComplexVector>;
 template class GradFluxErrorEstimator<Vector>;
@@ -5,6 +5,7 @@
 #define PALACE_LINALG_ERROR_ESTIMATOR_HPP
 
 #include <memory>
+#include <vector>
 #include <mfem.hpp>
 #include "fem/errorindicator.hpp"
 #include "fem/fespace.hpp"
@@ -43,8 +44,9 @@ private:
   // Linear solver and preconditioner for the projected linear system.
   std::unique_ptr<BaseKspSolver<OperType>> ksp;
 
-  // Workspace object for solver application.
+  // Workspace objects for solver application.
   mutable VecType rhs;
+  mutable std::vector<VecType> rhs_blk;
 
 public:
   FluxProjector(const MaterialPropertyCoefficient &coeff,
@@ -53,6 +55,9 @@ public:
                 bool use_mg);
 
   void Mult(const VecType &x, VecType &y) const;
+
+  // Compute the projections for a block of fluxes using a single block linear solve.
+  void ArrayMult(const std::vector<VecType> &x, std::vector<VecType> &y) const;
 };
 
 // Class used for computing gradient flux error estimate, η_K = || ε Eₕ - D ||_K, where D
@@ -140,6 +145,12 @@ public:
   // nondimensionalized using the total field energy.
   void AddErrorIndicator(const VecType &E, const VecType &B, double Et,
                          ErrorIndicator &indicator) const;
+
+  // Compute and fold in the elemental error indicators for a number of solutions at once,
+  // in the given order. The flux recovery for all solutions is performed using block
+  // linear solves, which share the global reductions between the solutions.
+  void AddErrorIndicators(const std::vector<VecType> &E, const std::vector<VecType> &B,
+                          const std::vector<double> &Et, ErrorIndicator &indicator) const;
 };
 
 }  // namespace palace
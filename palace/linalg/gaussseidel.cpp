@@ -0,0 +1,361 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gaussseidel.hpp"
+
+#include <algorithm>
+#include <mfem/general/forall.hpp>
+#include "linalg/hypre.hpp"
+#include "linalg/rap.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+const mfem::HypreParMatrix *GetAssembledMatrix(const Operator *op)
+{
+  // Returns the parallel assembled matrix if the local operator is assembled, otherwise
+  // nullptr.
+  const auto *PtAP = dynamic_cast<const ParOperator *>(op);
+  if (PtAP && dynamic_cast<const hypre::HypreCSRMatrix *>(&PtAP->LocalOperator()))
+  {
+    return &PtAP->ParallelAssemble();
+  }
+  return nullptr;
+}
+
+bool GetAssembledMatrices(const Operator &op, const mfem::HypreParMatrix *&hAr,
+                          const mfem::HypreParMatrix *&hAi)
+{
+  hAr = GetAssembledMatrix(&op);
+  hAi = nullptr;
+  return hAr;
+}
+
+bool GetAssembledMatrices(const ComplexOperator &op, const mfem::HypreParMatrix *&hAr,
+                          const mfem::HypreParMatrix *&hAi)
+{
+  hAr = op.Real() ? GetAssembledMatrix(op.Real()) : nullptr;
+  hAi = op.Imag() ? GetAssembledMatrix(op.Imag()) : nullptr;
+  return (!op.Real() || hAr) && (!op.Imag() || hAi) && (hAr || hAi);
+}
+
+void ExtractLocalBlock(const mfem::HypreParMatrix *hAr, const mfem::HypreParMatrix *hAi,
+                       int n, mfem::Array<int> &I, mfem::Array<int> &J, Vector &data_r,
+                       Vector &data_i)
+{
+  // Merge the local diagonal blocks of the real and imaginary parts into a single CSR
+  // matrix with sorted column indices.
+  struct Entry
+  {
+    int col;
+    double vr, vi;
+  };
+  std::vector<std::vector<Entry>> rows(n);
+  auto AddEntries = [&rows, n](const mfem::HypreParMatrix *hA, bool imag)
+  {
+    if (!hA)
+    {
+      return;
+    }
+    hypre_CSRMatrix *diag = hypre_CSRMatrixClone_v2(
+        hypre_ParCSRMatrixDiag((hypre_ParCSRMatrix *)*hA), 1, HYPRE_MEMORY_HOST);
+    const HYPRE_Int *dI = hypre_CSRMatrixI(diag);
+    const HYPRE_Int *dJ = hypre_CSRMatrixJ(diag);
+    const double *dA = hypre_CSRMatrixData(diag);
+    MFEM_VERIFY(hypre_CSRMatrixNumRows(diag) == n,
+                "Invalid local matrix size for GaussSeidelSmoother!");
+    for (int i = 0; i < n; i++)
+    {
+      for (auto k = dI[i]; k < dI[i + 1]; k++)
+      {
+        rows[i].push_back({static_cast<int>(dJ[k]), imag ? 0.0 : dA[k],
+                           imag ? dA[k] : 0.0});
+      }
+    }
+    hypre_CSRMatrixDestroy(diag);
+  };
+  AddEntries(hAr, false);
+  AddEntries(hAi, true);
+
+  I.SetSize(n + 1);
+  int *h_I = I.HostWrite();
+  h_I[0] = 0;
+  std::vector<int> cols;
+  std::vector<double> vals_r, vals_i;
+  for (int i = 0; i < n; i++)
+  {
+    auto &row = rows[i];
+    std::sort(row.begin(), row.end(),
+              [](const Entry &a, const Entry &b) { return a.col < b.col; });
+    for (std::size_t k = 0; k < row.size(); k++)
+    {
+      if (k > 0 && row[k].col == cols.back())
+      {
+        vals_r.back() += row[k].vr;
+        vals_i.back() += row[k].vi;
+      }
+      else
+      {
+        cols.push_back(row[k].col);
+        vals_r.push_back(row[k].vr);
+        vals_i.push_back(row[k].vi);
+      }
+    }
+    h_I[i + 1] = static_cast<int>(cols.size());
+    std::vector<Entry>().swap(row);
+  }
+  J.SetSize(static_cast<int>(cols.size()));
+  data_r.SetSize(static_cast<int>(cols.size()));
+  data_i.SetSize(static_cast<int>(cols.size()));
+  std::copy(cols.begin(), cols.end(), J.HostWrite());
+  std::copy(vals_r.begin(), vals_r.end(), data_r.HostWrite());
+  std::copy(vals_i.begin(), vals_i.end(), data_i.HostWrite());
+}
+
+void ColorRows(const mfem::Array<int> &I, const mfem::Array<int> &J,
+               mfem::Array<int> &color_rows, std::vector<int> &color_offsets)
+{
+  // Greedy distance-1 coloring of the (structurally symmetric) local matrix graph.
+  const int n = I.Size() - 1;
+  const int *h_I = I.HostRead();
+  const int *h_J = J.HostRead();
+  std::vector<int> color(n, -1), mark;
+  int num_colors = 0;
+  for (int i = 0; i < n; i++)
+  {
+    for (int k = h_I[i]; k < h_I[i + 1]; k++)
+    {
+      const int c = (h_J[k] != i) ? color[h_J[k]] : -1;
+      if (c >= 0)
+      {
+        mark[c] = i;
+      }
+    }
+    int c = 0;
+    while (c < num_colors && mark[c] == i)
+    {
+      c++;
+    }
+    if (c == num_colors)
+    {
+      mark.push_back(-1);
+      num_colors++;
+    }
+    color[i] = c;
+  }
+
+  color_offsets.assign(num_colors + 1, 0);
+  for (int i = 0; i < n; i++)
+  {
+    color_offsets[color[i] + 1]++;
+  }
+  for (int c = 0; c < num_colors; c++)
+  {
+    color_offsets[c + 1] += color_offsets[c];
+  }
+  std::vector<int> pos(color_offsets.begin(), color_offsets.end() - 1);
+  color_rows.SetSize(n);
+  int *h_rows = color_rows.HostWrite();
+  for (int i = 0; i < n; i++)
+  {
+    h_rows[pos[color[i]]++] = i;
+  }
+}
+
+template <bool Backward>
+inline void ApplySweep(const mfem::Array<int> &I, const mfem::Array<int> &J,
+                       const Vector &data_r, const Vector &data_i, const Vector &dinv_r,
+                       const Vector &dinv_i, const mfem::Array<int> &color_rows,
+                       const std::vector<int> &color_offsets, const Vector &r, Vector &d)
+{
+  const bool use_dev = r.UseDevice() || d.UseDevice();
+  const auto *AI = I.Read(use_dev);
+  const auto *AJ = J.Read(use_dev);
+  const auto *AD = data_r.Read(use_dev);
+  const auto *DI = dinv_r.Read(use_dev);
+  const auto *rows = color_rows.Read(use_dev);
+  const auto *R = r.Read(use_dev);
+  auto *D = d.ReadWrite(use_dev);
+  const int num_colors = static_cast<int>(color_offsets.size()) - 1;
+  for (int cc = 0; cc < num_colors; cc++)
+  {
+    const int c = Backward ? num_colors - 1 - cc : cc;
+    const int *crows = rows + color_offsets[c];
+    mfem::forall_switch(use_dev, color_offsets[c + 1] - color_offsets[c],
+                        [=] MFEM_HOST_DEVICE(int k)
+                        {
+                          const int i = crows[k];
+                          double s = R[i];
+                          for (int jj = AI[i]; jj < AI[i + 1]; jj++)
+                          {
+                            const int j = AJ[jj];
+                            s -= (j != i) ? AD[jj] * D[j] : 0.0;
+                          }
+                          D[i] = DI[i] * s;
+                        });
+  }
+}
+
+template <bool Backward>
+inline void ApplySweep(const mfem::Array<int> &I, const mfem::Array<int> &J,
+                       const Vector &data_r, const Vector &data_i, const Vector &dinv_r,
+                       const Vector &dinv_i, const mfem::Array<int> &color_rows,
+                       const std::vector<int> &color_offsets, const ComplexVector &r,
+                       ComplexVector &d)
+{
+  const bool use_dev = r.UseDevice() || d.UseDevice();
+  const auto *AI = I.Read(use_dev);
+  const auto *AJ = J.Read(use_dev);
+  const auto *ADR = data_r.Read(use_dev);
+  const auto *ADI = data_i.Read(use_dev);
+  const auto *DIR = dinv_r.Read(use_dev);
+  const auto *DII = dinv_i.Read(use_dev);
+  const auto *rows = color_rows.Read(use_dev);
+  const auto *RR = r.Real().Read(use_dev);
+  const auto *RI = r.Imag().Read(use_dev);
+  auto *DR = d.Real().ReadWrite(use_dev);
+  auto *DI = d.Imag().ReadWrite(use_dev);
+  const int num_colors = static_cast<int>(color_offsets.size()) - 1;
+  for (int cc = 0; cc < num_colors; cc++)
+  {
+    const int c = Backward ? num_colors - 1 - cc : cc;
+    const int *crows = rows + color_offsets[c];
+    mfem::forall_switch(use_dev, color_offsets[c + 1] - color_offsets[c],
+                        [=] MFEM_HOST_DEVICE(int k)
+                        {
+                          const int i = crows[k];
+                          double sr = RR[i], si = RI[i];
+                          for (int jj = AI[i]; jj < AI[i + 1]; jj++)
+                          {
+                            const int j = AJ[jj];
+                            if (j != i)
+                            {
+                              sr -= ADR[jj] * DR[j] - ADI[jj] * DI[j];
+                              si -= ADI[jj] * DR[j] + ADR[jj] * DI[j];
+                            }
+                          }
+                          DR[i] = DIR[i] * sr - DII[i] * si;
+                          DI[i] = DII[i] * sr + DIR[i] * si;
+                        });
+  }
+}
+
+}  // namespace
+
+template <typename OperType>
+GaussSeidelSmoother<OperType>::GaussSeidelSmoother(MPI_Comm comm, int smooth_it,
+                                                   std::unique_ptr<Solver<OperType>> &&B)
+  : Solver<OperType>(), comm(comm), pc_it(smooth_it), A(nullptr), B(std::move(B)),
+    use_gs(false)
+{
+}
+
+template <typename OperType>
+void GaussSeidelSmoother<OperType>::SetOperator(const OperType &op)
+{
+  A = &op;
+  const mfem::HypreParMatrix *hAr, *hAi;
+  use_gs = GetAssembledMatrices(op, hAr, hAi);
+  if (!use_gs)
+  {
+    B->SetOperator(op);
+    I.DeleteAll();
+    J.DeleteAll();
+    data_r.Destroy();
+    data_i.Destroy();
+    dinv_r.Destroy();
+    dinv_i.Destroy();
+    color_rows.DeleteAll();
+    color_offsets.clear();
+  }
+  else
+  {
+    // Extract and color the local block, and compute the inverse of its diagonal. Rows with
+    // a zero diagonal entry are not updated.
+    const int n = op.Height();
+    ExtractLocalBlock(hAr, hAi, n, I, J, data_r, data_i);
+    ColorRows(I, J, color_rows, color_offsets);
+    dinv_r.SetSize(n);
+    dinv_i.SetSize(n);
+    const int *h_I = I.HostRead();
+    const int *h_J = J.HostRead();
+    const double *h_data_r = data_r.HostRead();
+    const double *h_data_i = data_i.HostRead();
+    double *h_dinv_r = dinv_r.HostWrite();
+    double *h_dinv_i = dinv_i.HostWrite();
+    for (int i = 0; i < n; i++)
+    {
+      double ar = 0.0, ai = 0.0;
+      for (int k = h_I[i]; k < h_I[i + 1]; k++)
+      {
+        if (h_J[k] == i)
+        {
+          ar = h_data_r[k];
+          ai = h_data_i[k];
+          break;
+        }
+      }
+      const double den = ar * ar + ai * ai;
+      h_dinv_r[i] = (den > 0.0) ? ar / den : 0.0;
+      h_dinv_i[i] = (den > 0.0) ? -ai / den : 0.0;
+    }
+    I.UseDevice(true);
+    J.UseDevice(true);
+    color_rows.UseDevice(true);
+    data_r.UseDevice(true);
+    data_i.UseDevice(true);
+    dinv_r.UseDevice(true);
+    dinv_i.UseDevice(true);
+    d.SetSize(n);
+    d.UseDevice(true);
+  }
+
+  this->height = op.Height();
+  this->width = op.Width();
+}
+
+template <typename OperType>
+template <bool Backward>
+void GaussSeidelSmoother<OperType>::Sweep(const VecType &r, VecType &d) const
+{
+  ApplySweep<Backward>(I, J, data_r, data_i, dinv_r, dinv_i, color_rows, color_offsets, r,
+                       d);
+}
+
+template <typename OperType>
+void GaussSeidelSmoother<OperType>::Mult2(const VecType &x, VecType &y, VecType &r) const
+{
+  if (!use_gs)
+  {
+    B->Mult2(x, y, r);
+    return;
+  }
+
+  // Apply smoother: y = y + (D + U)⁻¹ D (D + L)⁻¹ (x - A y), with the triangular solves
+  // performed in the colored ordering.
+  for (int it = 0; it < pc_it; it++)
+  {
+    if (this->initial_guess || it > 0)
+    {
+      A->Mult(y, r);
+      linalg::AXPBY(1.0, x, -1.0, r);
+    }
+    else
+    {
+      r = x;
+      y = 0.0;
+    }
+    d = 0.0;
+    Sweep<false>(r, d);
+    Sweep<true>(r, d);
+    y += d;
+  }
+}
+
+template class GaussSeidelSmoother<Operator>;
+template class GaussSeidelSmoother<ComplexOperator>;
+
+}  // namespace palace
@@ -0,0 +1,107 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_LINALG_GAUSS_SEIDEL_SMOOTHER_HPP
+#define PALACE_LINALG_GAUSS_SEIDEL_SMOOTHER_HPP
+
+#include <memory>
+#include <vector>
+#include <mfem.hpp>
+#include "linalg/operator.hpp"
+#include "linalg/solver.hpp"
+#include "linalg/vector.hpp"
+
+namespace palace
+{
+
+//
+// Symmetric Gauss-Seidel smoother for assembled operators. The forward and backward sweeps
+// act on the processor-local diagonal block of the parallel assembled matrix (hybrid
+// Gauss-Seidel, with off-processor couplings lagged through the residual). A distance-1
+// coloring of the local block is used so that the rows of each color can be updated in
+// parallel. For operators which are not assembled (for example partially assembled
+// high-order levels), application is delegated to the given fallback smoother.
+//
+// Setup (extraction of the local block, coloring, and diagonal inversion) always executes
+// on the host, requiring the assembled matrix to be migrated to host memory on every call
+// to SetOperator. The sweeps execute on the device when the vectors do, but are launched
+// once per color and sequentially over colors, so their parallelism is limited by the
+// number of rows per color rather than the number of rows.
+//
+template <typename OperType>
+class GaussSeidelSmoother : public Solver<OperType>
+{
+  using VecType = typename Solver<OperType>::VecType;
+
+private:
+  // MPI communicator associated with the solver operator and vectors.
+  MPI_Comm comm;
+
+  // Number of smoother iterations.
+  const int pc_it;
+
+  // System matrix (not owned).
+  const OperType *A;
+
+  // Smoother used when the operator is not assembled.
+  std::unique_ptr<Solver<OperType>> B;
+  bool use_gs;
+
+  // Local diagonal block of the assembled operator in CSR format, with real and imaginary
+  // parts of the values, and its inverse diagonal.
+  mfem::Array<int> I, J;
+  Vector data_r, data_i, dinv_r, dinv_i;
+
+  // Rows of the local block grouped by color.
+  mfem::Array<int> color_rows;
+  std::vector<int> color_offsets;
+
+  // Temporary vectors for smoother application.
+  mutable VecType d, r;
+
+  // Apply a forward or backward sweep to solve for the correction d given the residual r.
+  template <bool Backward>
+  void Sweep(const VecType &r, VecType &d) const;
+
+public:
+  GaussSeidelSmoother(MPI_Comm comm, int smooth_it, std::unique_ptr<Solver<OperType>> &&B);
+
+  void SetInitialGuess(bool guess) override
+  {
+    Solver<OperType>::SetInitialGuess(guess);
+    B->SetInitialGuess(guess);
+  }
+
+  void SetOperator(const OperType &op) override;
+
+  void Mult(const VecType &x, VecType &y) const override
+  {
+    if (r.Size() != y.Size())
+    {
+      r.SetSize(y.Size());
+      r.UseDevice(true);
+    }
+    Mult2(x, y, r);
+  }
+
+  void MultTranspose(const VecType &x, VecType &y) const override
+  {
+    if (r.Size() != y.Size())
+    {
+      r.SetSize(y.Size());
+      r.UseDevice(true);
+    }
+    MultTranspose2(x, y, r);
+  }
+
+  void Mult2(const VecType &x, VecType &y, VecType &r) const override;
+
+  void MultTranspose2(const VecType &x, VecType &y, VecType &r) const override
+  {
+    Mult2(x, y, r);  // Assumes operator symmetry
+  }
+};
+
+}  // namespace palace
+
+#endif  // PALACE_LINALG_GAUSS_SEIDEL_SMOOTHER_HPP
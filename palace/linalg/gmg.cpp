@@ -6,6 +6,8 @@
 #include <mfem.hpp>
 #include "linalg/chebyshev.hpp"
 #include "linalg/distrelaxation.hpp"
+#include "linalg/gaussseidel.hpp"
+#include "linalg/gmrespoly.hpp"
 #include "linalg/rap.hpp"
 #include "utils/timer.hpp"
 
@@ -17,7 +19,7 @@ GeometricMultigridSolver<OperType>::GeometricMultigridSolver(
     MPI_Comm comm, std::unique_ptr<Solver<OperType>> &&coarse_solver,
     const std::vector<const Operator *> &P, const std::vector<const Operator *> *G,
     int cycle_it, int smooth_it, int cheby_order, double cheby_sf_max, double cheby_sf_min,
-    bool cheby_4th_kind)
+    bool cheby_4th_kind, bool gs_smooth, bool gmres_poly_smooth)
   : Solver<OperType>(), pc_it(cycle_it), P(P.begin(), P.end()), A(P.size() + 1),
     dbc_tdof_lists(P.size()), B(P.size() + 1), X(P.size() + 1), Y(P.size() + 1),
     R(P.size() + 1), use_timer(false)
@@ -35,7 +37,8 @@ GeometricMultigridSolver<OperType>::GeometricMultigridSolver(
   B[0] = std::move(coarse_solver);
 
   // Configure level smoothers. Use distributive relaxation smoothing if an auxiliary
-  // finite element space was provided.
+  // finite element space was provided. Gauss-Seidel smoothing, if requested, is used for
+  // the levels with assembled operators.
   for (std::size_t l = 1; l < n_levels; l++)
   {
     if (G)
@@ -43,12 +46,17 @@ GeometricMultigridSolver<OperType>::GeometricMultigridSolver(
       const int cheby_smooth_it = 1;
       B[l] = std::make_unique<DistRelaxationSmoother<OperType>>(
           comm, *(*G)[l], smooth_it, cheby_smooth_it, cheby_order, cheby_sf_max,
-          cheby_sf_min, cheby_4th_kind);
+          cheby_sf_min, cheby_4th_kind, gs_smooth, gmres_poly_smooth);
     }
     else
     {
       const int cheby_smooth_it = smooth_it;
-      if (cheby_4th_kind)
+      if (gmres_poly_smooth)
+      {
+        B[l] = std::make_unique<GmresPolynomialSmoother<OperType>>(comm, cheby_smooth_it,
+                                                                   cheby_order);
+      }
+      else if (cheby_4th_kind)
       {
         B[l] = std::make_unique<ChebyshevSmoother<OperType>>(comm, cheby_smooth_it,
                                                              cheby_order, cheby_sf_max);
@@ -58,6 +66,11 @@ GeometricMultigridSolver<OperType>::GeometricMultigridSolver(
         B[l] = std::make_unique<ChebyshevSmoother1stKind<OperType>>(
             comm, cheby_smooth_it, cheby_order, cheby_sf_max, cheby_sf_min);
       }
+      if (gs_smooth)
+      {
+        B[l] = std::make_unique<GaussSeidelSmoother<OperType>>(comm, smooth_it,
+                                                               std::move(B[l]));
+      }
     }
   }
 }
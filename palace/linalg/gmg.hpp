@@ -61,7 +61,8 @@ public:
                            const std::vector<const Operator *> &P,
                            const std::vector<const Operator *> *G, int cycle_it,
                            int smooth_it, int cheby_order, double cheby_sf_max,
-                           double cheby_sf_min, bool cheby_4th_kind);
+                           double cheby_sf_min, bool cheby_4th_kind,
+                           bool gs_smooth = false, bool gmres_poly_smooth = false);
   GeometricMultigridSolver(MPI_Comm comm, const IoData &iodata,
                            std::unique_ptr<Solver<OperType>> &&coarse_solver,
                            const std::vector<const Operator *> &P,
@@ -70,7 +71,8 @@ public:
           comm, std::move(coarse_solver), P, G, iodata.solver.linear.mg_cycle_it,
           iodata.solver.linear.mg_smooth_it, iodata.solver.linear.mg_smooth_order,
           iodata.solver.linear.mg_smooth_sf_max, iodata.solver.linear.mg_smooth_sf_min,
-          iodata.solver.linear.mg_smooth_cheby_4th)
+          iodata.solver.linear.mg_smooth_cheby_4th, iodata.solver.linear.mg_smooth_gs,
+          iodata.solver.linear.mg_smooth_gmres_poly)
   {
   }
 
@@ -0,0 +1,264 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gmrespoly.hpp"
+
+#include <cmath>
+#include <type_traits>
+#include <Eigen/Dense>
+
+namespace palace
+{
+
+namespace
+{
+
+template <typename ScalarType>
+std::vector<std::complex<double>>
+GetHarmonicRitzValues(const Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic> &H,
+                      int m)
+{
+  // Harmonic Ritz values are the eigenvalues of H_m + |h_{m+1,m}|² H_m⁻ᴴ e_m e_mᵀ, where
+  // H_m is the leading m x m block of the (m + 1) x m Arnoldi Hessenberg matrix.
+  using MatType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+  using VecType = Eigen::Matrix<ScalarType, Eigen::Dynamic, 1>;
+  MatType Hm = H.topLeftCorner(m, m);
+  const double h = std::abs(H(m, m - 1));
+  if (h > 0.0)
+  {
+    VecType em = VecType::Zero(m);
+    em(m - 1) = 1.0;
+    VecType f = Hm.adjoint().partialPivLu().solve(em);
+    Hm.col(m - 1) += (h * h) * f;
+  }
+  std::vector<std::complex<double>> theta(m);
+  if constexpr (std::is_same<ScalarType, double>::value)
+  {
+    Eigen::EigenSolver<MatType> eps(Hm, false);
+    for (int i = 0; i < m; i++)
+    {
+      theta[i] = eps.eigenvalues()(i);
+    }
+  }
+  else
+  {
+    Eigen::ComplexEigenSolver<MatType> eps(Hm, false);
+    for (int i = 0; i < m; i++)
+    {
+      theta[i] = eps.eigenvalues()(i);
+    }
+  }
+  return theta;
+}
+
+std::vector<std::complex<double>> LejaOrder(std::vector<std::complex<double>> theta,
+                                            bool real_op)
+{
+  // Order the roots using the modified Leja ordering, keeping complex conjugate pairs
+  // together for real-valued operators (only the root with positive imaginary part is kept
+  // as a candidate, and its conjugate is appended directly after).
+  if (real_op)
+  {
+    std::vector<std::complex<double>> candidates;
+    for (auto z : theta)
+    {
+      if (std::abs(z.imag()) <= 1.0e-12 * std::abs(z))
+      {
+        candidates.emplace_back(z.real(), 0.0);
+      }
+      else if (z.imag() > 0.0)
+      {
+        candidates.push_back(z);
+      }
+    }
+    theta = std::move(candidates);
+  }
+  std::vector<std::complex<double>> roots;
+  std::vector<double> log_prod(theta.size(), 0.0);
+  while (!theta.empty())
+  {
+    std::size_t k = 0;
+    for (std::size_t i = 1; i < theta.size(); i++)
+    {
+      const bool better = roots.empty() ? (std::abs(theta[i]) > std::abs(theta[k]))
+                                        : (log_prod[i] > log_prod[k]);
+      if (better)
+      {
+        k = i;
+      }
+    }
+    const auto z = theta[k];
+    roots.push_back(z);
+    if (real_op && z.imag() != 0.0)
+    {
+      roots.push_back(std::conj(z));
+    }
+    theta.erase(theta.begin() + k);
+    log_prod.erase(log_prod.begin() + k);
+    for (std::size_t i = 0; i < theta.size(); i++)
+    {
+      log_prod[i] += std::log(std::abs(theta[i] - z));
+      if (real_op && z.imag() != 0.0)
+      {
+        log_prod[i] += std::log(std::abs(theta[i] - std::conj(z)));
+      }
+    }
+  }
+  return roots;
+}
+
+}  // namespace
+
+template <typename OperType>
+GmresPolynomialSmoother<OperType>::GmresPolynomialSmoother(MPI_Comm comm, int smooth_it,
+                                                           int poly_order)
+  : Solver<OperType>(), comm(comm), pc_it(smooth_it), order(poly_order), A(nullptr)
+{
+  MFEM_VERIFY(order > 0,
+              "Polynomial order for GMRES polynomial smoothing must be positive!");
+}
+
+template <typename OperType>
+void GmresPolynomialSmoother<OperType>::SetOperator(const OperType &op)
+{
+  using ScalarType =
+      typename std::conditional<std::is_same<OperType, ComplexOperator>::value,
+                                std::complex<double>, double>::type;
+  using MatType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+
+  A = &op;
+  p.SetSize(op.Height());
+  t.SetSize(op.Height());
+  w.SetSize(op.Height());
+  dinv.SetSize(op.Height());
+  p.UseDevice(true);
+  t.UseDevice(true);
+  w.UseDevice(true);
+  dinv.UseDevice(true);
+  op.AssembleDiagonal(dinv);
+  dinv.Reciprocal();
+
+  // Run the Arnoldi process for the diagonally-scaled operator, with a random starting
+  // vector. This is the only place inner products are required.
+  BaseDiagonalOperator<OperType> Dinv(dinv);
+  std::vector<VecType> V(order + 1);
+  for (auto &v : V)
+  {
+    v.SetSize(op.Height());
+    v.UseDevice(true);
+  }
+  linalg::SetRandom(comm, V[0]);
+  linalg::Normalize(comm, V[0]);
+  MatType H = MatType::Zero(order + 1, order);
+  int m = order;
+  for (int j = 0; j < order; j++)
+  {
+    op.Mult(V[j], w);
+    Dinv.Mult(w, V[j + 1]);
+    for (int pass = 0; pass < 2; pass++)
+    {
+      for (int i = 0; i <= j; i++)
+      {
+        const ScalarType hij = linalg::Dot(comm, V[j + 1], V[i]);
+        H(i, j) += hij;
+        linalg::AXPY(-hij, V[i], V[j + 1]);
+      }
+    }
+    H(j + 1, j) = linalg::Norml2(comm, V[j + 1]);
+    if (std::abs(H(j + 1, j)) <= 1.0e-12 * H.col(j).norm())
+    {
+      // Found an invariant subspace, the polynomial degree is reduced.
+      m = j + 1;
+      H(j + 1, j) = 0.0;
+      break;
+    }
+    V[j + 1] *= 1.0 / std::abs(H(j + 1, j));
+  }
+
+  // The roots of the GMRES residual polynomial are the harmonic Ritz values.
+  roots = LejaOrder(GetHarmonicRitzValues<ScalarType>(H, m),
+                    !std::is_same<OperType, ComplexOperator>::value);
+  for (const auto &z : roots)
+  {
+    MFEM_VERIFY(std::abs(z) > 0.0 && std::isfinite(std::abs(z)),
+                "Invalid harmonic Ritz value in GMRES polynomial smoother setup!");
+  }
+
+  this->height = op.Height();
+  this->width = op.Width();
+}
+
+template <typename OperType>
+void GmresPolynomialSmoother<OperType>::Mult2(const VecType &x, VecType &y,
+                                              VecType &r) const
+{
+  // Apply smoother: y = y + p(D⁻¹ A) D⁻¹ (x - A y), where 1 - z p(z) is the GMRES residual
+  // polynomial with the given roots. The product form is from Loe and Morgan (2022),
+  // Algorithms 2 and 3.
+  BaseDiagonalOperator<OperType> Dinv(dinv);
+  const int n_roots = static_cast<int>(roots.size());
+  for (int it = 0; it < pc_it; it++)
+  {
+    if (this->initial_guess || it > 0)
+    {
+      A->Mult(y, r);
+      linalg::AXPBY(1.0, x, -1.0, r);
+    }
+    else
+    {
+      r = x;
+      y = 0.0;
+    }
+    Dinv.Mult(r, p);
+    for (int i = 0; i < n_roots;)
+    {
+      const auto z = roots[i];
+      if constexpr (std::is_same<OperType, ComplexOperator>::value)
+      {
+        // y = y + 1/θ p, p = p - 1/θ D⁻¹ A p.
+        linalg::AXPY(1.0 / z, p, y);
+        if (i < n_roots - 1)
+        {
+          A->Mult(p, w);
+          Dinv.AddMult(w, p, -1.0 / z);
+        }
+        i++;
+      }
+      else
+      {
+        if (z.imag() == 0.0)
+        {
+          // Real root: y = y + 1/θ p, p = p - 1/θ D⁻¹ A p.
+          linalg::AXPY(1.0 / z.real(), p, y);
+          if (i < n_roots - 1)
+          {
+            A->Mult(p, w);
+            Dinv.AddMult(w, p, -1.0 / z.real());
+          }
+          i++;
+        }
+        else
+        {
+          // Complex conjugate pair θ = a ± ib: y = y + 1/|θ|² (2a p - t), and
+          // p = p - 1/|θ|² (2a t - D⁻¹ A t), where t = D⁻¹ A p.
+          const double a = z.real(), s = 1.0 / std::norm(z);
+          A->Mult(p, w);
+          Dinv.Mult(w, t);
+          linalg::AXPBYPCZ(2.0 * a * s, p, -s, t, 1.0, y);
+          if (i < n_roots - 2)
+          {
+            A->Mult(t, w);
+            linalg::AXPY(-2.0 * a * s, t, p);
+            Dinv.AddMult(w, p, s);
+          }
+          i += 2;
+        }
+      }
+    }
+  }
+}
+
+template class GmresPolynomialSmoother<Operator>;
+template class GmresPolynomialSmoother<ComplexOperator>;
+
+}  // namespace palace
@@ -0,0 +1,88 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_LINALG_GMRES_POLYNOMIAL_HPP
+#define PALACE_LINALG_GMRES_POLYNOMIAL_HPP
+
+#include <complex>
+#include <vector>
+#include "linalg/operator.hpp"
+#include "linalg/solver.hpp"
+#include "linalg/vector.hpp"
+
+namespace palace
+{
+
+//
+// Matrix-free diagonally-scaled GMRES polynomial preconditioner or smoother. The polynomial
+// is constructed once at setup from the harmonic Ritz values of a short Arnoldi run on the
+// diagonally-scaled operator, and its application requires only operator applications (no
+// inner products), with the roots applied in modified Leja order for stability. Unlike
+// Chebyshev smoothing, this does not rely on eigenvalue bounds and is suitable for
+// non-symmetric and complex-valued operators.
+// Reference: Loe and Morgan, Toward efficient polynomial preconditioning for GMRES, Numer.
+//            Linear Algebra Appl. (2022).
+//
+template <typename OperType>
+class GmresPolynomialSmoother : public Solver<OperType>
+{
+  using VecType = typename Solver<OperType>::VecType;
+
+private:
+  // MPI communicator associated with the solver operator and vectors.
+  MPI_Comm comm;
+
+  // Number of smoother iterations and polynomial degree.
+  const int pc_it, order;
+
+  // System matrix (not owned).
+  const OperType *A;
+
+  // Inverse diagonal scaling of the operator.
+  VecType dinv;
+
+  // Roots of the GMRES residual polynomial (harmonic Ritz values), in modified Leja order.
+  // For real-valued operators, complex conjugate pairs are stored consecutively.
+  std::vector<std::complex<double>> roots;
+
+  // Temporary vectors for smoother application.
+  mutable VecType p, t, w, r;
+
+public:
+  GmresPolynomialSmoother(MPI_Comm comm, int smooth_it, int poly_order);
+
+  void SetOperator(const OperType &op) override;
+
+  void Mult(const VecType &x, VecType &y) const override
+  {
+    if (r.Size() != y.Size())
+    {
+      r.SetSize(y.Size());
+      r.UseDevice(true);
+    }
+    Mult2(x, y, r);
+  }
+
+  void MultTranspose(const VecType &x, VecType &y) const override
+  {
+    if (r.Size() != y.Size())
+    {
+      r.SetSize(y.Size());
+      r.UseDevice(true);
+    }
+    MultTranspose2(x, y, r);
+  }
+
+  void Mult2(const VecType &x, VecType &y, VecType &r) const override;
+
+  void MultTranspose2(const VecType &x, VecType &y, VecType &r) const override
+  {
+    // The polynomial is not the transpose in general, so multigrid with this smoother
+    // should be used with a Krylov solver for non-symmetric operators.
+    Mult2(x, y, r);
+  }
+};
+
+}  // namespace palace
+
+#endif  // PALACE_LINALG_GMRES_POLYNOMIAL_HPP
@@ -352,11 +352,41 @@ IterativeSolver<OperType>::IterativeSolver(MPI_Comm comm, int print)
   converged = false;
   initial_res = 1.0;
   final_res = 0.0;
-  final_it = 0;
+  final_it = final_total_it = 0;
 
   use_timer = false;
 }
 
+template <typename OperType>
+void IterativeSolver<OperType>::ArrayMult(const std::vector<VecType> &b,
+                                          std::vector<VecType> &x) const
+{
+  MFEM_VERIFY(b.size() == x.size(),
+              "Mismatch in number of right-hand sides for IterativeSolver::ArrayMult!");
+  bool all_converged = true;
+  double max_red = -1.0, res0 = 0.0, res = 0.0;
+  int it = 0, total_it = 0;
+  for (std::size_t i = 0; i < b.size(); i++)
+  {
+    this->Mult(b[i], x[i]);
+    total_it += final_it;
+    all_converged = all_converged && converged;
+    const double red = (initial_res > 0.0) ? final_res / initial_res : 0.0;
+    if (red > max_red)
+    {
+      max_red = red;
+      res0 = initial_res;
+      res = final_res;
+    }
+    it = std::max(it, final_it);
+  }
+  converged = all_converged;
+  initial_res = res0;
+  final_res = res;
+  final_it = it;
+  final_total_it = total_it;
+}
+
 template <typename OperType>
 void CgSolver<OperType>::Mult(const VecType &b, VecType &x) const
 {
@@ -485,6 +515,215 @@ void CgSolver<OperType>::Mult(const VecType &b, VecType &x) const
   final_it = it;
 }
 
+template <typename OperType>
+void CgSolver<OperType>::ArrayMult(const std::vector<VecType> &b,
+                                   std::vector<VecType> &x) const
+{
+  // Set up workspace.
+  const std::size_t nrhs = b.size();
+  MFEM_VERIFY(A, "Operator must be set for CgSolver::ArrayMult!");
+  MFEM_VERIFY(x.size() == nrhs,
+              "Mismatch in number of right-hand sides for CgSolver::ArrayMult!");
+  if (nrhs == 0)
+  {
+    converged = true;
+    initial_res = final_res = 0.0;
+    final_it = final_total_it = 0;
+    return;
+  }
+  R.resize(nrhs);
+  Z.resize(nrhs);
+  P.resize(nrhs);
+  for (std::size_t i = 0; i < nrhs; i++)
+  {
+    MFEM_ASSERT(A->Width() == x[i].Size() && A->Height() == b[i].Size(),
+                "Size mismatch for CgSolver::ArrayMult!");
+    R[i].SetSize(A->Height());
+    Z[i].SetSize(A->Height());
+    P[i].SetSize(A->Height());
+    R[i].UseDevice(true);
+    Z[i].UseDevice(true);
+    P[i].UseDevice(true);
+  }
+  std::vector<ScalarType> beta(nrhs), beta_prev(nrhs, 0.0), dot(nrhs);
+  std::vector<RealType> res(nrhs), res0(nrhs), eps(nrhs);
+  std::vector<int> active;
+  active.reserve(nrhs);
+
+  // Initialize.
+  for (std::size_t i = 0; i < nrhs; i++)
+  {
+    if (this->initial_guess)
+    {
+      A->Mult(x[i], R[i]);
+      linalg::AXPBY(1.0, b[i], -1.0, R[i]);
+    }
+    else
+    {
+      R[i] = b[i];
+      x[i] = 0.0;
+    }
+    if (B)
+    {
+      ApplyB(B, R[i], Z[i], this->use_timer);
+    }
+    else
+    {
+      Z[i] = R[i];
+    }
+    beta[i] = linalg::LocalDot(Z[i], R[i]);
+  }
+  Mpi::GlobalSum(static_cast<int>(nrhs), beta.data(), comm);
+  if (this->initial_guess)
+  {
+    for (std::size_t i = 0; i < nrhs; i++)
+    {
+      if (B)
+      {
+        ApplyB(B, b[i], P[i], this->use_timer);
+        dot[i] = linalg::LocalDot(P[i], b[i]);
+      }
+      else
+      {
+        dot[i] = linalg::LocalDot(b[i], b[i]);
+      }
+    }
+    Mpi::GlobalSum(static_cast<int>(nrhs), dot.data(), comm);
+  }
+  for (std::size_t i = 0; i < nrhs; i++)
+  {
+    CheckDot(beta[i], "PCG preconditioner is not positive definite: (Br, r) = ");
+    res[i] = std::sqrt(std::abs(beta[i]));
+    if (this->initial_guess)
+    {
+      CheckDot(dot[i], "PCG preconditioner is not positive definite: (Bb, b) = ");
+      res0[i] = std::sqrt(std::abs(dot[i]));
+    }
+    else
+    {
+      res0[i] = res[i];
+    }
+    eps[i] = std::max(rel_tol * res0[i], abs_tol);
+    if (!(res[i] < eps[i]))
+    {
+      active.push_back(static_cast<int>(i));
+    }
+  }
+  auto MaxActiveRes = [&]()
+  {
+    RealType max_res = 0.0;
+    for (auto i : active)
+    {
+      max_res = std::max(max_res, res[i]);
+    }
+    return max_res;
+  };
+
+  // Begin iterations. Converged systems are removed from the active set, so that their
+  // iterates are no longer updated.
+  int it = 0, total_it = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm,
+               "{}Maximum residual norms for block PCG solve ({:d} right-hand sides)\n",
+               std::string(tab_width + int_width - 1, ' '), nrhs);
+  }
+  for (; it < max_it && !active.empty(); it++)
+  {
+    if (print_opts.iterations)
+    {
+      Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r||_B = {:.6e}\n",
+                 std::string(tab_width, ' '), it, int_width, MaxActiveRes());
+    }
+    const int nact = static_cast<int>(active.size());
+    total_it += nact;
+    for (int k = 0; k < nact; k++)
+    {
+      const int i = active[k];
+      if (!it)
+      {
+        P[i] = Z[i];
+      }
+      else
+      {
+        linalg::AXPBY(ScalarType(1.0), Z[i], beta[i] / beta_prev[i], P[i]);
+      }
+      A->Mult(P[i], Z[i]);
+      dot[k] = linalg::LocalDot(Z[i], P[i]);
+    }
+    Mpi::GlobalSum(nact, dot.data(), comm);
+    for (int k = 0; k < nact; k++)
+    {
+      const int i = active[k];
+      CheckDot(dot[k], "PCG operator is not positive definite: (Ap, p) = ");
+      const ScalarType alpha = beta[i] / dot[k];
+      x[i].Add(alpha, P[i]);
+      R[i].Add(-alpha, Z[i]);
+
+      beta_prev[i] = beta[i];
+      if (B)
+      {
+        ApplyB(B, R[i], Z[i], this->use_timer);
+      }
+      else
+      {
+        Z[i] = R[i];
+      }
+      dot[k] = linalg::LocalDot(Z[i], R[i]);
+    }
+    Mpi::GlobalSum(nact, dot.data(), comm);
+    std::vector<int> next;
+    next.reserve(nact);
+    for (int k = 0; k < nact; k++)
+    {
+      const int i = active[k];
+      beta[i] = dot[k];
+      CheckDot(beta[i], "PCG preconditioner is not positive definite: (Br, r) = ");
+      res[i] = std::sqrt(std::abs(beta[i]));
+      if (!(res[i] < eps[i]))
+      {
+        next.push_back(i);
+      }
+    }
+    active = std::move(next);
+  }
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r||_B = {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, MaxActiveRes());
+  }
+
+  // Report the statistics for the right-hand side with the largest relative residual.
+  std::size_t imax = 0;
+  for (std::size_t i = 1; i < nrhs; i++)
+  {
+    if (res[i] * res0[imax] > res[imax] * res0[i])
+    {
+      imax = i;
+    }
+  }
+  converged = active.empty();
+  if (print_opts.summary || (print_opts.warnings && !converged))
+  {
+    Mpi::Print(comm, "{}Block PCG solver ({:d} right-hand sides) {} in {:d} iteration{}",
+               std::string(tab_width, ' '), nrhs,
+               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    if (it > 0 && res0[imax] > 0.0)
+    {
+      Mpi::Print(comm, " (max. avg. reduction factor: {:.3e})\n",
+                 std::pow(res[imax] / res0[imax], 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  initial_res = res0[imax];
+  final_res = res[imax];
+  final_it = it;
+  final_total_it = total_it;
+}
+
 template <typename OperType>
 void GmresSolver<OperType>::Initialize() const
 {
@@ -25,6 +25,7 @@ template <typename OperType>
 class IterativeSolver : public Solver<OperType>
 {
 protected:
+  using VecType = typename Solver<OperType>::VecType;
   using RealType = double;
   using ScalarType =
       typename std::conditional<std::is_same<OperType, ComplexOperator>::value,
@@ -48,10 +49,11 @@ protected:
   const OperType *A;
   const Solver<OperType> *B;
 
-  // Variables set during solve to capture solve statistics.
+  // Variables set during solve to capture solve statistics. For a block of right-hand
+  // sides, the total number of iterations summed over all of them is also recorded.
   mutable bool converged;
   mutable double initial_res, final_res;
-  mutable int final_it;
+  mutable int final_it, final_total_it;
 
   // Enable timer contribution for Timer::PRECONDITIONER.
   bool use_timer;
@@ -100,11 +102,20 @@ public:
   // Returns the number of iterations for the previous solve.
   int GetNumIterations() const { return final_it; }
 
+  // Returns the number of iterations for the previous solve with a block of right-hand
+  // sides, summed over all of them.
+  int GetNumTotalIterations() const { return final_total_it; }
+
   // Get the associated MPI communicator.
   MPI_Comm GetComm() const { return comm; }
 
   // Activate preconditioner timing during solves.
   void EnableTimer() { use_timer = true; }
+
+  // Solve the linear system for a block of right-hand sides. The default implementation
+  // performs the solves one after the other. The solve statistics reported afterwards are
+  // those of the slowest converging right-hand side.
+  virtual void ArrayMult(const std::vector<VecType> &b, std::vector<VecType> &x) const;
 };
 
 // Preconditioned Conjugate Gradient (CG) method for SPD linear systems.
@@ -132,14 +143,23 @@ protected:
   using IterativeSolver<OperType>::initial_res;
   using IterativeSolver<OperType>::final_res;
   using IterativeSolver<OperType>::final_it;
+  using IterativeSolver<OperType>::final_total_it;
 
   // Temporary workspace for solve.
   mutable VecType r, z, p;
 
+  // Temporary workspace for solves with multiple right-hand sides.
+  mutable std::vector<VecType> R, Z, P;
+
 public:
   CgSolver(MPI_Comm comm, int print) : IterativeSolver<OperType>(comm, print) {}
 
   void Mult(const VecType &b, VecType &x) const override;
+
+  // The iterations for each right-hand side are carried out in lockstep, with the inner
+  // products for all unconverged systems combined into a single global reduction. Each
+  // system follows the same sequence of iterates as with a single right-hand side.
+  void ArrayMult(const std::vector<VecType> &b, std::vector<VecType> &x) const override;
 };
 
 // Base class defining enums for GMRES.
@@ -0,0 +1,962 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "krylovschur.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <mfem.hpp>
+#include "linalg/divfree.hpp"
+#include "utils/communication.hpp"
+#include "utils/filesystem.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+// Version number for the checkpoint file format.
+constexpr std::int64_t CHECKPOINT_VERSION = 2;
+
+void GetBlockRef(const ComplexVector &x, int i, int n, ComplexVector &xi)
+{
+  // Reference the i-th block of size n of the given vector (for example, one half of a
+  // vector of the linearized quadratic eigenvalue problem).
+  auto &y = const_cast<ComplexVector &>(x);
+  xi.Real().MakeRef(y.Real(), i * n, n);
+  xi.Imag().MakeRef(y.Imag(), i * n, n);
+  xi.UseDevice(true);
+}
+
+void SwapSchur(Eigen::MatrixXcd &T, Eigen::MatrixXcd &Q, int k)
+{
+  // Swap the adjacent diagonal entries k and k + 1 of the upper triangular Schur factor T
+  // using a Givens rotation, and accumulate the rotation into the Schur vectors Q (see
+  // LAPACK ZTREXC).
+  const std::complex<double> t11 = T(k, k), t22 = T(k + 1, k + 1);
+  const std::complex<double> f = T(k, k + 1), g = t22 - t11;
+  double c;
+  std::complex<double> s;
+  if (std::abs(g) == 0.0)
+  {
+    c = 1.0;
+    s = 0.0;
+  }
+  else if (std::abs(f) == 0.0)
+  {
+    c = 0.0;
+    s = std::conj(g) / std::abs(g);
+  }
+  else
+  {
+    const double d = std::hypot(std::abs(f), std::abs(g));
+    c = std::abs(f) / d;
+    s = (f / std::abs(f)) * std::conj(g) / d;
+  }
+  auto Rotate = [](std::complex<double> &x, std::complex<double> &y, double c,
+                   std::complex<double> s)
+  {
+    const std::complex<double> t = c * x + s * y;
+    y = c * y - std::conj(s) * x;
+    x = t;
+  };
+  for (int j = k + 2; j < T.cols(); j++)
+  {
+    Rotate(T(k, j), T(k + 1, j), c, s);
+  }
+  for (int i = 0; i < k; i++)
+  {
+    Rotate(T(i, k), T(i, k + 1), c, std::conj(s));
+  }
+  T(k, k) = t22;
+  T(k + 1, k + 1) = t11;
+  for (int i = 0; i < Q.rows(); i++)
+  {
+    Rotate(Q(i, k), Q(i, k + 1), c, std::conj(s));
+  }
+}
+
+void ReorderSchur(Eigen::MatrixXcd &T, Eigen::MatrixXcd &Q, const std::vector<int> &sel)
+{
+  // Move the diagonal entries of T at the given (original) positions to the leading
+  // positions, in the given order.
+  std::vector<int> pos(T.rows());
+  std::iota(pos.begin(), pos.end(), 0);
+  for (std::size_t p = 0; p < sel.size(); p++)
+  {
+    int j = static_cast<int>(std::find(pos.begin(), pos.end(), sel[p]) - pos.begin());
+    for (; j > static_cast<int>(p); j--)
+    {
+      SwapSchur(T, Q, j - 1);
+      std::swap(pos[j - 1], pos[j]);
+    }
+  }
+}
+
+}  // namespace
+
+BlockKrylovSchurSolver::BlockKrylovSchurSolver(MPI_Comm comm, int print)
+  : comm(comm), print(print)
+{
+  // Initialization.
+  nev = ncv = n = 0;
+  block_size = 1;
+  rtol = 0.0;
+  restart_it = 0;
+  which_type = WhichType::LARGEST_MAGNITUDE;
+  gamma = delta = 1.0;
+  sinvert = false;
+  sigma = 0.0;
+  seed = 0;
+  checkpoint_it = 0;
+  checkpoint_restart = false;
+  checkpoint_warn = true;
+
+  opK = opC = opM = nullptr;
+  normK = normC = normM = 0.0;
+  opInv = nullptr;
+  opProj = nullptr;
+  opB = nullptr;
+}
+
+void BlockKrylovSchurSolver::SetOperators(const ComplexOperator &K,
+                                          const ComplexOperator &M,
+                                          EigenvalueSolver::ScaleType type)
+{
+  MFEM_VERIFY(!opK || K.Height() == n, "Invalid modification of eigenvalue problem size!");
+  MFEM_VERIFY(!opK || !opC, "Invalid modification of eigenvalue problem type!");
+  bool first = (opK == nullptr);
+  opK = &K;
+  opC = nullptr;
+  opM = &M;
+  if (first && type != ScaleType::NONE)
+  {
+    normK = linalg::SpectralNorm(comm, *opK, opK->IsReal());
+    normM = linalg::SpectralNorm(comm, *opM, opM->IsReal());
+    MFEM_VERIFY(normK >= 0.0 && normM >= 0.0, "Invalid matrix norms for EPS scaling!");
+    if (normK > 0 && normM > 0.0)
+    {
+      gamma = normK / normM;  // Store γ² for linear problem
+      delta = 2.0 / normK;
+    }
+  }
+
+  // Set up workspace.
+  z1.SetSize(opK->Height());
+  z1.UseDevice(true);
+  n = opK->Height();
+}
+
+void BlockKrylovSchurSolver::SetOperators(const ComplexOperator &K,
+                                          const ComplexOperator &C,
+                                          const ComplexOperator &M,
+                                          EigenvalueSolver::ScaleType type)
+{
+  MFEM_VERIFY(!opK || K.Height() == n, "Invalid modification of eigenvalue problem size!");
+  MFEM_VERIFY(!opK || opC, "Invalid modification of eigenvalue problem type!");
+  bool first = (opK == nullptr);
+  opK = &K;
+  opC = &C;
+  opM = &M;
+  if (first && type != ScaleType::NONE)
+  {
+    normK = linalg::SpectralNorm(comm, *opK, opK->IsReal());
+    normC = linalg::SpectralNorm(comm, *opC, opC->IsReal());
+    normM = linalg::SpectralNorm(comm, *opM, opM->IsReal());
+    MFEM_VERIFY(normK >= 0.0 && normC >= 0.0 && normM >= 0.0,
+                "Invalid matrix norms for PEP scaling!");
+    if (normK > 0 && normC > 0.0 && normM > 0.0)
+    {
+      gamma = std::sqrt(normK / normM);
+      delta = 2.0 / (normK + gamma * normC);
+    }
+  }
+
+  // Set up workspace.
+  z1.SetSize(opK->Height());
+  z1.UseDevice(true);
+  n = opK->Height();
+}
+
+void BlockKrylovSchurSolver::SetLinearSolver(const ComplexKspSolver &ksp)
+{
+  opInv = &ksp;
+}
+
+void BlockKrylovSchurSolver::SetDivFreeProjector(
+    const DivFreeSolver<ComplexVector> &divfree)
+{
+  opProj = &divfree;
+}
+
+void BlockKrylovSchurSolver::SetBMat(const Operator &B)
+{
+  MFEM_VERIFY(!opB || opB->Height() == B.Height(),
+              "Invalid modification of eigenvalue problem size!");
+  opB = &B;
+}
+
+void BlockKrylovSchurSolver::SetNumModes(int num_eig, int num_vec)
+{
+  nev = num_eig;
+  ncv = (num_vec > 0) ? num_vec : std::max(20, 2 * nev + 1);  // Default from SLEPc
+}
+
+void BlockKrylovSchurSolver::SetBlockSize(int bs)
+{
+  MFEM_VERIFY(bs > 0, "Block size for block Krylov-Schur eigensolver must be positive!");
+  block_size = bs;
+}
+
+void BlockKrylovSchurSolver::SetCheckpoint(const std::string &prefix, int interval,
+                                           bool restart, bool warn)
+{
+  MFEM_VERIFY(interval >= 0, "Checkpoint interval for block Krylov-Schur eigensolver must "
+                             "be nonnegative!");
+  checkpoint_prefix = prefix;
+  checkpoint_it = interval;
+  checkpoint_restart = restart;
+  checkpoint_warn = warn;
+}
+
+void BlockKrylovSchurSolver::SetTol(double tol)
+{
+  rtol = tol;
+}
+
+void BlockKrylovSchurSolver::SetMaxIter(int max_it)
+{
+  restart_it = max_it;
+}
+
+void BlockKrylovSchurSolver::SetWhichEigenpairs(EigenvalueSolver::WhichType type)
+{
+  which_type = type;
+}
+
+void BlockKrylovSchurSolver::SetShiftInvert(std::complex<double> s, bool precond)
+{
+  MFEM_VERIFY(!precond, "Block Krylov-Schur eigenvalue solver does not support "
+                        "preconditioned spectral transformation option!");
+  sigma = s;
+  sinvert = true;
+}
+
+void BlockKrylovSchurSolver::SetInitialSpace(const ComplexVector &v)
+{
+  MFEM_VERIFY(n > 0, "Must call SetOperators before using SetInitialSpace for block "
+                     "Krylov-Schur eigenvalue solver!");
+  MFEM_VERIFY(v.Size() == n, "Invalid size mismatch for provided initial space vector!");
+  v0.resize(1);
+  v0[0].SetSize(n);
+  v0[0].UseDevice(true);
+  v0[0] = v;
+}
+
+void BlockKrylovSchurSolver::SetInitialSpace(const std::vector<ComplexVector> &V)
+{
+  MFEM_VERIFY(n > 0, "Must call SetOperators before using SetInitialSpace for block "
+                     "Krylov-Schur eigenvalue solver!");
+  v0.resize(std::min(static_cast<int>(V.size()), block_size));
+  for (std::size_t i = 0; i < V.size(); i++)
+  {
+    MFEM_VERIFY(V[i].Size() == n,
+                "Invalid size mismatch for provided initial space vector!");
+    auto &v = v0[i % v0.size()];
+    if (i < v0.size())
+    {
+      v.SetSize(n);
+      v.UseDevice(true);
+      v = V[i];
+    }
+    else
+    {
+      v.Add(1.0, V[i]);
+    }
+  }
+}
+
+void BlockKrylovSchurSolver::ApplyOp(int j)
+{
+  // For linear problems:
+  // Case 1: No spectral transformation (opInv = M⁻¹)
+  //               y = M⁻¹ K x .
+  // Case 2: Shift-and-invert spectral transformation (opInv = (K - σ M)⁻¹)
+  //               y = (K - σ M)⁻¹ M x .
+  // For quadratic problems, with the linearization of ArpackPEPSolver:
+  // Case 1: No spectral transformation (opInv = M⁻¹)
+  //               y = L₁⁻¹ L₀ x .
+  // Case 2: Shift-and-invert spectral transformation (opInv = P(σ)⁻¹)
+  //               y = (L₀ - σ L₁)⁻¹ L₁ x .
+  // The right-hand sides for the whole block are formed first, and the linear solves for
+  // the block are performed together.
+  const int b = block_size;
+  if (static_cast<int>(Z.size()) != b || Z[0].Size() != n)
+  {
+    Z.resize(b);
+    Y.resize(b);
+    for (int l = 0; l < b; l++)
+    {
+      Z[l].SetSize(n);
+      Y[l].SetSize(n);
+      Z[l].UseDevice(true);
+      Y[l].UseDevice(true);
+    }
+  }
+  ComplexVector x1, x2, y1, y2;
+  for (int l = 0; l < b; l++)
+  {
+    if (!opC)
+    {
+      (sinvert ? opM : opK)->Mult(V[j + l], Z[l]);
+    }
+    else
+    {
+      GetBlockRef(V[j + l], 0, n, x1);
+      GetBlockRef(V[j + l], 1, n, x2);
+      if (!sinvert)
+      {
+        opK->Mult(x1, Z[l]);
+        opC->AddMult(x2, Z[l], std::complex<double>(gamma, 0.0));
+      }
+      else
+      {
+        z1.AXPBYPCZ(sigma, x1, gamma, x2, 0.0);
+        opM->Mult(z1, Z[l]);
+        opC->AddMult(x1, Z[l], std::complex<double>(1.0, 0.0));
+      }
+    }
+  }
+  opInv->ArrayMult(Z, Y);
+  for (int l = 0; l < b; l++)
+  {
+    ComplexVector &y = V[j + b + l];
+    if (!opC)
+    {
+      y = Y[l];
+      y *= sinvert ? gamma : 1.0 / gamma;
+      Project(y);
+      continue;
+    }
+    GetBlockRef(V[j + l], 0, n, x1);
+    GetBlockRef(V[j + l], 1, n, x2);
+    GetBlockRef(y, 0, n, y1);
+    GetBlockRef(y, 1, n, y2);
+    if (!sinvert)
+    {
+      y1 = x2;
+      y2 = Y[l];
+      y2 *= -1.0 / (gamma * gamma);
+      Project(y);
+    }
+    else
+    {
+      y1 = Y[l];
+      y1 *= -gamma;
+      if (opProj)
+      {
+        opProj->Mult(y1);
+      }
+      y2.AXPBYPCZ(sigma / gamma, y1, 1.0, x1, 0.0);
+      if (opProj)
+      {
+        opProj->Mult(y2);
+      }
+    }
+  }
+}
+
+void BlockKrylovSchurSolver::ApplyB(const ComplexVector &x, ComplexVector &y) const
+{
+  ComplexVector xb, yb;
+  for (int i = 0; i < (opC ? 2 : 1); i++)
+  {
+    GetBlockRef(x, i, n, xb);
+    GetBlockRef(y, i, n, yb);
+    opB->Mult(xb.Real(), yb.Real());
+    opB->Mult(xb.Imag(), yb.Imag());
+  }
+}
+
+void BlockKrylovSchurSolver::Project(ComplexVector &x) const
+{
+  if (!opProj)
+  {
+    return;
+  }
+  ComplexVector xb;
+  for (int i = 0; i < (opC ? 2 : 1); i++)
+  {
+    GetBlockRef(x, i, n, xb);
+    opProj->Mult(xb);
+  }
+}
+
+void BlockKrylovSchurSolver::OrthonormalizeBlock(int k, Eigen::MatrixXcd &R)
+{
+  // Block classical Gram-Schmidt with reorthogonalization against the existing basis, where
+  // the inner products for all vectors of the block are computed with a single global
+  // reduction per pass. Inner products use the B-matrix when set: (x, y)_B = yᴴ B x.
+  const int b = block_size;
+  R = Eigen::MatrixXcd::Zero(k + b, b);
+  if (k > 0)
+  {
+    Eigen::MatrixXcd D(k, b);
+    for (int pass = 0; pass < 2; pass++)
+    {
+      for (int l = 0; l < b; l++)
+      {
+        for (int i = 0; i < k; i++)
+        {
+          D(i, l) = linalg::LocalDot(V[k + l], GetBV(i));
+        }
+      }
+      Mpi::GlobalSum(k * b, D.data(), comm);
+      for (int l = 0; l < b; l++)
+      {
+        for (int i = 0; i < k; i++)
+        {
+          V[k + l].Add(-D(i, l), V[i]);
+        }
+      }
+      R.topRows(k) += D;
+    }
+  }
+
+  // Orthonormalize the vectors within the block. On breakdown (the new vector lies in the
+  // span of the existing basis), the vector is replaced with a random one.
+  auto Orthogonalize = [this](int start, int end, ComplexVector &w)
+  {
+    Eigen::VectorXcd h = Eigen::VectorXcd::Zero(end - start);
+    if (end > start)
+    {
+      Eigen::VectorXcd d(end - start);
+      for (int pass = 0; pass < 2; pass++)
+      {
+        for (int j = start; j < end; j++)
+        {
+          d(j - start) = linalg::LocalDot(w, GetBV(j));
+        }
+        Mpi::GlobalSum(end - start, d.data(), comm);
+        for (int j = start; j < end; j++)
+        {
+          w.Add(-d(j - start), V[j]);
+        }
+        h += d;
+      }
+    }
+    return h;
+  };
+  auto Normalize = [this](int j)
+  {
+    if (opB)
+    {
+      ApplyB(V[j], BV[j]);
+    }
+    std::complex<double> dot = linalg::LocalDot(V[j], GetBV(j));
+    Mpi::GlobalSum(1, &dot, comm);
+    const double norm = std::sqrt(std::abs(dot.real()));
+    if (norm > 0.0)
+    {
+      V[j] *= 1.0 / norm;
+      if (opB)
+      {
+        BV[j] *= 1.0 / norm;
+      }
+    }
+    return norm;
+  };
+  for (int l = 0; l < b; l++)
+  {
+    R.block(k, l, l, 1) = Orthogonalize(k, k + l, V[k + l]);
+    const double norm = Normalize(k + l);
+    if (norm > 1.0e-12 * R.col(l).norm())
+    {
+      R(k + l, l) = norm;
+    }
+    else
+    {
+      linalg::SetRandom(comm, V[k + l], 1 + Mpi::Rank(comm) + Mpi::Size(comm) * seed++);
+      Project(V[k + l]);
+      Orthogonalize(0, k + l, V[k + l]);
+      Normalize(k + l);
+      R(k + l, l) = 0.0;
+    }
+  }
+}
+
+std::complex<double>
+BlockKrylovSchurSolver::GetOriginalEigenvalue(std::complex<double> theta) const
+{
+  return sinvert ? sigma + gamma / theta : gamma * theta;
+}
+
+std::vector<int>
+BlockKrylovSchurSolver::SortEigenvalues(const Eigen::VectorXcd &theta) const
+{
+  // Sort in ascending order of a key such that the desired eigenvalues come first.
+  std::vector<double> key(theta.size());
+  for (int i = 0; i < theta.size(); i++)
+  {
+    const std::complex<double> t = theta(i);
+    switch (which_type)
+    {
+      case WhichType::LARGEST_MAGNITUDE:
+        key[i] = -std::abs(t);
+        break;
+      case WhichType::SMALLEST_MAGNITUDE:
+        key[i] = std::abs(t);
+        break;
+      case WhichType::LARGEST_REAL:
+        key[i] = -t.real();
+        break;
+      case WhichType::SMALLEST_REAL:
+        key[i] = t.real();
+        break;
+      case WhichType::LARGEST_IMAGINARY:
+        key[i] = -t.imag();
+        break;
+      case WhichType::SMALLEST_IMAGINARY:
+        key[i] = t.imag();
+        break;
+      case WhichType::TARGET_MAGNITUDE:
+      case WhichType::TARGET_REAL:
+      case WhichType::TARGET_IMAGINARY:
+        if (sinvert && t == 0.0)
+        {
+          key[i] = std::numeric_limits<double>::infinity();
+        }
+        else
+        {
+          const std::complex<double> d = GetOriginalEigenvalue(t) - sigma;
+          key[i] = (which_type == WhichType::TARGET_MAGNITUDE) ? std::abs(d)
+                   : (which_type == WhichType::TARGET_REAL)    ? std::abs(d.real())
+                                                                : std::abs(d.imag());
+        }
+        break;
+    }
+  }
+  std::vector<int> perm(theta.size());
+  std::iota(perm.begin(), perm.end(), 0);
+  std::stable_sort(perm.begin(), perm.end(),
+                   [&key](int l, int r) { return key[l] < key[r]; });
+  return perm;
+}
+
+int BlockKrylovSchurSolver::Solve()
+{
+  MFEM_VERIFY(n > 0, "Operators are not set for block Krylov-Schur eigenvalue solver!");
+  MFEM_VERIFY(nev > 0, "Number of requested modes is not positive!");
+  MFEM_VERIFY(rtol > 0.0, "Eigensolver tolerance is not positive!");
+  MFEM_VERIFY(opInv, "No linear solver provided for operator!");
+
+  // The subspace dimension is a multiple of the block size, large enough to retain the
+  // desired eigenpairs plus at least one block for expansion after each restart. Restarts
+  // retain about half of the subspace (default maximum number of restarts from SLEPc).
+  const int b = block_size, nl = GetBasisSize();
+  const HYPRE_BigInt N = (opC ? 2 : 1) * linalg::GlobalSize(comm, z1);
+  const int m = b * ((std::max(ncv, nev + 2 * b) + b - 1) / b);
+  MFEM_VERIFY(m + b <= N, "Block Krylov-Schur subspace dimension exceeds problem size!");
+  const int keep = std::min(m - b, b * std::max((nev + b - 1) / b, m / (2 * b)));
+  const int max_it =
+      (restart_it > 0) ? restart_it : std::max(300, mfem::internal::to_int(2 * N / m));
+
+  // Allocate the Krylov basis and set up the initial block, from the user-provided initial
+  // vector if available and random vectors otherwise.
+  V.resize(m + b);
+  BV.resize(opB ? m + b : 0);
+  for (auto &v : V)
+  {
+    v.SetSize(nl);
+    v.UseDevice(true);
+  }
+  for (auto &v : BV)
+  {
+    v.SetSize(nl);
+    v.UseDevice(true);
+  }
+  Eigen::MatrixXcd H = Eigen::MatrixXcd::Zero(m + b, m), R;
+  int k = 0, it = 0, num_conv = 0, n_locked = 0;
+  if (checkpoint_restart && ReadCheckpoint(H, k, it, n_locked))
+  {
+    Mpi::Print(comm,
+               " Resuming block Krylov-Schur eigensolve from checkpoint at restart {:d} "
+               "({:d} locked eigenpairs)\n",
+               it, n_locked);
+  }
+  else
+  {
+    H.setZero();
+    k = it = n_locked = 0;
+    for (int l = 0; l < b; l++)
+    {
+      if (l < static_cast<int>(v0.size()))
+      {
+        // For quadratic problems, the initial vector is [v₀; 0].
+        ComplexVector v1;
+        GetBlockRef(V[l], 0, n, v1);
+        V[l] = 0.0;
+        v1 = v0[l];
+      }
+      else
+      {
+        linalg::SetRandom(comm, V[l], 1 + Mpi::Rank(comm) + Mpi::Size(comm) * seed++);
+        Project(V[l]);
+      }
+    }
+    OrthonormalizeBlock(0, R);
+  }
+
+  // Krylov-Schur iteration. The Krylov decomposition T V_k = V_{k+b} H_{k+b,k} for the
+  // transformed operator T is expanded a block at a time up to the full subspace dimension,
+  // followed by a Rayleigh-Ritz step and a restart with the Schur vectors corresponding to
+  // the desired Ritz values.
+  while (true)
+  {
+    for (; k < m; k += b)
+    {
+      ApplyOp(k);
+      OrthonormalizeBlock(k + b, R);
+      H.block(0, k, k + 2 * b, b) = R;
+    }
+    it++;
+
+    // Compute the Ritz pairs and check convergence of the desired ones, in order. The
+    // residual norm for the Ritz vector x = V_m y is ||T x - θ x||_B = ||H_{m+b,m} y||₂
+    // (with the last block of rows of H).
+    const Eigen::MatrixXcd Hm = H.topRows(m);
+    Eigen::ComplexEigenSolver<Eigen::MatrixXcd> eps(Hm);
+    const Eigen::VectorXcd &theta = eps.eigenvalues();
+    const std::vector<int> perm = SortEigenvalues(theta);
+    num_conv = 0;
+    for (int i = 0; i < nev; i++)
+    {
+      const int j = perm[i];
+      const double r = (H.bottomRows(b) * eps.eigenvectors().col(j).normalized()).norm();
+      if (r > rtol * std::abs(theta(j)))
+      {
+        break;
+      }
+      num_conv++;
+    }
+    if (print > 1)
+    {
+      Mpi::Print(comm,
+                 " Block Krylov-Schur restart {:d}: {:d} converged eigenpairs ({:d} "
+                 "locked)\n",
+                 it, num_conv, n_locked);
+    }
+    if (num_conv >= nev || it >= max_it)
+    {
+      if (checkpoint_it > 0)
+      {
+        WriteCheckpoint(H, m, it, n_locked);
+      }
+
+      // Form the Ritz vectors for the desired eigenpairs. For quadratic problems, the
+      // eigenvector is the first block x₁ of the linearized eigenvector y = [x₁; x₂].
+      eig.resize(nev);
+      X.resize(nev);
+      ComplexVector v1;
+      for (int i = 0; i < nev; i++)
+      {
+        const int j = perm[i];
+        const Eigen::VectorXcd y = eps.eigenvectors().col(j).normalized();
+        eig[i] = GetOriginalEigenvalue(theta(j));
+        X[i].SetSize(n);
+        X[i].UseDevice(true);
+        X[i] = 0.0;
+        for (int c = 0; c < m; c++)
+        {
+          GetBlockRef(V[c], 0, n, v1);
+          X[i].Add(y(c), v1);
+        }
+      }
+      break;
+    }
+
+    // Restart: reorder the Schur form of the active (unlocked) part of the projected matrix
+    // so the desired Ritz values come first, and truncate the Krylov decomposition to the
+    // locked and leading active Schur vectors. The locked part of the projected matrix is
+    // upper triangular and decoupled from the residual block, so the locked Schur vectors
+    // and their Ritz values are not modified. The last block of basis vectors is retained
+    // to continue the expansion.
+    const int p = n_locked, ma = m - p, ka = keep - p;
+    Eigen::ComplexSchur<Eigen::MatrixXcd> schur(Hm.bottomRightCorner(ma, ma));
+    Eigen::MatrixXcd T = schur.matrixT(), Q = schur.matrixU();
+    {
+      std::vector<int> sel = SortEigenvalues(T.diagonal());
+      sel.resize(ka);
+      ReorderSchur(T, Q, sel);
+    }
+    auto Restart = [&](std::vector<ComplexVector> &U)
+    {
+      std::vector<ComplexVector> W(ka);
+      for (int i = 0; i < ka; i++)
+      {
+        W[i].SetSize(nl);
+        W[i].UseDevice(true);
+        W[i] = 0.0;
+        for (int c = 0; c < ma; c++)
+        {
+          W[i].Add(Q(c, i), U[p + c]);
+        }
+      }
+      for (int i = 0; i < ka; i++)
+      {
+        U[p + i] = W[i];
+      }
+      for (int l = 0; l < b; l++)
+      {
+        U[keep + l] = U[m + l];
+      }
+    };
+    Restart(V);
+    if (opB)
+    {
+      Restart(BV);
+    }
+    Eigen::MatrixXcd Hk = Eigen::MatrixXcd::Zero(m + b, m);
+    Hk.topLeftCorner(p, p) = H.topLeftCorner(p, p);
+    Hk.block(0, p, p, ka) = H.block(0, p, p, ma) * Q.leftCols(ka);
+    Hk.block(p, p, ka, ka) = T.topLeftCorner(ka, ka);
+    Hk.block(keep, p, b, ka) = H.bottomRows(b).rightCols(ma) * Q.leftCols(ka);
+
+    // Lock the leading converged Schur vectors by deflating their coupling to the residual
+    // block, which is below the convergence tolerance. These remain in the basis for
+    // orthogonalization but are excluded from subsequent restarts.
+    while (n_locked < std::min(num_conv, keep) &&
+           Hk.block(keep, n_locked, b, 1).norm() <=
+               rtol * std::abs(Hk(n_locked, n_locked)))
+    {
+      Hk.block(keep, n_locked, b, 1).setZero();
+      n_locked++;
+    }
+    H = std::move(Hk);
+    k = keep;
+    if (checkpoint_it > 0 && it % checkpoint_it == 0)
+    {
+      WriteCheckpoint(H, k, it, n_locked);
+    }
+  }
+
+  // Print some log information.
+  if (print > 0)
+  {
+    Mpi::Print(comm,
+               "\n Block Krylov-Schur eigensolve {} ({:d} eigenpairs); iterations {:d}\n"
+               " Total number of linear systems solved: {:d}\n"
+               " Total number of linear solver iterations: {:d}\n",
+               (num_conv >= nev) ? "converged" : "finished", num_conv, it,
+               opInv->NumTotalMult(), opInv->NumTotalMultIterations());
+  }
+  if (num_conv < nev)
+  {
+    Mpi::Warning(comm,
+                 "Block Krylov-Schur eigenvalue solver found only {:d} of requested {:d} "
+                 "eigenvalues!\n",
+                 num_conv, nev);
+  }
+
+  // Compute the eigenpair residuals.
+  RescaleEigenvectors(nev);
+
+  // Reset for next solve.
+  v0.clear();
+  return num_conv;
+}
+
+void BlockKrylovSchurSolver::WriteCheckpoint(const Eigen::MatrixXcd &H, int k, int it,
+                                             int n_locked) const
+{
+  // The checkpoint is written to a temporary file which then replaces the previous one, so
+  // an interrupted write does not invalidate an existing checkpoint.
+  const std::string file = fmt::format("{}{:06d}.bin", checkpoint_prefix, Mpi::Rank(comm));
+  const int nl = GetBasisSize();
+  {
+    std::ofstream fo(file + ".tmp", std::ios::binary);
+    const std::int64_t header[] = {CHECKPOINT_VERSION, Mpi::Size(comm), nl,     H.rows(),
+                                   H.cols(),           block_size,      nev,    k,
+                                   it,                 n_locked,        seed};
+    const double shift[] = {sigma.real(), sigma.imag()};
+    fo.write(reinterpret_cast<const char *>(header), sizeof(header));
+    fo.write(reinterpret_cast<const char *>(shift), sizeof(shift));
+    fo.write(reinterpret_cast<const char *>(H.data()),
+             H.size() * sizeof(std::complex<double>));
+    for (int j = 0; j < k + block_size; j++)
+    {
+      fo.write(reinterpret_cast<const char *>(V[j].Real().HostRead()), nl * sizeof(double));
+      fo.write(reinterpret_cast<const char *>(V[j].Imag().HostRead()), nl * sizeof(double));
+    }
+    MFEM_VERIFY(fo.good(), "Failed to write eigensolver checkpoint file " << file << "!");
+  }
+  std::filesystem::rename(file + ".tmp", file);
+  if (print > 1)
+  {
+    Mpi::Print(comm, " Wrote block Krylov-Schur checkpoint at restart {:d}\n", it);
+  }
+}
+
+bool BlockKrylovSchurSolver::ReadCheckpoint(Eigen::MatrixXcd &H, int &k, int &it,
+                                            int &n_locked)
+{
+  // All processes must find a checkpoint for the same problem, written at the same
+  // iteration.
+  const std::string file = fmt::format("{}{:06d}.bin", checkpoint_prefix, Mpi::Rank(comm));
+  const int nl = GetBasisSize();
+  std::ifstream fi(file, std::ios::binary);
+  std::int64_t header[11] = {0};
+  double shift[2] = {0.0, 0.0};
+  if (fi)
+  {
+    fi.read(reinterpret_cast<char *>(header), sizeof(header));
+    fi.read(reinterpret_cast<char *>(shift), sizeof(shift));
+  }
+  int valid = fi.good() && header[0] == CHECKPOINT_VERSION &&
+              header[1] == Mpi::Size(comm) && header[2] == nl && header[3] == H.rows() &&
+              header[4] == H.cols() && header[5] == block_size && header[6] == nev &&
+              shift[0] == sigma.real() && shift[1] == sigma.imag();
+  int it_min = valid ? static_cast<int>(header[8]) : -1, it_max = it_min;
+  Mpi::GlobalMin(1, &valid, comm);
+  Mpi::GlobalMin(1, &it_min, comm);
+  Mpi::GlobalMax(1, &it_max, comm);
+  if (!valid || it_min != it_max)
+  {
+    if (checkpoint_warn)
+    {
+      Mpi::Warning(comm, "No valid block Krylov-Schur checkpoint found, starting "
+                         "eigensolve from the initial space!\n");
+    }
+    return false;
+  }
+  k = static_cast<int>(header[7]);
+  it = static_cast<int>(header[8]);
+  n_locked = static_cast<int>(header[9]);
+  seed = static_cast<int>(header[10]);
+  fi.read(reinterpret_cast<char *>(H.data()), H.size() * sizeof(std::complex<double>));
+  for (int j = 0; j < k + block_size; j++)
+  {
+    fi.read(reinterpret_cast<char *>(V[j].Real().HostWrite()), nl * sizeof(double));
+    fi.read(reinterpret_cast<char *>(V[j].Imag().HostWrite()), nl * sizeof(double));
+    if (opB)
+    {
+      ApplyB(V[j], BV[j]);
+    }
+  }
+  valid = fi.good();
+  Mpi::GlobalMin(1, &valid, comm);
+  if (!valid)
+  {
+    Mpi::Warning(comm, "Failed to read block Krylov-Schur checkpoint, starting eigensolve "
+                       "from the initial space!\n");
+  }
+  return valid;
+}
+
+std::complex<double> BlockKrylovSchurSolver::GetEigenvalue(int i) const
+{
+  MFEM_VERIFY(i >= 0 && i < static_cast<int>(eig.size()),
+              "Out of range eigenpair requested (i = " << i << ", nev = " << nev << ")!");
+  return eig[i];
+}
+
+void BlockKrylovSchurSolver::GetEigenvector(int i, ComplexVector &x) const
+{
+  MFEM_VERIFY(i >= 0 && i < static_cast<int>(X.size()),
+              "Out of range eigenpair requested (i = " << i << ", nev = " << nev << ")!");
+  MFEM_VERIFY(x.Size() == n, "Invalid size mismatch for provided eigenvector!");
+  x = X[i];
+  if (xscale[i] > 0.0)
+  {
+    x *= xscale[i];
+  }
+}
+
+double BlockKrylovSchurSolver::GetEigenvectorNorm(const ComplexVector &x,
+                                                  ComplexVector &Bx) const
+{
+  if (opB)
+  {
+    return linalg::Norml2(comm, x, *opB, Bx);
+  }
+  else
+  {
+    return linalg::Norml2(comm, x);
+  }
+}
+
+double BlockKrylovSchurSolver::GetError(int i, EigenvalueSolver::ErrorType type) const
+{
+  MFEM_VERIFY(i >= 0 && i < static_cast<int>(res.size()),
+              "Out of range eigenpair requested (i = " << i << ", nev = " << nev << ")!");
+  switch (type)
+  {
+    case ErrorType::ABSOLUTE:
+      return res[i];
+    case ErrorType::RELATIVE:
+      return res[i] / std::abs(eig[i]);
+    case ErrorType::BACKWARD:
+      return res[i] / GetBackwardScaling(eig[i]);
+  }
+  return 0.0;
+}
+
+void BlockKrylovSchurSolver::RescaleEigenvectors(int num_eig)
+{
+  res.resize(num_eig);
+  xscale.resize(num_eig);
+  for (int i = 0; i < num_eig; i++)
+  {
+    xscale[i] = 1.0 / GetEigenvectorNorm(X[i], z1);
+    res[i] = GetResidualNorm(eig[i], X[i], z1) / linalg::Norml2(comm, X[i]);
+  }
+}
+
+double BlockKrylovSchurSolver::GetResidualNorm(std::complex<double> l,
+                                               const ComplexVector &x,
+                                               ComplexVector &r) const
+{
+  // Compute the i-th eigenpair residual: || (K - λ M) x ||₂ for eigenvalue λ, or
+  // || P(λ) x ||₂ = || (K + λ C + λ² M) x ||₂ for quadratic problems.
+  opK->Mult(x, r);
+  if (opC)
+  {
+    opC->AddMult(x, r, l);
+    opM->AddMult(x, r, l * l);
+  }
+  else
+  {
+    opM->AddMult(x, r, -l);
+  }
+  return linalg::Norml2(comm, r);
+}
+
+double BlockKrylovSchurSolver::GetBackwardScaling(std::complex<double> l) const
+{
+  // Make sure not to use norms from scaling as this can be confusing if they are different.
+  if (normK <= 0.0)
+  {
+    normK = linalg::SpectralNorm(comm, *opK, opK->IsReal());
+  }
+  if (normM <= 0.0)
+  {
+    normM = linalg::SpectralNorm(comm, *opM, opM->IsReal());
+  }
+  if (!opC)
+  {
+    return normK + std::abs(l) * normM;
+  }
+  if (normC <= 0.0)
+  {
+    normC = linalg::SpectralNorm(comm, *opC, opC->IsReal());
+  }
+  const double t = std::abs(l);
+  return normK + t * normC + t * t * normM;
+}
+
+}  // namespace palace
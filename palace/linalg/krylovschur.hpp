@@ -0,0 +1,232 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_LINALG_KRYLOV_SCHUR_HPP
+#define PALACE_LINALG_KRYLOV_SCHUR_HPP
+
+#include <complex>
+#include <string>
+#include <vector>
+#include <Eigen/Dense>
+#include <mpi.h>
+#include "linalg/eps.hpp"
+#include "linalg/ksp.hpp"
+#include "linalg/operator.hpp"
+#include "linalg/vector.hpp"
+
+namespace palace
+{
+
+//
+// Native block Krylov-Schur eigenvalue solver for generalized linear and quadratic
+// polynomial eigenvalue problems, operating directly on Palace vectors without an external
+// eigensolver library. The Krylov subspace is expanded a block of vectors at a time, with
+// the linear solves for each block performed together and the orthogonalization of each
+// new block against the basis performed using a single global reduction per Gram-Schmidt
+// pass. Restarts are performed by reordering the Schur form of the projected matrix, and
+// converged Schur vectors are locked and excluded from subsequent restarts.
+// Shift-and-invert spectral transformations are used to compute interior eigenvalues.
+// Quadratic problems are solved using the same linearization as ArpackPEPSolver.
+// Reference: Stewart, A Krylov-Schur algorithm for large eigenproblems, SIAM J. Matrix
+//            Anal. Appl. (2002).
+//            Zhou and Saad, Block Krylov-Schur method for large symmetric eigenvalue
+//            problems, Numer. Algorithms (2008).
+//
+class BlockKrylovSchurSolver : public EigenvalueSolver
+{
+private:
+  // MPI communicator associated with the solver operators and vectors.
+  MPI_Comm comm;
+
+  // Control print level for debugging.
+  int print;
+
+  // Number eigenvalues to be computed, subspace dimension, block size, and local problem
+  // size (the basis vectors have size 2n for quadratic problems).
+  int nev, ncv, block_size, n;
+
+  // Relative eigenvalue error convergence tolerance for the solver.
+  double rtol;
+
+  // Maximum number of restarts.
+  int restart_it;
+
+  // Specifies which part of the spectrum to search for.
+  EigenvalueSolver::WhichType which_type;
+
+  // Variables for scaling, from Higham et al., IJNME 2008.
+  double gamma, delta;
+
+  // Parameters defining the spectral transformation.
+  std::complex<double> sigma;
+  bool sinvert;
+
+  // References to matrices defining the generalized or quadratic eigenvalue problem (not
+  // owned). The damping matrix C is nullptr for linear problems.
+  const ComplexOperator *opK, *opC, *opM;
+
+  // Operator norms for scaling.
+  mutable double normK, normC, normM;
+
+  // Reference to linear solver used for operator action for M⁻¹ (with no spectral
+  // transformation) or (K - σ M)⁻¹ or P(σ)⁻¹ (with shift-and-invert) (not owned).
+  const ComplexKspSolver *opInv;
+
+  // Reference to solver for projecting an intermediate vector onto a divergence-free space
+  // (not owned).
+  const DivFreeSolver<ComplexVector> *opProj;
+
+  // Reference to matrix used for weighted inner products (not owned). May be nullptr, in
+  // which case identity is used.
+  const Operator *opB;
+
+  // Krylov basis vectors (including the residual block), and their products with the
+  // B-matrix when weighted inner products are used.
+  std::vector<ComplexVector> V, BV;
+
+  // Optional initial vectors for the solution subspace.
+  std::vector<ComplexVector> v0;
+
+  // Computed eigenvalues, eigenvectors, residual norms, and eigenvector scalings.
+  std::vector<std::complex<double>> eig;
+  std::vector<ComplexVector> X;
+  std::vector<double> res, xscale;
+
+  // Counter used to generate distinct random vectors.
+  int seed;
+
+  // Prefix for the rank-local checkpoint files, number of restarts between checkpoints of
+  // the Krylov decomposition, whether to resume from an existing checkpoint, and whether to
+  // warn when no valid checkpoint is found.
+  std::string checkpoint_prefix;
+  int checkpoint_it;
+  bool checkpoint_restart, checkpoint_warn;
+
+  // Workspace vectors for operator applications, including the right-hand sides and
+  // solutions for the block linear solves.
+  mutable ComplexVector z1;
+  mutable std::vector<ComplexVector> Z, Y;
+
+  // Size of the basis vectors.
+  int GetBasisSize() const { return opC ? 2 * n : n; }
+
+  // Apply the (spectrally transformed) operator to the block of basis vectors starting at
+  // index j, storing the result in the following block.
+  void ApplyOp(int j);
+
+  // Apply the B-matrix for weighted inner products to a basis vector (to each block of the
+  // linearized vector for quadratic problems).
+  void ApplyB(const ComplexVector &x, ComplexVector &y) const;
+
+  // Apply the divergence-free projection to a basis vector, if set.
+  void Project(ComplexVector &x) const;
+
+  // Return the B-matrix product of the j-th basis vector.
+  const ComplexVector &GetBV(int j) const { return opB ? BV[j] : V[j]; }
+
+  // Orthonormalize the block of basis vectors starting at index k against the first k basis
+  // vectors and among themselves. The orthogonalization coefficients for the block are
+  // returned in the k + b x b matrix R.
+  void OrthonormalizeBlock(int k, Eigen::MatrixXcd &R);
+
+  // Map an eigenvalue of the transformed operator to an eigenvalue of the original problem.
+  std::complex<double> GetOriginalEigenvalue(std::complex<double> theta) const;
+
+  // Sort the given eigenvalues of the transformed operator according to the desired part of
+  // the spectrum, returning the sorted indices.
+  std::vector<int> SortEigenvalues(const Eigen::VectorXcd &theta) const;
+
+  // Helper routine for computing the eigenvector normalization.
+  double GetEigenvectorNorm(const ComplexVector &x, ComplexVector &Bx) const;
+
+  // Helper routine for computing the eigenpair residual.
+  double GetResidualNorm(std::complex<double> l, const ComplexVector &x,
+                         ComplexVector &r) const;
+
+  // Helper routine for computing the backward error.
+  double GetBackwardScaling(std::complex<double> l) const;
+
+  // Write the Krylov decomposition with k basis vectors (plus the residual block) and the
+  // number of locked eigenpairs to the rank-local checkpoint file, or read it back. Reading
+  // returns false unless a valid checkpoint for the same problem is found on all processes.
+  void WriteCheckpoint(const Eigen::MatrixXcd &H, int k, int it, int n_locked) const;
+  bool ReadCheckpoint(Eigen::MatrixXcd &H, int &k, int &it, int &n_locked);
+
+public:
+  BlockKrylovSchurSolver(MPI_Comm comm, int print);
+
+  // Set operators for the generalized linear or quadratic polynomial eigenvalue problem.
+  void SetOperators(const ComplexOperator &K, const ComplexOperator &M,
+                    ScaleType type) override;
+  void SetOperators(const ComplexOperator &K, const ComplexOperator &C,
+                    const ComplexOperator &M, ScaleType type) override;
+
+  // The linear solver should be configured to compute the action of M⁻¹ (with no spectral
+  // transformation) or (K - σ M)⁻¹ (P(σ)⁻¹ = (K + σ C + σ² M)⁻¹ for quadratic problems).
+  void SetLinearSolver(const ComplexKspSolver &ksp) override;
+
+  // Set the projection operator for enforcing the divergence-free constraint.
+  void SetDivFreeProjector(const DivFreeSolver<ComplexVector> &divfree) override;
+
+  // Set optional B matrix used for weighted inner products. This must be set explicitly
+  // even for generalized problems, otherwise the identity will be used.
+  void SetBMat(const Operator &B) override;
+
+  // Get scaling factors used by the solver.
+  double GetScalingGamma() const override { return gamma; }
+  double GetScalingDelta() const override { return delta; }
+
+  // Set the number of required eigenmodes.
+  void SetNumModes(int num_eig, int num_vec = 0) override;
+
+  // Set the number of vectors in each block of the Krylov subspace expansion.
+  void SetBlockSize(int bs);
+
+  // Enable checkpointing of the Krylov decomposition to rank-local binary files with the
+  // given prefix every given number of restarts (0 to disable), and optionally resume the
+  // next solve from an existing checkpoint (with a warning if none is found, unless
+  // disabled).
+  void SetCheckpoint(const std::string &prefix, int interval, bool restart,
+                     bool warn = true);
+
+  // Set solver tolerance.
+  void SetTol(double tol) override;
+
+  // Set maximum number of restarts.
+  void SetMaxIter(int max_it) override;
+
+  // Set target spectrum for the eigensolver. When a spectral transformation is used, this
+  // applies to the spectrum of the shifted operator, except for the TARGET_* options which
+  // refer to the distance from the shift in the spectrum of the original problem.
+  void SetWhichEigenpairs(WhichType type) override;
+
+  // Set shift-and-invert spectral transformation.
+  void SetShiftInvert(std::complex<double> s, bool precond = false) override;
+
+  // Set an initial vector or block of vectors for the solution subspace. Vectors beyond the
+  // block size are added to the initial block columns.
+  void SetInitialSpace(const ComplexVector &v) override;
+  void SetInitialSpace(const std::vector<ComplexVector> &V) override;
+
+  // Solve the eigenvalue problem. Returns the number of converged eigenvalues.
+  int Solve() override;
+
+  // Get the corresponding eigenvalue.
+  std::complex<double> GetEigenvalue(int i) const override;
+
+  // Get the corresponding eigenvector. Eigenvectors are normalized such that ||x||₂ = 1,
+  // unless the B-matrix is set for weighted inner products.
+  void GetEigenvector(int i, ComplexVector &x) const override;
+
+  // Get the corresponding eigenpair error.
+  double GetError(int i, ErrorType type) const override;
+
+  // Re-normalize the given number of eigenvectors, for example if the matrix B for weighted
+  // inner products has changed. This does not perform re-orthogonalization with respect to
+  // the new matrix, only normalization.
+  void RescaleEigenvectors(int num_eig) override;
+};
+
+}  // namespace palace
+
+#endif  // PALACE_LINALG_KRYLOV_SCHUR_HPP
@@ -8,8 +8,10 @@
 #include "linalg/amg.hpp"
 #include "linalg/ams.hpp"
 #include "linalg/gmg.hpp"
+#include "linalg/gmrespoly.hpp"
 #include "linalg/jacobi.hpp"
 #include "linalg/mumps.hpp"
+#include "linalg/ras.hpp"
 #include "linalg/strumpack.hpp"
 #include "linalg/superlu.hpp"
 #include "utils/communication.hpp"
@@ -121,6 +123,7 @@ auto MakeWrapperSolver(U &&...args)
   constexpr bool save_assembled = !(false ||
 #if defined(MFEM_USE_SUPERLU)
                                     std::is_same<T, SuperLUSolver>::value ||
+                                    std::is_same<T, SuperLUMixedPrecisionSolver>::value ||
 #endif
 #if defined(MFEM_USE_STRUMPACK)
                                     std::is_same<T, StrumpackSolver>::value ||
@@ -128,7 +131,9 @@ auto MakeWrapperSolver(U &&...args)
 #endif
 #if defined(MFEM_USE_MUMPS)
                                     std::is_same<T, MumpsSolver>::value ||
+                                    std::is_same<T, MumpsMixedPrecisionSolver>::value ||
 #endif
+                                    std::is_same<T, RasSolver>::value ||
                                     false);
   return std::make_unique<MfemWrapperSolver<OperType>>(
       std::make_unique<T>(std::forward<U>(args)...), save_assembled);
@@ -165,6 +170,14 @@ ConfigurePreconditionerSolver(MPI_Comm comm, const IoData &iodata,
 #else
       MFEM_ABORT("Solver was not built with SuperLU_DIST support, please choose a "
                  "different solver!");
+#endif
+      break;
+    case config::LinearSolverData::Type::SUPERLU_MP:
+#if defined(MFEM_USE_SUPERLU)
+      pc = MakeWrapperSolver<OperType, SuperLUMixedPrecisionSolver>(comm, iodata, print);
+#else
+      MFEM_ABORT("Solver was not built with SuperLU_DIST support, please choose a "
+                 "different solver!");
 #endif
       break;
     case config::LinearSolverData::Type::STRUMPACK:
@@ -191,9 +204,24 @@ ConfigurePreconditionerSolver(MPI_Comm comm, const IoData &iodata,
           "Solver was not built with MUMPS support, please choose a different solver!");
 #endif
       break;
+    case config::LinearSolverData::Type::MUMPS_MP:
+#if defined(MFEM_USE_MUMPS)
+      pc = MakeWrapperSolver<OperType, MumpsMixedPrecisionSolver>(comm, iodata, print);
+#else
+      MFEM_ABORT(
+          "Solver was not built with MUMPS support, please choose a different solver!");
+#endif
+      break;
+    case config::LinearSolverData::Type::RAS:
+      pc = MakeWrapperSolver<OperType, RasSolver>(comm, iodata, print);
+      break;
     case config::LinearSolverData::Type::JACOBI:
       pc = std::make_unique<JacobiSmoother<OperType>>(comm);
       break;
+    case config::LinearSolverData::Type::GMRES_POLY:
+      pc = std::make_unique<GmresPolynomialSmoother<OperType>>(
+          comm, 1, iodata.solver.linear.gmres_poly_order);
+      break;
     case config::LinearSolverData::Type::DEFAULT:
       MFEM_ABORT("Unexpected solver type for preconditioner configuration!");
       break;
@@ -276,6 +304,13 @@ void BaseKspSolver<OperType>::SetOperators(const OperType &op, const OperType &p
   }
 }
 
+template <typename OperType>
+void BaseKspSolver<OperType>::SetOperator(const OperType &op)
+{
+  BlockTimer bt(Timer::KSP_SETUP, use_timer);
+  ksp->SetOperator(op);
+}
+
 template <typename OperType>
 void BaseKspSolver<OperType>::Mult(const VecType &x, VecType &y) const
 {
@@ -292,6 +327,23 @@ void BaseKspSolver<OperType>::Mult(const VecType &x, VecType &y) const
   ksp_mult_it += ksp->GetNumIterations();
 }
 
+template <typename OperType>
+void BaseKspSolver<OperType>::ArrayMult(const std::vector<VecType> &x,
+                                        std::vector<VecType> &y) const
+{
+  BlockTimer bt(Timer::KSP, use_timer);
+  ksp->ArrayMult(x, y);
+  if (!ksp->GetConverged())
+  {
+    Mpi::Warning(
+        ksp->GetComm(),
+        "Linear solver did not converge, norm(Ax-b)/norm(b) = {:.3e} (norm(b) = {:.3e})!\n",
+        ksp->GetFinalRes() / ksp->GetInitialRes(), ksp->GetInitialRes());
+  }
+  ksp_mult += static_cast<int>(x.size());
+  ksp_mult_it += ksp->GetNumTotalIterations();
+}
+
 template class BaseKspSolver<Operator>;
 template class BaseKspSolver<ComplexOperator>;
 
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <type_traits>
+#include <vector>
 #include "linalg/iterative.hpp"
 #include "linalg/operator.hpp"
 #include "linalg/solver.hpp"
@@ -52,7 +53,15 @@ public:
 
   void SetOperators(const OperType &op, const OperType &pc_op);
 
+  // Update the operator for the iterative solver while keeping the existing preconditioner
+  // (for example, to reuse a factorization computed for a nearby frequency).
+  void SetOperator(const OperType &op);
+
   void Mult(const VecType &x, VecType &y) const;
+
+  // Solve for a block of right-hand sides, where each right-hand side counts as a separate
+  // solve (with its own iterations) for the purpose of the solve statistics.
+  void ArrayMult(const std::vector<VecType> &x, std::vector<VecType> &y) const;
 };
 
 using KspSolver = BaseKspSolver<Operator>;
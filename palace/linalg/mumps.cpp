@@ -5,9 +5,30 @@
 
 #if defined(MFEM_USE_MUMPS)
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <smumps_c.h>
+#include "utils/communication.hpp"
+
 namespace palace
 {
 
+namespace
+{
+
+template <typename MumpsStruc>
+void CheckMumpsInfo(const MumpsStruc &id, const char *phase)
+{
+  // INFOG(1) < 0 signals an error, INFOG(2) holds additional information.
+  MFEM_VERIFY(id.infog[0] >= 0, "MUMPS returned error during " << phase << ": INFOG(1) = "
+                                                               << id.infog[0]
+                                                               << ", INFOG(2) = "
+                                                               << id.infog[1] << "!");
+}
+
+}  // namespace
+
 MumpsSolver::MumpsSolver(MPI_Comm comm, mfem::MUMPSSolver::MatType sym,
                          config::LinearSolverData::SymFactType reorder, double blr_tol,
                          int print)
@@ -48,6 +69,285 @@ MumpsSolver::MumpsSolver(MPI_Comm comm, mfem::MUMPSSolver::MatType sym,
   }
 }
 
+struct MumpsMixedPrecisionSolver::MumpsData
+{
+  // MUMPS instance (single precision, real arithmetic).
+  SMUMPS_STRUC_C id;
+
+  // Distributed matrix in coordinate format (1-based global indices), which MUMPS does not
+  // copy.
+  std::vector<MUMPS_INT> irn_loc, jcn_loc;
+  std::vector<float> a_loc;
+
+  // Global indices (1-based) of the local rows of the distributed right-hand side, and the
+  // distributed right-hand side and solution in single precision. The distribution of the
+  // solution is chosen by MUMPS during the factorization.
+  std::vector<MUMPS_INT> irhs_loc, isol_loc;
+  std::vector<float> rhs_loc, sol_loc;
+
+  // Offsets of the contiguous row ranges owned by each process.
+  std::vector<int> row_offsets;
+
+  // Whether or not an analysis phase has been performed for the current sparsity pattern.
+  bool analyzed = false;
+};
+
+MumpsMixedPrecisionSolver::MumpsMixedPrecisionSolver(
+    MPI_Comm comm, mfem::MUMPSSolver::MatType sym,
+    config::LinearSolverData::SymFactType reorder, double blr_tol, int print)
+  : mfem::Solver(), comm(comm), data(std::make_unique<MumpsData>())
+{
+  // Initialize the MUMPS instance, with the host process participating in the
+  // factorization and solve.
+  auto &id = data->id;
+  id.job = -1;
+  id.par = 1;
+  switch (sym)
+  {
+    case mfem::MUMPSSolver::UNSYMMETRIC:
+      id.sym = 0;
+      break;
+    case mfem::MUMPSSolver::SYMMETRIC_POSITIVE_DEFINITE:
+      id.sym = 1;
+      break;
+    case mfem::MUMPSSolver::SYMMETRIC_INDEFINITE:
+      id.sym = 2;
+      break;
+  }
+  id.comm_fortran = (MUMPS_INT)MPI_Comm_c2f(comm);
+  smumps_c(&id);
+  CheckMumpsInfo(id, "initialization");
+
+  // Configure the solver (ICNTL(I) = icntl[I - 1]).
+  id.icntl[0] = (print > 1) ? 6 : -1;  // Error message output stream
+  id.icntl[1] = (print > 1) ? 6 : -1;  // Diagnostic output stream
+  id.icntl[2] = (print > 1) ? 6 : -1;  // Global information output stream
+  id.icntl[3] = (print > 1) ? 2 : 0;   // Print level
+  id.icntl[4] = 0;                     // Assembled input matrix
+  id.icntl[17] = 3;                    // Distributed input matrix
+  id.icntl[19] = 10;                   // Dense distributed right-hand side
+  id.icntl[20] = 1;                    // Distributed solution
+  switch (reorder)
+  {
+    case config::LinearSolverData::SymFactType::METIS:
+      id.icntl[27] = 1;
+      id.icntl[6] = 5;
+      break;
+    case config::LinearSolverData::SymFactType::PARMETIS:
+      id.icntl[27] = 2;
+      id.icntl[28] = 2;
+      break;
+    case config::LinearSolverData::SymFactType::SCOTCH:
+      id.icntl[27] = 1;
+      id.icntl[6] = 3;
+      break;
+    case config::LinearSolverData::SymFactType::PTSCOTCH:
+      id.icntl[27] = 2;
+      id.icntl[28] = 1;
+      break;
+    case config::LinearSolverData::SymFactType::PORD:
+      id.icntl[27] = 1;
+      id.icntl[6] = 4;
+      break;
+    case config::LinearSolverData::SymFactType::AMD:
+    case config::LinearSolverData::SymFactType::RCM:
+      id.icntl[27] = 1;
+      id.icntl[6] = 0;
+      break;
+    case config::LinearSolverData::SymFactType::DEFAULT:
+      id.icntl[27] = 0;  // Should have good default
+      id.icntl[6] = 7;
+      break;
+  }
+  if (blr_tol > 0.0)
+  {
+    id.icntl[34] = 2;  // Activate BLR factorization
+    id.cntl[6] = static_cast<float>(blr_tol);
+  }
+}
+
+MumpsMixedPrecisionSolver::~MumpsMixedPrecisionSolver()
+{
+  data->id.job = -2;
+  smumps_c(&data->id);
+}
+
+void MumpsMixedPrecisionSolver::SetOperator(const Operator &op)
+{
+  // Convert the input operator to a distributed single precision matrix in coordinate
+  // format. This avoids using the communicator from the Hypre matrix in the case that the
+  // solver is constructed on a different communicator.
+  const auto *hA = dynamic_cast<const mfem::HypreParMatrix *>(&op);
+  MFEM_VERIFY(hA && hA->GetGlobalNumRows() == hA->GetGlobalNumCols(),
+              "MumpsMixedPrecisionSolver requires a square HypreParMatrix operator!");
+  auto *parcsr = (hypre_ParCSRMatrix *)const_cast<mfem::HypreParMatrix &>(*hA);
+  hypre_CSRMatrix *csr = hypre_MergeDiagAndOffd(parcsr);
+  hypre_CSRMatrixMigrate(csr, HYPRE_MEMORY_HOST);
+  HYPRE_BigInt glob_n = hypre_ParCSRMatrixGlobalNumRows(parcsr);
+  HYPRE_BigInt first_row = hypre_ParCSRMatrixFirstRowIndex(parcsr);
+  HYPRE_Int n_loc = hypre_CSRMatrixNumRows(csr);
+  HYPRE_Int *I = hypre_CSRMatrixI(csr);
+  HYPRE_BigInt *J = hypre_CSRMatrixBigJ(csr);
+  double *a_data = hypre_CSRMatrixData(csr);
+  MFEM_VERIFY(glob_n == (HYPRE_BigInt)(MUMPS_INT)glob_n,
+              "Overflow error for MumpsMixedPrecisionSolver matrix size!");
+
+  // For symmetric matrices MUMPS sums duplicate entries, so only the upper triangle is
+  // passed.
+  auto &id = data->id;
+  std::vector<MUMPS_INT> irn, jcn;
+  std::vector<float> a;
+  irn.reserve(I[n_loc]);
+  jcn.reserve(I[n_loc]);
+  a.reserve(I[n_loc]);
+  for (HYPRE_Int i = 0; i < n_loc; i++)
+  {
+    const HYPRE_BigInt row = first_row + i;
+    for (HYPRE_Int k = I[i]; k < I[i + 1]; k++)
+    {
+      if (id.sym != 0 && J[k] < row)
+      {
+        continue;
+      }
+      irn.push_back(static_cast<MUMPS_INT>(row + 1));
+      jcn.push_back(static_cast<MUMPS_INT>(J[k] + 1));
+      a.push_back(static_cast<float>(a_data[k]));
+    }
+  }
+  hypre_CSRMatrixDestroy(csr);
+
+  // The analysis phase (ordering and symbolic factorization) is only repeated if the
+  // sparsity pattern changes.
+  bool same_pattern = data->analyzed && id.n == (MUMPS_INT)glob_n &&
+                      irn == data->irn_loc && jcn == data->jcn_loc;
+  Mpi::GlobalAnd(1, &same_pattern, comm);
+  data->irn_loc = std::move(irn);
+  data->jcn_loc = std::move(jcn);
+  data->a_loc = std::move(a);
+  id.n = static_cast<MUMPS_INT>(glob_n);
+  id.nnz_loc = static_cast<MUMPS_INT8>(data->a_loc.size());
+  id.irn_loc = data->irn_loc.data();
+  id.jcn_loc = data->jcn_loc.data();
+  id.a_loc = data->a_loc.data();
+  if (!same_pattern)
+  {
+    id.job = 1;
+    smumps_c(&id);
+    CheckMumpsInfo(id, "analysis");
+    data->analyzed = true;
+  }
+  id.job = 2;
+  smumps_c(&id);
+  CheckMumpsInfo(id, "factorization");
+
+  // The right-hand side is passed in the row distribution of the matrix (rows are owned
+  // contiguously in rank order), while the size of the local part of the distributed
+  // solution is known after the factorization (INFO(23)).
+  const int size = Mpi::Size(comm);
+  int n_loc_int = static_cast<int>(n_loc);
+  data->row_offsets.assign(size + 1, 0);
+  MPI_Allgather(&n_loc_int, 1, MPI_INT, data->row_offsets.data() + 1, 1, MPI_INT, comm);
+  std::partial_sum(data->row_offsets.begin(), data->row_offsets.end(),
+                   data->row_offsets.begin());
+  data->irhs_loc.resize(n_loc_int);
+  std::iota(data->irhs_loc.begin(), data->irhs_loc.end(),
+            static_cast<MUMPS_INT>(first_row + 1));
+  data->isol_loc.resize(id.info[22]);
+  height = width = n_loc_int;
+}
+
+void MumpsMixedPrecisionSolver::Mult(const Vector &x, Vector &y) const
+{
+  mfem::Array<const Vector *> X(1);
+  mfem::Array<Vector *> Y(1);
+  X[0] = &x;
+  Y[0] = &y;
+  ArrayMult(X, Y);
+}
+
+void MumpsMixedPrecisionSolver::ArrayMult(const mfem::Array<const Vector *> &X,
+                                          mfem::Array<Vector *> &Y) const
+{
+  // Pass the local rows of the right-hand sides in single precision, solve, and send the
+  // entries of the distributed solution to the processes owning the corresponding rows.
+  MFEM_ASSERT(X.Size() == Y.Size(), "Invalid number of right-hand sides for MUMPS solve!");
+  auto &id = data->id;
+  const int nrhs = X.Size();
+  const int n_sol = static_cast<int>(data->isol_loc.size());
+  data->rhs_loc.resize(static_cast<std::size_t>(height) * nrhs);
+  data->sol_loc.resize(static_cast<std::size_t>(n_sol) * nrhs);
+  for (int j = 0; j < nrhs; j++)
+  {
+    const double *xj = X[j]->HostRead();
+    for (int i = 0; i < height; i++)
+    {
+      data->rhs_loc[j * height + i] = static_cast<float>(xj[i]);
+    }
+  }
+  id.nrhs = nrhs;
+  id.nloc_rhs = height;
+  id.lrhs_loc = height;
+  id.rhs_loc = data->rhs_loc.data();
+  id.irhs_loc = data->irhs_loc.data();
+  id.lsol_loc = n_sol;
+  id.sol_loc = data->sol_loc.data();
+  id.isol_loc = data->isol_loc.data();
+  id.job = 3;
+  smumps_c(&id);
+  CheckMumpsInfo(id, "solve");
+
+  // Redistribute the solution. Entries are packed by destination process along with their
+  // global row indices.
+  const auto &row_offsets = data->row_offsets;
+  const int size = Mpi::Size(comm);
+  std::vector<int> dest(n_sol), send_counts(size, 0), send_displs(size + 1, 0);
+  for (int k = 0; k < n_sol; k++)
+  {
+    const auto it =
+        std::upper_bound(row_offsets.begin(), row_offsets.end(), data->isol_loc[k] - 1);
+    dest[k] = static_cast<int>(it - row_offsets.begin()) - 1;
+    send_counts[dest[k]]++;
+  }
+  std::partial_sum(send_counts.begin(), send_counts.end(), send_displs.begin() + 1);
+  std::vector<int> send_idx(n_sol), offsets(send_displs.begin(), send_displs.end() - 1);
+  std::vector<float> send_vals(static_cast<std::size_t>(n_sol) * nrhs);
+  for (int k = 0; k < n_sol; k++)
+  {
+    const int pos = offsets[dest[k]]++;
+    send_idx[pos] = data->isol_loc[k] - 1 - row_offsets[dest[k]];
+    for (int j = 0; j < nrhs; j++)
+    {
+      send_vals[pos * nrhs + j] = data->sol_loc[j * n_sol + k];
+    }
+  }
+  std::vector<int> recv_counts(size), recv_displs(size + 1, 0);
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, comm);
+  std::partial_sum(recv_counts.begin(), recv_counts.end(), recv_displs.begin() + 1);
+  MFEM_ASSERT(recv_displs.back() == height,
+              "Unexpected size of distributed solution for MUMPS solve!");
+  std::vector<int> recv_idx(recv_displs.back());
+  std::vector<float> recv_vals(static_cast<std::size_t>(recv_displs.back()) * nrhs);
+  MPI_Alltoallv(send_idx.data(), send_counts.data(), send_displs.data(), MPI_INT,
+                recv_idx.data(), recv_counts.data(), recv_displs.data(), MPI_INT, comm);
+  for (int p = 0; p < size; p++)
+  {
+    send_counts[p] *= nrhs;
+    send_displs[p] *= nrhs;
+    recv_counts[p] *= nrhs;
+    recv_displs[p] *= nrhs;
+  }
+  MPI_Alltoallv(send_vals.data(), send_counts.data(), send_displs.data(), MPI_FLOAT,
+                recv_vals.data(), recv_counts.data(), recv_displs.data(), MPI_FLOAT, comm);
+  for (int j = 0; j < nrhs; j++)
+  {
+    double *yj = Y[j]->HostWrite();
+    for (std::size_t k = 0; k < recv_idx.size(); k++)
+    {
+      yj[recv_idx[k]] = static_cast<double>(recv_vals[k * nrhs + j]);
+    }
+  }
+}
+
 }  // namespace palace
 
 #endif
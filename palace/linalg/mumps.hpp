@@ -8,6 +8,9 @@
 
 #if defined(MFEM_USE_MUMPS)
 
+#include <memory>
+#include "linalg/operator.hpp"
+#include "linalg/vector.hpp"
 #include "utils/iodata.hpp"
 
 namespace palace
@@ -39,6 +42,54 @@ public:
   }
 };
 
+//
+// A wrapper for the MUMPS direct solver package which computes the factorization in single
+// precision, for use as a preconditioner where the outer Krylov solver recovers the double
+// precision accuracy. The right-hand side and solution are kept distributed for the solve
+// phase.
+//
+class MumpsMixedPrecisionSolver : public mfem::Solver
+{
+private:
+  MPI_Comm comm;
+
+  // MUMPS instance and the distributed matrix, right-hand side, and solution data, defined
+  // in the implementation to keep the MUMPS headers private.
+  struct MumpsData;
+  std::unique_ptr<MumpsData> data;
+
+public:
+  MumpsMixedPrecisionSolver(MPI_Comm comm, mfem::MUMPSSolver::MatType sym,
+                            config::LinearSolverData::SymFactType reorder, double blr_tol,
+                            int print);
+  MumpsMixedPrecisionSolver(MPI_Comm comm, const IoData &iodata, int print)
+    : MumpsMixedPrecisionSolver(
+          comm,
+          (iodata.solver.linear.pc_mat_shifted ||
+           iodata.problem.type == config::ProblemData::Type::TRANSIENT ||
+           iodata.problem.type == config::ProblemData::Type::ELECTROSTATIC ||
+           iodata.problem.type == config::ProblemData::Type::MAGNETOSTATIC)
+              ? mfem::MUMPSSolver::SYMMETRIC_POSITIVE_DEFINITE
+              : mfem::MUMPSSolver::SYMMETRIC_INDEFINITE,
+          iodata.solver.linear.sym_fact_type,
+          (iodata.solver.linear.strumpack_compression_type ==
+           config::LinearSolverData::CompressionType::BLR)
+              ? iodata.solver.linear.strumpack_lr_tol
+              : 0.0,
+          print)
+  {
+  }
+  MumpsMixedPrecisionSolver(const MumpsMixedPrecisionSolver &) = delete;
+  MumpsMixedPrecisionSolver &operator=(const MumpsMixedPrecisionSolver &) = delete;
+  ~MumpsMixedPrecisionSolver() override;
+
+  void SetOperator(const Operator &op) override;
+
+  void Mult(const Vector &x, Vector &y) const override;
+  void ArrayMult(const mfem::Array<const Vector *> &X,
+                 mfem::Array<Vector *> &Y) const override;
+};
+
 }  // namespace palace
 
 #endif
@@ -0,0 +1,401 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ras.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <unordered_map>
+#include "linalg/mumps.hpp"
+#include "linalg/strumpack.hpp"
+#include "linalg/superlu.hpp"
+#include "utils/communication.hpp"
+#include "utils/iodata.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+template <typename T>
+std::vector<T> ExchangeData(MPI_Comm comm, const std::vector<T> &send,
+                            const std::vector<int> &send_counts,
+                            std::vector<int> &recv_counts)
+{
+  // Exchange variable-length data between all processes, given the number of entries to
+  // send to each process (data is ordered by destination process).
+  const int size = Mpi::Size(comm);
+  recv_counts.resize(size);
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, comm);
+  std::vector<int> send_displs(size, 0), recv_displs(size, 0);
+  std::partial_sum(send_counts.begin(), send_counts.end() - 1, send_displs.begin() + 1);
+  std::partial_sum(recv_counts.begin(), recv_counts.end() - 1, recv_displs.begin() + 1);
+  std::vector<T> recv(recv_displs.back() + recv_counts.back());
+  MPI_Alltoallv(send.data(), send_counts.data(), send_displs.data(), mpi::DataType<T>(),
+                recv.data(), recv_counts.data(), recv_displs.data(), mpi::DataType<T>(),
+                comm);
+  return recv;
+}
+
+std::unique_ptr<mfem::Solver> ConfigureLocalSolver(const IoData &iodata, int print)
+{
+  // Subdomain problems are solved using a sparse direct solver on a single process.
+#if defined(MFEM_USE_MUMPS)
+  return std::make_unique<MumpsSolver>(MPI_COMM_SELF, iodata, print);
+#elif defined(MFEM_USE_SUPERLU)
+  return std::make_unique<SuperLUSolver>(MPI_COMM_SELF, iodata, print);
+#elif defined(MFEM_USE_STRUMPACK)
+  return std::make_unique<StrumpackSolver>(MPI_COMM_SELF, iodata, print);
+#else
+  MFEM_ABORT("RAS preconditioner requires building with MUMPS, SuperLU_DIST, or "
+             "STRUMPACK for the subdomain solves!");
+  return {};
+#endif
+}
+
+}  // namespace
+
+RasSolver::RasSolver(MPI_Comm comm, int overlap, double shift_coeff,
+                     std::unique_ptr<mfem::Solver> &&local_solver, int print)
+  : mfem::Solver(), comm(comm), overlap(overlap), shift_coeff(shift_coeff),
+    local_solver(std::move(local_solver)), n_loc(0), n_sub(0), print(print)
+{
+  MFEM_VERIFY(overlap >= 0, "RAS preconditioner requires a nonnegative overlap!");
+}
+
+RasSolver::RasSolver(MPI_Comm comm, const IoData &iodata, int print)
+  : RasSolver(comm, iodata.solver.linear.ras_overlap,
+              iodata.solver.linear.ras_interface_shift,
+              ConfigureLocalSolver(iodata, Mpi::Root(comm) ? print : 0), print)
+{
+}
+
+void RasSolver::SetOperator(const Operator &op)
+{
+  const auto *hA = dynamic_cast<const mfem::HypreParMatrix *>(&op);
+  MFEM_VERIFY(hA && hA->GetGlobalNumRows() == hA->GetGlobalNumCols(),
+              "RasSolver requires a square HypreParMatrix operator!");
+  auto *parcsr = (hypre_ParCSRMatrix *)const_cast<mfem::HypreParMatrix &>(*hA);
+  hypre_CSRMatrix *csr = hypre_MergeDiagAndOffd(parcsr);
+  hypre_CSRMatrixMigrate(csr, HYPRE_MEMORY_HOST);
+  const HYPRE_BigInt first_row = hypre_ParCSRMatrixFirstRowIndex(parcsr);
+  const HYPRE_Int *I = hypre_CSRMatrixI(csr);
+  const HYPRE_BigInt *J = hypre_CSRMatrixBigJ(csr);
+  const double *data = hypre_CSRMatrixData(csr);
+  n_loc = hypre_CSRMatrixNumRows(csr);
+
+  // Global row partitioning, for finding the owner of any unknown (rows are owned
+  // contiguously in rank order).
+  const int size = Mpi::Size(comm);
+  std::vector<HYPRE_BigInt> row_starts(size + 1);
+  MPI_Allgather(&first_row, 1, mpi::DataType<HYPRE_BigInt>(), row_starts.data(), 1,
+                mpi::DataType<HYPRE_BigInt>(), comm);
+  row_starts[size] = hypre_ParCSRMatrixGlobalNumRows(parcsr);
+  auto GetOwner = [&row_starts](HYPRE_BigInt g)
+  {
+    return static_cast<int>(std::upper_bound(row_starts.begin(), row_starts.end(), g) -
+                            row_starts.begin()) -
+           1;
+  };
+
+  // Ghost unknowns of the subdomain (numbered after the locally owned ones) and their
+  // matrix rows with global column indices.
+  std::vector<HYPRE_BigInt> ghosts;
+  std::unordered_map<HYPRE_BigInt, int> ghost_map;
+  std::vector<int> ext_I(1, 0);
+  std::vector<HYPRE_BigInt> ext_J;
+  std::vector<double> ext_data;
+  auto GetLocalIndex = [&](HYPRE_BigInt g)
+  {
+    if (g >= first_row && g < first_row + n_loc)
+    {
+      return static_cast<int>(g - first_row);
+    }
+    auto it = ghost_map.find(g);
+    return (it != ghost_map.end()) ? it->second : -1;
+  };
+  auto GetRow = [&](int i, const HYPRE_BigInt *&cols, const double *&vals)
+  {
+    if (i < n_loc)
+    {
+      cols = J + I[i];
+      vals = data + I[i];
+      return static_cast<int>(I[i + 1] - I[i]);
+    }
+    const int k = i - n_loc;
+    cols = ext_J.data() + ext_I[k];
+    vals = ext_data.data() + ext_I[k];
+    return ext_I[k + 1] - ext_I[k];
+  };
+
+  // Extend the subdomain by one layer of unknowns at a time through the matrix graph,
+  // fetching the matrix rows for the new ghost unknowns from their owners.
+  int frontier_begin = 0, frontier_end = n_loc;
+  for (int l = 0; l < overlap; l++)
+  {
+    std::vector<HYPRE_BigInt> new_ghosts;
+    for (int i = frontier_begin; i < frontier_end; i++)
+    {
+      const HYPRE_BigInt *cols;
+      const double *vals;
+      const int nnz = GetRow(i, cols, vals);
+      for (int k = 0; k < nnz; k++)
+      {
+        // New ghost unknowns are inserted with a placeholder index, numbered below.
+        if (GetLocalIndex(cols[k]) < 0 && ghost_map.emplace(cols[k], -1).second)
+        {
+          new_ghosts.push_back(cols[k]);
+        }
+      }
+    }
+
+    // Sorting by global index also sorts the requests by owner.
+    std::sort(new_ghosts.begin(), new_ghosts.end());
+    std::vector<int> req_counts(size, 0), recv_counts;
+    for (std::size_t k = 0; k < new_ghosts.size(); k++)
+    {
+      ghost_map[new_ghosts[k]] = n_loc + static_cast<int>(ghosts.size() + k);
+      req_counts[GetOwner(new_ghosts[k])]++;
+    }
+    ghosts.insert(ghosts.end(), new_ghosts.begin(), new_ghosts.end());
+    const auto requests = ExchangeData(comm, new_ghosts, req_counts, recv_counts);
+
+    // Respond with the requested rows (row lengths, then column indices and values).
+    std::vector<int> row_nnz(requests.size()), data_counts(size, 0), ghost_nnz_counts;
+    std::vector<HYPRE_BigInt> send_cols;
+    std::vector<double> send_vals;
+    for (int p = 0, k = 0; p < size; p++)
+    {
+      for (int m = 0; m < recv_counts[p]; m++, k++)
+      {
+        const int i = static_cast<int>(requests[k] - first_row);
+        MFEM_ASSERT(i >= 0 && i < n_loc, "Invalid row request for RAS subdomain setup!");
+        row_nnz[k] = static_cast<int>(I[i + 1] - I[i]);
+        data_counts[p] += row_nnz[k];
+        send_cols.insert(send_cols.end(), J + I[i], J + I[i + 1]);
+        send_vals.insert(send_vals.end(), data + I[i], data + I[i + 1]);
+      }
+    }
+    std::vector<int> dummy_counts;
+    const auto new_nnz = ExchangeData(comm, row_nnz, recv_counts, dummy_counts);
+    const auto new_cols = ExchangeData(comm, send_cols, data_counts, ghost_nnz_counts);
+    const auto new_vals = ExchangeData(comm, send_vals, data_counts, ghost_nnz_counts);
+    for (const auto nnz : new_nnz)
+    {
+      ext_I.push_back(ext_I.back() + nnz);
+    }
+    ext_J.insert(ext_J.end(), new_cols.begin(), new_cols.end());
+    ext_data.insert(ext_data.end(), new_vals.begin(), new_vals.end());
+
+    frontier_begin = frontier_end;
+    frontier_end += static_cast<int>(new_ghosts.size());
+  }
+  n_sub = n_loc + static_cast<int>(ghosts.size());
+
+  // Assemble the subdomain matrix. Couplings to unknowns outside of the subdomain are
+  // dropped and the diagonal is shifted (in the direction of its sign) by the scaled sum of
+  // the magnitudes of the dropped entries. This is a real diagonal heuristic, not an
+  // assembled iω/Z interface mass term.
+  std::vector<int> sub_I(n_sub + 1, 0), sub_J;
+  std::vector<double> sub_data;
+  sub_J.reserve(I[n_loc] + ext_I.back());
+  sub_data.reserve(I[n_loc] + ext_I.back());
+  for (int i = 0; i < n_sub; i++)
+  {
+    const HYPRE_BigInt *cols;
+    const double *vals;
+    const int nnz = GetRow(i, cols, vals);
+    int diag = -1;
+    double shift = 0.0;
+    for (int k = 0; k < nnz; k++)
+    {
+      const int j = GetLocalIndex(cols[k]);
+      if (j < 0)
+      {
+        shift += std::abs(vals[k]);
+        continue;
+      }
+      if (j == i)
+      {
+        diag = static_cast<int>(sub_J.size());
+      }
+      sub_J.push_back(j);
+      sub_data.push_back(vals[k]);
+    }
+    if (diag < 0)
+    {
+      diag = static_cast<int>(sub_J.size());
+      sub_J.push_back(i);
+      sub_data.push_back(0.0);
+    }
+    sub_data[diag] += std::copysign(shift_coeff * shift, sub_data[diag]);
+    sub_I[i + 1] = static_cast<int>(sub_J.size());
+  }
+  hypre_CSRMatrixDestroy(csr);
+
+  // Factor the subdomain matrix (the sparse direct solvers copy their input).
+  {
+    mfem::SparseMatrix A_sub(sub_I.data(), sub_J.data(), sub_data.data(), n_sub, n_sub,
+                             false, false, false);
+    HYPRE_BigInt sub_row_starts[2] = {0, n_sub};
+    mfem::HypreParMatrix hA_sub(MPI_COMM_SELF, n_sub, sub_row_starts, &A_sub);
+    local_solver->SetOperator(hA_sub);
+  }
+
+  // Set up the communication pattern for the ghost unknowns, grouped by owner.
+  std::vector<int> ghost_owner(ghosts.size());
+  std::vector<int> perm(ghosts.size());
+  for (std::size_t k = 0; k < ghosts.size(); k++)
+  {
+    ghost_owner[k] = GetOwner(ghosts[k]);
+    perm[k] = static_cast<int>(k);
+  }
+  std::stable_sort(perm.begin(), perm.end(), [&ghost_owner](int a, int b)
+                   { return ghost_owner[a] < ghost_owner[b]; });
+  std::vector<HYPRE_BigInt> req(ghosts.size());
+  std::vector<int> req_counts(size, 0), send_counts;
+  recv_ranks.clear();
+  recv_offsets.assign(1, 0);
+  recv_idx.resize(ghosts.size());
+  for (std::size_t k = 0; k < ghosts.size(); k++)
+  {
+    req[k] = ghosts[perm[k]];
+    recv_idx[k] = n_loc + perm[k];
+    req_counts[ghost_owner[perm[k]]]++;
+  }
+  for (int p = 0; p < size; p++)
+  {
+    if (req_counts[p] > 0)
+    {
+      recv_ranks.push_back(p);
+      recv_offsets.push_back(recv_offsets.back() + req_counts[p]);
+    }
+  }
+  const auto send_rows = ExchangeData(comm, req, req_counts, send_counts);
+  send_ranks.clear();
+  send_offsets.assign(1, 0);
+  send_idx.resize(send_rows.size());
+  for (std::size_t k = 0; k < send_rows.size(); k++)
+  {
+    send_idx[k] = static_cast<int>(send_rows[k] - first_row);
+  }
+  for (int p = 0; p < size; p++)
+  {
+    if (send_counts[p] > 0)
+    {
+      send_ranks.push_back(p);
+      send_offsets.push_back(send_offsets.back() + send_counts[p]);
+    }
+  }
+
+  if (print > 0)
+  {
+    HYPRE_BigInt sizes[2] = {n_sub, n_sub};
+    Mpi::GlobalSum(1, &sizes[0], comm);
+    Mpi::GlobalMax(1, &sizes[1], comm);
+    Mpi::Print(comm,
+               " RAS: {:d} subdomains with overlap {:d} (avg. size = {:d}, max. size = "
+               "{:d}, overlap ratio = {:.3f})\n",
+               size, overlap, sizes[0] / size, sizes[1],
+               static_cast<double>(sizes[0]) / row_starts[size]);
+  }
+
+  height = width = n_loc;
+}
+
+void RasSolver::Mult(const Vector &x, Vector &y) const
+{
+  mfem::Array<const Vector *> X(1);
+  mfem::Array<Vector *> Y(1);
+  X[0] = &x;
+  Y[0] = &y;
+  ArrayMult(X, Y);
+}
+
+void RasSolver::ArrayMult(const mfem::Array<const Vector *> &X,
+                          mfem::Array<Vector *> &Y) const
+{
+  MFEM_ASSERT(X.Size() == Y.Size(), "Invalid number of right-hand sides for RAS solve!");
+  const int nrhs = X.Size();
+  if (static_cast<int>(xs.size()) != nrhs || (nrhs > 0 && xs[0].Size() != n_sub))
+  {
+    xs.resize(nrhs);
+    ys.resize(nrhs);
+    for (int j = 0; j < nrhs; j++)
+    {
+      xs[j].SetSize(n_sub);
+      ys[j].SetSize(n_sub);
+    }
+  }
+
+  // Restrict the right-hand sides to the subdomain, communicating the ghost values.
+  send_buf.resize(send_idx.size() * nrhs);
+  recv_buf.resize(recv_idx.size() * nrhs);
+  for (std::size_t p = 0; p < send_ranks.size(); p++)
+  {
+    const int count = send_offsets[p + 1] - send_offsets[p];
+    double *buf = send_buf.data() + send_offsets[p] * nrhs;
+    for (int j = 0; j < nrhs; j++)
+    {
+      const double *xj = X[j]->HostRead();
+      for (int k = 0; k < count; k++)
+      {
+        buf[j * count + k] = xj[send_idx[send_offsets[p] + k]];
+      }
+    }
+  }
+  std::vector<MPI_Request> reqs(send_ranks.size() + recv_ranks.size());
+  for (std::size_t p = 0; p < recv_ranks.size(); p++)
+  {
+    const int count = recv_offsets[p + 1] - recv_offsets[p];
+    MPI_Irecv(recv_buf.data() + recv_offsets[p] * nrhs, count * nrhs, MPI_DOUBLE,
+              recv_ranks[p], 0, comm, &reqs[p]);
+  }
+  for (std::size_t p = 0; p < send_ranks.size(); p++)
+  {
+    const int count = send_offsets[p + 1] - send_offsets[p];
+    MPI_Isend(send_buf.data() + send_offsets[p] * nrhs, count * nrhs, MPI_DOUBLE,
+              send_ranks[p], 0, comm, &reqs[recv_ranks.size() + p]);
+  }
+  for (int j = 0; j < nrhs; j++)
+  {
+    const double *xj = X[j]->HostRead();
+    double *xsj = xs[j].HostWrite();
+    std::copy(xj, xj + n_loc, xsj);
+  }
+  MPI_Waitall(static_cast<int>(reqs.size()), reqs.data(), MPI_STATUSES_IGNORE);
+  for (std::size_t p = 0; p < recv_ranks.size(); p++)
+  {
+    const int count = recv_offsets[p + 1] - recv_offsets[p];
+    const double *buf = recv_buf.data() + recv_offsets[p] * nrhs;
+    for (int j = 0; j < nrhs; j++)
+    {
+      double *xsj = xs[j].HostReadWrite();
+      for (int k = 0; k < count; k++)
+      {
+        xsj[recv_idx[recv_offsets[p] + k]] = buf[j * count + k];
+      }
+    }
+  }
+
+  // Solve the subdomain problems and restrict the solutions to the locally owned unknowns
+  // (no summation over the overlap).
+  mfem::Array<const Vector *> Xs(nrhs);
+  mfem::Array<Vector *> Ys(nrhs);
+  for (int j = 0; j < nrhs; j++)
+  {
+    Xs[j] = &xs[j];
+    Ys[j] = &ys[j];
+  }
+  local_solver->ArrayMult(Xs, Ys);
+  for (int j = 0; j < nrhs; j++)
+  {
+    const double *ysj = ys[j].HostRead();
+    double *yj = Y[j]->HostWrite();
+    std::copy(ysj, ysj + n_loc, yj);
+  }
+}
+
+}  // namespace palace
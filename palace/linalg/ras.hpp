@@ -0,0 +1,73 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_LINALG_RAS_HPP
+#define PALACE_LINALG_RAS_HPP
+
+#include <memory>
+#include <vector>
+#include <mfem.hpp>
+#include "linalg/operator.hpp"
+#include "linalg/vector.hpp"
+
+namespace palace
+{
+
+class IoData;
+
+//
+// Restricted additive Schwarz (RAS) domain decomposition preconditioner. Each process owns
+// one subdomain, consisting of its locally owned rows of the assembled operator extended by
+// a given number of layers of overlap through the matrix graph. The subdomain problems drop
+// the couplings across the overlap boundary and add a real algebraic diagonal shift to the
+// boundary rows in their place (this is not an impedance transmission condition, so the
+// method is not an optimized Schwarz method), and are solved using a sparse direct solver
+// on MPI_COMM_SELF. The subdomain solutions are combined without weighting by
+// restriction to the locally owned rows.
+//
+class RasSolver : public mfem::Solver
+{
+private:
+  MPI_Comm comm;
+
+  // Number of layers of overlap and scaling coefficient for the interface diagonal shift
+  // (the diagonal of each row on the subdomain boundary is augmented by this coefficient
+  // times the sum of the magnitudes of the couplings to unknowns outside of the
+  // subdomain).
+  int overlap;
+  double shift_coeff;
+
+  // Sparse direct solver for the local subdomain problem.
+  std::unique_ptr<mfem::Solver> local_solver;
+
+  // Communication pattern for gathering values at the ghost unknowns of the subdomain:
+  // for each neighboring process, the local indices of owned unknowns to send and the
+  // subdomain indices of ghost unknowns to receive.
+  std::vector<int> send_ranks, send_offsets, send_idx;
+  std::vector<int> recv_ranks, recv_offsets, recv_idx;
+
+  // Temporary storage for the subdomain vectors and communication buffers.
+  mutable std::vector<Vector> xs, ys;
+  mutable std::vector<double> send_buf, recv_buf;
+
+  // Number of locally owned and total subdomain unknowns.
+  int n_loc, n_sub;
+
+  // Print level for setup statistics.
+  int print;
+
+public:
+  RasSolver(MPI_Comm comm, int overlap, double shift_coeff,
+            std::unique_ptr<mfem::Solver> &&local_solver, int print);
+  RasSolver(MPI_Comm comm, const IoData &iodata, int print);
+
+  void SetOperator(const Operator &op) override;
+
+  void Mult(const Vector &x, Vector &y) const override;
+  void ArrayMult(const mfem::Array<const Vector *> &X,
+                 mfem::Array<Vector *> &Y) const override;
+};
+
+}  // namespace palace
+
+#endif  // PALACE_LINALG_RAS_HPP
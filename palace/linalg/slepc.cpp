@@ -60,8 +60,23 @@ inline PetscErrorCode FromPetscVec(Vec x, palace::ComplexVector &y1,
   return PETSC_SUCCESS;
 }
 
-inline PetscErrorCode ToPetscVec(const palace::ComplexVector &x, Vec y, int block = 0,
-                                 int nblocks = 1)
+inline PetscErrorCode ToPetscVec(const palace::ComplexVector &x, Vec y, double a = 1.0)
+{
+  // Copy into the PETSc vector with the optional scaling fused into the conversion (PETSc
+  // complex storage is interleaved, so the vector cannot be wrapped without a copy).
+  PetscInt n;
+  PetscScalar *py;
+  PetscMemType mtype;
+  PetscCall(VecGetLocalSize(y, &n));
+  MFEM_ASSERT(x.Size() == n, "Invalid size mismatch for PETSc vector conversion!");
+  PetscCall(VecGetArrayWriteAndMemType(y, &py, &mtype));
+  x.Get(py, n, PetscMemTypeDevice(mtype), a);
+  PetscCall(VecRestoreArrayWriteAndMemType(y, &py));
+  return PETSC_SUCCESS;
+}
+
+inline PetscErrorCode ToPetscVec(const palace::ComplexVector &x, Vec y, int block,
+                                 int nblocks)
 {
   PetscInt n;
   PetscScalar *py;
@@ -76,7 +91,8 @@ inline PetscErrorCode ToPetscVec(const palace::ComplexVector &x, Vec y, int bloc
 }
 
 inline PetscErrorCode ToPetscVec(const palace::ComplexVector &x1,
-                                 const palace::ComplexVector &x2, Vec y)
+                                 const palace::ComplexVector &x2, Vec y, double a1 = 1.0,
+                                 double a2 = 1.0)
 {
   PetscInt n;
   PetscScalar *py;
@@ -85,8 +101,8 @@ inline PetscErrorCode ToPetscVec(const palace::ComplexVector &x1,
   MFEM_ASSERT(x1.Size() == n / 2 && x2.Size() == n / 2,
               "Invalid size mismatch for PETSc vector conversion!");
   PetscCall(VecGetArrayWriteAndMemType(y, &py, &mtype));
-  x1.Get(py, n / 2, PetscMemTypeDevice(mtype));
-  x2.Get(py + n / 2, n / 2, PetscMemTypeDevice(mtype));
+  x1.Get(py, n / 2, PetscMemTypeDevice(mtype), a1);
+  x2.Get(py + n / 2, n / 2, PetscMemTypeDevice(mtype), a2);
   PetscCall(VecRestoreArrayWriteAndMemType(y, &py));
   return PETSC_SUCCESS;
 }
@@ -655,6 +671,30 @@ void SlepcEPSSolverBase::SetInitialSpace(const ComplexVector &v)
   PalacePetscCall(EPSSetInitialSpace(eps, 1, is));
 }
 
+void SlepcEPSSolverBase::SetInitialSpace(const std::vector<ComplexVector> &V)
+{
+  MFEM_VERIFY(
+      A0 && A1,
+      "Must call SetOperators before using SetInitialSpace for SLEPc eigenvalue solver!");
+  if (!v0)
+  {
+    PalacePetscCall(MatCreateVecs(A0, nullptr, &v0));
+  }
+
+  // SLEPc keeps a reference to the initial vectors, so they can be released here.
+  std::vector<Vec> is(V.size());
+  for (std::size_t i = 0; i < V.size(); i++)
+  {
+    PalacePetscCall(VecDuplicate(v0, &is[i]));
+    PalacePetscCall(ToPetscVec(V[i], is[i]));
+  }
+  PalacePetscCall(EPSSetInitialSpace(eps, static_cast<PetscInt>(is.size()), is.data()));
+  for (auto &v : is)
+  {
+    PalacePetscCall(VecDestroy(&v));
+  }
+}
+
 void SlepcEPSSolverBase::Customize()
 {
   SlepcEigenvalueSolver::Customize();
@@ -935,6 +975,29 @@ void SlepcPEPLinearSolver::SetInitialSpace(const ComplexVector &v)
   PalacePetscCall(EPSSetInitialSpace(eps, 1, is));
 }
 
+void SlepcPEPLinearSolver::SetInitialSpace(const std::vector<ComplexVector> &V)
+{
+  MFEM_VERIFY(
+      A0 && A1,
+      "Must call SetOperators before using SetInitialSpace for SLEPc eigenvalue solver!");
+  if (!v0)
+  {
+    PalacePetscCall(MatCreateVecs(A0, nullptr, &v0));
+  }
+  std::vector<Vec> is(V.size());
+  for (std::size_t i = 0; i < V.size(); i++)
+  {
+    PalacePetscCall(VecDuplicate(v0, &is[i]));
+    PalacePetscCall(VecZeroEntries(is[i]));
+    PalacePetscCall(ToPetscVec(V[i], is[i], 0, 2));
+  }
+  PalacePetscCall(EPSSetInitialSpace(eps, static_cast<PetscInt>(is.size()), is.data()));
+  for (auto &v : is)
+  {
+    PalacePetscCall(VecDestroy(&v));
+  }
+}
+
 void SlepcPEPLinearSolver::GetEigenvector(int i, ComplexVector &x) const
 {
   // Select the most accurate x for y = [x₁; x₂] from the linearized eigenvalue problem. Or,
@@ -1133,6 +1196,28 @@ void SlepcPEPSolverBase::SetInitialSpace(const ComplexVector &v)
   PalacePetscCall(PEPSetInitialSpace(pep, 1, is));
 }
 
+void SlepcPEPSolverBase::SetInitialSpace(const std::vector<ComplexVector> &V)
+{
+  MFEM_VERIFY(
+      A0 && A1 && A2,
+      "Must call SetOperators before using SetInitialSpace for SLEPc eigenvalue solver!");
+  if (!v0)
+  {
+    PalacePetscCall(MatCreateVecs(A0, nullptr, &v0));
+  }
+  std::vector<Vec> is(V.size());
+  for (std::size_t i = 0; i < V.size(); i++)
+  {
+    PalacePetscCall(VecDuplicate(v0, &is[i]));
+    PalacePetscCall(ToPetscVec(V[i], is[i]));
+  }
+  PalacePetscCall(PEPSetInitialSpace(pep, static_cast<PetscInt>(is.size()), is.data()));
+  for (auto &v : is)
+  {
+    PalacePetscCall(VecDestroy(&v));
+  }
+}
+
 void SlepcPEPSolverBase::Customize()
 {
   SlepcEigenvalueSolver::Customize();
@@ -1339,8 +1424,7 @@ PetscErrorCode __mat_apply_EPS_A0(Mat A, Vec x, Vec y)
 
   PetscCall(FromPetscVec(x, ctx->x1));
   ctx->opK->Mult(ctx->x1, ctx->y1);
-  ctx->y1 *= ctx->delta;
-  PetscCall(ToPetscVec(ctx->y1, y));
+  PetscCall(ToPetscVec(ctx->y1, y, ctx->delta));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1354,8 +1438,7 @@ PetscErrorCode __mat_apply_EPS_A1(Mat A, Vec x, Vec y)
 
   PetscCall(FromPetscVec(x, ctx->x1));
   ctx->opM->Mult(ctx->x1, ctx->y1);
-  ctx->y1 *= ctx->delta * ctx->gamma;
-  PetscCall(ToPetscVec(ctx->y1, y));
+  PetscCall(ToPetscVec(ctx->y1, y, ctx->delta * ctx->gamma));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1370,8 +1453,7 @@ PetscErrorCode __mat_apply_EPS_B(Mat A, Vec x, Vec y)
   PetscCall(FromPetscVec(x, ctx->x1));
   ctx->opB->Mult(ctx->x1.Real(), ctx->y1.Real());
   ctx->opB->Mult(ctx->x1.Imag(), ctx->y1.Imag());
-  ctx->y1 *= ctx->delta * ctx->gamma;
-  PetscCall(ToPetscVec(ctx->y1, y));
+  PetscCall(ToPetscVec(ctx->y1, y, ctx->delta * ctx->gamma));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1388,21 +1470,15 @@ PetscErrorCode __pc_apply_EPS(PC pc, Vec x, Vec y)
 
   PetscCall(FromPetscVec(x, ctx->x1));
   ctx->opInv->Mult(ctx->x1, ctx->y1);
-  if (!ctx->sinvert)
-  {
-    ctx->y1 *= 1.0 / (ctx->delta * ctx->gamma);
-  }
-  else
-  {
-    ctx->y1 *= 1.0 / ctx->delta;
-  }
   if (ctx->opProj)
   {
     // Mpi::Print(" Before projection: {:e}\n", linalg::Norml2(ctx->GetComm(), ctx->y1));
     ctx->opProj->Mult(ctx->y1);
     // Mpi::Print(" After projection: {:e}\n", linalg::Norml2(ctx->GetComm(), ctx->y1));
   }
-  PetscCall(ToPetscVec(ctx->y1, y));
+  PetscCall(ToPetscVec(ctx->y1, y,
+                       ctx->sinvert ? 1.0 / ctx->delta
+                                    : 1.0 / (ctx->delta * ctx->gamma)));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1417,12 +1493,10 @@ PetscErrorCode __mat_apply_PEPLinear_L0(Mat A, Vec x, Vec y)
   MFEM_VERIFY(ctx, "Invalid PETSc shell matrix context for SLEPc!");
 
   PetscCall(FromPetscVec(x, ctx->x1, ctx->x2));
-  ctx->y1 = ctx->x2;
   ctx->opC->Mult(ctx->x2, ctx->y2);
   ctx->y2 *= ctx->gamma;
   ctx->opK->AddMult(ctx->x1, ctx->y2, std::complex<double>(1.0, 0.0));
-  ctx->y2 *= -ctx->delta;
-  PetscCall(ToPetscVec(ctx->y1, ctx->y2, y));
+  PetscCall(ToPetscVec(ctx->x2, ctx->y2, y, 1.0, -ctx->delta));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1437,10 +1511,8 @@ PetscErrorCode __mat_apply_PEPLinear_L1(Mat A, Vec x, Vec y)
   MFEM_VERIFY(ctx, "Invalid PETSc shell matrix context for SLEPc!");
 
   PetscCall(FromPetscVec(x, ctx->x1, ctx->x2));
-  ctx->y1 = ctx->x1;
   ctx->opM->Mult(ctx->x2, ctx->y2);
-  ctx->y2 *= ctx->delta * ctx->gamma * ctx->gamma;
-  PetscCall(ToPetscVec(ctx->y1, ctx->y2, y));
+  PetscCall(ToPetscVec(ctx->x1, ctx->y2, y, 1.0, ctx->delta * ctx->gamma * ctx->gamma));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1457,9 +1529,8 @@ PetscErrorCode __mat_apply_PEPLinear_B(Mat A, Vec x, Vec y)
   ctx->opB->Mult(ctx->x1.Imag(), ctx->y1.Imag());
   ctx->opB->Mult(ctx->x2.Real(), ctx->y2.Real());
   ctx->opB->Mult(ctx->x2.Imag(), ctx->y2.Imag());
-  ctx->y1 *= ctx->delta * ctx->gamma * ctx->gamma;
-  ctx->y2 *= ctx->delta * ctx->gamma * ctx->gamma;
-  PetscCall(ToPetscVec(ctx->y1, ctx->y2, y));
+  PetscCall(ToPetscVec(ctx->y1, ctx->y2, y, ctx->delta * ctx->gamma * ctx->gamma,
+                       ctx->delta * ctx->gamma * ctx->gamma));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1575,8 +1646,7 @@ PetscErrorCode __mat_apply_PEP_B(Mat A, Vec x, Vec y)
   PetscCall(FromPetscVec(x, ctx->x1));
   ctx->opB->Mult(ctx->x1.Real(), ctx->y1.Real());
   ctx->opB->Mult(ctx->x1.Imag(), ctx->y1.Imag());
-  ctx->y1 *= ctx->delta * ctx->gamma;
-  PetscCall(ToPetscVec(ctx->y1, y));
+  PetscCall(ToPetscVec(ctx->y1, y, ctx->delta * ctx->gamma));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1593,21 +1663,15 @@ PetscErrorCode __pc_apply_PEP(PC pc, Vec x, Vec y)
 
   PetscCall(FromPetscVec(x, ctx->x1));
   ctx->opInv->Mult(ctx->x1, ctx->y1);
-  if (!ctx->sinvert)
-  {
-    ctx->y1 *= 1.0 / (ctx->delta * ctx->gamma * ctx->gamma);
-  }
-  else
-  {
-    ctx->y1 *= 1.0 / ctx->delta;
-  }
   if (ctx->opProj)
   {
     // Mpi::Print(" Before projection: {:e}\n", linalg::Norml2(ctx->GetComm(), ctx->y1));
     ctx->opProj->Mult(ctx->y1);
     // Mpi::Print(" After projection: {:e}\n", linalg::Norml2(ctx->GetComm(), ctx->y1));
   }
-  PetscCall(ToPetscVec(ctx->y1, y));
+  PetscCall(ToPetscVec(ctx->y1, y,
+                       ctx->sinvert ? 1.0 / ctx->delta
+                                    : 1.0 / (ctx->delta * ctx->gamma * ctx->gamma)));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
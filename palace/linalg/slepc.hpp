@@ -223,6 +223,7 @@ public:
   void SetType(Type type) override;
 
   void SetInitialSpace(const ComplexVector &v) override;
+  void SetInitialSpace(const std::vector<ComplexVector> &V) override;
 
   int Solve() override;
 
@@ -319,6 +320,7 @@ public:
   void SetBMat(const Operator &B) override;
 
   void SetInitialSpace(const ComplexVector &v) override;
+  void SetInitialSpace(const std::vector<ComplexVector> &V) override;
 
   void GetEigenvector(int i, ComplexVector &x) const override;
 };
@@ -358,6 +360,7 @@ public:
   void SetType(Type type) override;
 
   void SetInitialSpace(const ComplexVector &v) override;
+  void SetInitialSpace(const std::vector<ComplexVector> &V) override;
 
   int Solve() override;
 
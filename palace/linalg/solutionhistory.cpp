@@ -0,0 +1,100 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "solutionhistory.hpp"
+
+#include <complex>
+#include <Eigen/Dense>
+#include "linalg/orthog.hpp"
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+using namespace std::complex_literals;
+
+void SolutionHistory::AddSolution(const ComplexVector &x)
+{
+  if (X.size() < max_size)
+  {
+    for (auto *V : {&X, &KX, &CX, &MX, &Q})
+    {
+      if (V != &CX || C)
+      {
+        V->emplace_back(x.Size());
+        V->back().UseDevice(true);
+      }
+    }
+  }
+  X[next] = x;
+  K.Mult(x, KX[next]);
+  if (C)
+  {
+    C->Mult(x, CX[next]);
+  }
+  M.Mult(x, MX[next]);
+  next = (next + 1) % max_size;
+}
+
+void SolutionHistory::GetInitialGuess(double omega, const ComplexOperator *A2,
+                                      const ComplexVector &b, ComplexVector &x)
+{
+  const std::size_t m = X.size();
+  if (m == 0)
+  {
+    return;
+  }
+
+  // The products A X are combined from the cached products with K, C, and M (only the
+  // boundary term A2(ω) is applied), and orthonormalized as A X = Q R using classical
+  // Gram-Schmidt with reorthogonalization. The basis X R⁻¹ is then A-orthonormal, and the
+  // minimal residual initial guess is x₀ = X R⁻¹ Qᴴ b. The stored solutions are typically
+  // close to linearly dependent, so those which are numerically in the span of the
+  // previous ones are skipped.
+  constexpr double orthog_tol = 1.0e-6;
+  std::vector<std::size_t> idx;
+  Eigen::MatrixXcd R = Eigen::MatrixXcd::Zero(m, m);
+  for (std::size_t j = 0; j < m; j++)
+  {
+    const std::size_t k = idx.size();
+    auto &q = Q[k];
+    q = KX[j];
+    if (C)
+    {
+      q.Add(1i * omega, CX[j]);
+    }
+    q.Add(-omega * omega, MX[j]);
+    if (A2)
+    {
+      A2->AddMult(X[j], q);
+    }
+    const double norm0 = linalg::Norml2(comm, q);
+    linalg::OrthogonalizeColumnCGS(comm, Q, q, R.col(k).data(), static_cast<int>(k), true);
+    const double norm = linalg::Norml2(comm, q);
+    if (norm > orthog_tol * norm0)
+    {
+      R(k, k) = norm;
+      q *= 1.0 / norm;
+      idx.push_back(j);
+    }
+  }
+  const std::size_t n = idx.size();
+  if (n == 0)
+  {
+    return;
+  }
+  Eigen::VectorXcd g(n);
+  for (std::size_t i = 0; i < n; i++)
+  {
+    g(i) = linalg::LocalDot(b, Q[i]);
+  }
+  Mpi::GlobalSum(n, g.data(), comm);
+  const Eigen::VectorXcd c = R.topLeftCorner(n, n).triangularView<Eigen::Upper>().solve(g);
+  x = 0.0;
+  for (std::size_t i = 0; i < n; i++)
+  {
+    x.AXPY(c(i), X[idx[i]]);
+  }
+}
+
+}  // namespace palace
@@ -0,0 +1,55 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_LINALG_SOLUTION_HISTORY_HPP
+#define PALACE_LINALG_SOLUTION_HISTORY_HPP
+
+#include <vector>
+#include "linalg/operator.hpp"
+#include "linalg/vector.hpp"
+
+namespace palace
+{
+
+//
+// Projection-based initial guess for a sequence of linear systems with slowly varying
+// operators and right-hand sides. The initial guess is the linear combination of the most
+// recent solutions which minimizes the residual ‖b - A x₀‖ for the current operator.
+// Reference: Fischer, Projection techniques for iterative solution of Ax = b with
+//            successive right-hand sides, Comput. Methods Appl. Mech. Engrg. (1998).
+//
+class SolutionHistory
+{
+private:
+  MPI_Comm comm;
+
+  // Frequency-independent operators defining the system matrix A = K + iω C - ω² M + A2(ω)
+  // (not owned, C may be nullptr).
+  const ComplexOperator &K, *C, &M;
+
+  // Stored solutions (circular buffer) and their products with K, C, and M, which are
+  // computed once when each solution is added. Q is workspace for the orthonormalized
+  // products with the system matrix.
+  const std::size_t max_size;
+  std::size_t next;
+  std::vector<ComplexVector> X, KX, CX, MX, Q;
+
+public:
+  SolutionHistory(MPI_Comm comm, int max_size, const ComplexOperator &K,
+                  const ComplexOperator *C, const ComplexOperator &M)
+    : comm(comm), K(K), C(C), M(M), max_size(max_size), next(0)
+  {
+  }
+
+  // Store a solution, replacing the oldest one if the history is full.
+  void AddSolution(const ComplexVector &x);
+
+  // Compute the initial guess x for the system A(ω) x = b, where the frequency-dependent
+  // boundary term A2(ω) may be nullptr. If no solutions are stored, x is not modified.
+  void GetInitialGuess(double omega, const ComplexOperator *A2, const ComplexVector &b,
+                       ComplexVector &x);
+};
+
+}  // namespace palace
+
+#endif  // PALACE_LINALG_SOLUTION_HISTORY_HPP
@@ -5,6 +5,8 @@
 
 #if defined(MFEM_USE_SUPERLU)
 
+#include <vector>
+#include <superlu_sdefs.h>
 #include "utils/communication.hpp"
 
 namespace palace
@@ -32,6 +34,17 @@ int GetNpDep(int np, bool use_3d)
   }
 }
 
+void GetNpRowCol(int np, int &nprow, int &npcol)
+{
+  // Return a roughly square 2D processor grid based on communicator size.
+  npcol = std::max(1, (int)std::floor(std::sqrt(np)));
+  while (np % npcol > 0)
+  {
+    npcol--;
+  }
+  nprow = np / npcol;
+}
+
 }  // namespace
 
 SuperLUSolver::SuperLUSolver(MPI_Comm comm, config::LinearSolverData::SymFactType reorder,
@@ -129,6 +142,212 @@ void SuperLUSolver::SetOperator(const Operator &op)
   hypre_CSRMatrixDestroy(csr);
 }
 
+struct SuperLUMixedPrecisionSolver::Data
+{
+  gridinfo_t grid;
+  superlu_dist_options_t options;
+  SuperLUStat_t stat;
+  SuperMatrix A;
+  sScalePermstruct_t ScalePermstruct;
+  sLUstruct_t LUstruct;
+  sSOLVEstruct_t SOLVEstruct;
+
+  // Distributed matrix storage in single precision, which SuperLU does not copy.
+  std::vector<int_t> rowptr, colind;
+  std::vector<float> nzval;
+
+  // Global matrix size and state flags.
+  int_t n = 0;
+  int nrhs = 0;
+  bool A_init = false, LU_init = false, factored = false;
+  bool print = false;
+};
+
+SuperLUMixedPrecisionSolver::SuperLUMixedPrecisionSolver(
+    MPI_Comm comm, config::LinearSolverData::SymFactType reorder, int print)
+  : mfem::Solver(), comm(comm), data(std::make_unique<Data>())
+{
+  // Configure the 2D processor grid.
+  int nprow, npcol;
+  GetNpRowCol(Mpi::Size(comm), nprow, npcol);
+  superlu_gridinit(comm, nprow, npcol, &data->grid);
+  if (print > 1)
+  {
+    Mpi::Print(comm, " SuperLUMixedPrecisionSolver: Using 2D processor grid {:d} x {:d}\n",
+               nprow, npcol);
+  }
+
+  // Configure the solver (same defaults as for SuperLUSolver).
+  set_default_options_dist(&data->options);
+  data->options.Equil = NO;
+  data->options.ReplaceTinyPivot = NO;
+  data->options.IterRefine = NOREFINE;
+  data->options.SymPattern = YES;  // Always symmetric sparsity pattern
+  data->options.PrintStat = (print > 1) ? YES : NO;
+  switch (reorder)
+  {
+    case config::LinearSolverData::SymFactType::METIS:
+      data->options.ColPerm = METIS_AT_PLUS_A;
+      break;
+    case config::LinearSolverData::SymFactType::PARMETIS:
+      data->options.ColPerm = PARMETIS;
+      data->options.ParSymbFact = YES;
+      break;
+    case config::LinearSolverData::SymFactType::AMD:
+    case config::LinearSolverData::SymFactType::RCM:
+      data->options.ColPerm = MMD_AT_PLUS_A;
+      break;
+    case config::LinearSolverData::SymFactType::SCOTCH:
+    case config::LinearSolverData::SymFactType::PTSCOTCH:
+    case config::LinearSolverData::SymFactType::PORD:
+    case config::LinearSolverData::SymFactType::DEFAULT:
+      // Should have good default
+      break;
+  }
+  data->print = (print > 1);
+  PStatInit(&data->stat);
+}
+
+SuperLUMixedPrecisionSolver::~SuperLUMixedPrecisionSolver()
+{
+  if (data->options.SolveInitialized == YES)
+  {
+    sSolveFinalize(&data->options, &data->SOLVEstruct);
+  }
+  if (data->LU_init)
+  {
+    if (data->factored)
+    {
+      sDestroy_LU(data->n, &data->grid, &data->LUstruct);
+    }
+    sScalePermstructFree(&data->ScalePermstruct);
+    sLUstructFree(&data->LUstruct);
+  }
+  if (data->A_init)
+  {
+    Destroy_SuperMatrix_Store_dist(&data->A);
+  }
+  PStatFree(&data->stat);
+  superlu_gridexit(&data->grid);
+}
+
+void SuperLUMixedPrecisionSolver::SetOperator(const Operator &op)
+{
+  // Convert the input operator to a distributed single precision SuperMatrix.
+  const auto *hA = dynamic_cast<const mfem::HypreParMatrix *>(&op);
+  MFEM_VERIFY(hA && hA->GetGlobalNumRows() == hA->GetGlobalNumCols(),
+              "SuperLUMixedPrecisionSolver requires a square HypreParMatrix operator!");
+  auto *parcsr = (hypre_ParCSRMatrix *)const_cast<mfem::HypreParMatrix &>(*hA);
+  hypre_CSRMatrix *csr = hypre_MergeDiagAndOffd(parcsr);
+  hypre_CSRMatrixMigrate(csr, HYPRE_MEMORY_HOST);
+  HYPRE_BigInt glob_n = hypre_ParCSRMatrixGlobalNumRows(parcsr);
+  HYPRE_BigInt first_row = hypre_ParCSRMatrixFirstRowIndex(parcsr);
+  HYPRE_Int n_loc = hypre_CSRMatrixNumRows(csr);
+  HYPRE_Int *I = hypre_CSRMatrixI(csr);
+  HYPRE_BigInt *J = hypre_CSRMatrixBigJ(csr);
+  double *a = hypre_CSRMatrixData(csr);
+  const HYPRE_Int nnz_loc = I[n_loc];
+  data->rowptr.assign(I, I + n_loc + 1);
+  data->colind.assign(J, J + nnz_loc);
+  data->nzval.resize(nnz_loc);
+  for (HYPRE_Int k = 0; k < nnz_loc; k++)
+  {
+    data->nzval[k] = static_cast<float>(a[k]);
+  }
+  hypre_CSRMatrixDestroy(csr);
+  if (data->A_init)
+  {
+    Destroy_SuperMatrix_Store_dist(&data->A);
+  }
+  sCreate_CompRowLoc_Matrix_dist(&data->A, glob_n, glob_n, nnz_loc, n_loc, first_row,
+                                 data->nzval.data(), data->colind.data(),
+                                 data->rowptr.data(), SLU_NR_loc, SLU_S, SLU_GE);
+  data->A_init = true;
+
+  // For repeated factorizations, always reuse the sparsity pattern and row permutation.
+  // The factorization itself is performed at the first call to Mult.
+  if (data->options.SolveInitialized == YES)
+  {
+    sSolveFinalize(&data->options, &data->SOLVEstruct);
+  }
+  if (data->factored && data->n == (int_t)glob_n)
+  {
+    data->options.Fact = SamePattern_SameRowPerm;
+  }
+  else
+  {
+    if (data->LU_init)
+    {
+      if (data->factored)
+      {
+        sDestroy_LU(data->n, &data->grid, &data->LUstruct);
+      }
+      sScalePermstructFree(&data->ScalePermstruct);
+      sLUstructFree(&data->LUstruct);
+    }
+    data->n = glob_n;
+    sScalePermstructInit(data->n, data->n, &data->ScalePermstruct);
+    sLUstructInit(data->n, &data->LUstruct);
+    data->LU_init = true;
+    data->factored = false;
+    data->options.Fact = DOFACT;
+  }
+  height = width = static_cast<int>(n_loc);
+}
+
+void SuperLUMixedPrecisionSolver::Mult(const Vector &x, Vector &y) const
+{
+  mfem::Array<const Vector *> X(1);
+  mfem::Array<Vector *> Y(1);
+  X[0] = &x;
+  Y[0] = &y;
+  ArrayMult(X, Y);
+}
+
+void SuperLUMixedPrecisionSolver::ArrayMult(const mfem::Array<const Vector *> &X,
+                                            mfem::Array<Vector *> &Y) const
+{
+  // Solve in single precision (factorizing first if required) and return the solution in
+  // double precision.
+  MFEM_ASSERT(X.Size() == Y.Size(),
+              "Invalid number of right-hand sides for SuperLU_DIST solve!");
+  const int nrhs = X.Size();
+  if (nrhs != data->nrhs && data->options.SolveInitialized == YES)
+  {
+    sSolveFinalize(&data->options, &data->SOLVEstruct);
+  }
+  data->nrhs = nrhs;
+  std::vector<float> b(static_cast<std::size_t>(height) * nrhs), berr(nrhs);
+  for (int j = 0; j < nrhs; j++)
+  {
+    const double *xj = X[j]->HostRead();
+    for (int i = 0; i < height; i++)
+    {
+      b[j * height + i] = static_cast<float>(xj[i]);
+    }
+  }
+  int info = 0;
+  psgssvx(&data->options, &data->A, &data->ScalePermstruct, b.data(), height, nrhs,
+          &data->grid, &data->LUstruct, &data->SOLVEstruct, berr.data(), &data->stat,
+          &info);
+  MFEM_VERIFY(info == 0, "SuperLU_DIST returned error during solve: info = " << info
+                                                                               << "!");
+  if (data->print)
+  {
+    PStatPrint(&data->options, &data->stat, &data->grid);
+  }
+  data->options.Fact = FACTORED;
+  data->factored = true;
+  for (int j = 0; j < nrhs; j++)
+  {
+    double *yj = Y[j]->HostWrite();
+    for (int i = 0; i < height; i++)
+    {
+      yj[i] = static_cast<double>(b[j * height + i]);
+    }
+  }
+}
+
 }  // namespace palace
 
 #endif
@@ -56,6 +56,41 @@ public:
   }
 };
 
+//
+// A wrapper for the SuperLU_DIST direct solver package which computes the factorization in
+// single precision, for use as a preconditioner where the outer Krylov solver recovers the
+// double precision accuracy.
+//
+class SuperLUMixedPrecisionSolver : public mfem::Solver
+{
+private:
+  MPI_Comm comm;
+
+  // SuperLU_DIST data structures (defined in the implementation to avoid exposing the
+  // SuperLU_DIST headers).
+  struct Data;
+  std::unique_ptr<Data> data;
+
+public:
+  SuperLUMixedPrecisionSolver(MPI_Comm comm, config::LinearSolverData::SymFactType reorder,
+                              int print);
+  SuperLUMixedPrecisionSolver(MPI_Comm comm, const IoData &iodata, int print)
+    : SuperLUMixedPrecisionSolver(comm, iodata.solver.linear.sym_fact_type, print)
+  {
+    MFEM_VERIFY(!iodata.solver.linear.superlu_3d,
+                "SuperLU_DIST 3D processor grid (config[\"Solver\"][\"Linear\"]"
+                "[\"SuperLU3DCommunicator\"]) is not supported for \"SuperLU-MP\" "
+                "linear solver type!");
+  }
+  ~SuperLUMixedPrecisionSolver() override;
+
+  void SetOperator(const Operator &op) override;
+
+  void Mult(const Vector &x, Vector &y) const override;
+  void ArrayMult(const mfem::Array<const Vector *> &X,
+                 mfem::Array<Vector *> &Y) const override;
+};
+
 }  // namespace palace
 
 #endif
@@ -100,19 +100,17 @@ void ComplexVector::Set(const std::complex<double> *py, int size, bool on_dev)
   }
   else if (!on_dev)
   {
-    // Need copy from host to device (host pointer but using device).
-    Vector y(2 * size);
-    y.UseDevice(true);
+    // Need copy from host to device (host pointer but using device). Write directly into
+    // the host memory of the real and imaginary parts, with the transfer to device deferred
+    // until the next device access.
+    auto *XR = Real().HostWrite();
+    auto *XI = Imag().HostWrite();
+    PalacePragmaOmp(parallel for schedule(static))
+    for (int i = 0; i < size; i++)
     {
-      auto *Y = y.HostWrite();
-      PalacePragmaOmp(parallel for schedule(static))
-      for (int i = 0; i < size; i++)
-      {
-        Y[2 * i] = py[i].real();
-        Y[2 * i + 1] = py[i].imag();
-      }
+      XR[i] = py[i].real();
+      XI[i] = py[i].imag();
     }
-    SetImpl(y.Read(use_dev), size, use_dev);
   }
   else
   {
@@ -121,19 +119,19 @@ void ComplexVector::Set(const std::complex<double> *py, int size, bool on_dev)
   }
 }
 
-void ComplexVector::Get(std::complex<double> *py, int size, bool on_dev) const
+void ComplexVector::Get(std::complex<double> *py, int size, bool on_dev, double a) const
 {
   MFEM_ASSERT(size == Size(),
               "Mismatch in dimension for array of std::complex<double> in ComplexVector!");
-  auto GetImpl = [this](double *Y, const int N, bool use_dev)
+  auto GetImpl = [this, a](double *Y, const int N, bool use_dev)
   {
     const auto *XR = Real().Read(use_dev);
     const auto *XI = Imag().Read(use_dev);
     mfem::forall_switch(use_dev, N,
                         [=] MFEM_HOST_DEVICE(int i)
                         {
-                          Y[2 * i] = XR[i];
-                          Y[2 * i + 1] = XI[i];
+                          Y[2 * i] = a * XR[i];
+                          Y[2 * i + 1] = a * XI[i];
                         });
   };
   const bool use_dev = UseDevice();
@@ -151,8 +149,8 @@ void ComplexVector::Get(std::complex<double> *py, int size, bool on_dev) const
     PalacePragmaOmp(parallel for schedule(static))
     for (int i = 0; i < size; i++)
     {
-      py[i].real(XR[i]);
-      py[i].imag(XI[i]);
+      py[i].real(a * XR[i]);
+      py[i].imag(a * XI[i]);
     }
   }
   else
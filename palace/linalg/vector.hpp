@@ -77,8 +77,8 @@ public:
   // Set from an array of complex values, without resizing.
   void Set(const std::complex<double> *py, int size, bool on_dev);
 
-  // Copy the vector into an array of complex values.
-  void Get(std::complex<double> *py, int size, bool on_dev) const;
+  // Copy the vector into an array of complex values, scaled by a.
+  void Get(std::complex<double> *py, int size, bool on_dev, double a = 1.0) const;
 
   // Set all entries equal to s.
   ComplexVector &operator=(std::complex<double> s);
@@ -209,6 +209,16 @@ int main(int argc, char *argv[])
     (defined(STRUMPACK_USE_PTSCOTCH) || defined(STRUMPACK_USE_SLATE_SCALAPACK))
   Mpi::default_thread_required = MPI_THREAD_MULTIPLE;
 #endif
+  for (int i = 1; i < argc; i++)
+  {
+    // Background field output requires MPI_THREAD_MULTIPLE, which is only requested when
+    // enabled since it can be slower for some MPI implementations.
+    std::string_view argv_i = argv[i];
+    if ((argv_i == "-background-output") || (argv_i == "--background-output"))
+    {
+      Mpi::default_thread_requested = MPI_THREAD_MULTIPLE;
+    }
+  }
   Mpi::Init(argc, argv);
   MPI_Comm world_comm = Mpi::World();           // szb 20241221 comment: 这个我还没用过，可以理解一下
   bool world_root = Mpi::Root(world_comm);
@@ -229,7 +239,9 @@ int main(int argc, char *argv[])
                "Usage: {} [OPTIONS] CONFIG_FILE\n\n"
                "Options:\n"
                "  -h, --help           Show this help message and exit\n"
-               "  -dry-run, --dry-run  Parse configuration file for errors and exit\n\n",
+               "  -dry-run, --dry-run  Parse configuration file for errors and exit\n"
+               "  -background-output, --background-output\n"
+               "                       Write eigenmode fields on a background thread\n\n",
                executable_path.substr(executable_path.find_last_of('/') + 1));
   };
 
@@ -247,6 +259,10 @@ int main(int argc, char *argv[])
       dryrun = true;
       continue;
     }
+    if ((argv_i == "-background-output") || (argv_i == "--background-output"))
+    {
+      continue;
+    }
   }
   if (argc < 2)
   {
@@ -272,7 +288,7 @@ int main(int argc, char *argv[])
 
   // Parse configuration file.
   PrintPalaceBanner(world_comm);
-  IoData iodata(argv[1], false);
+  IoData iodata(argv[argc - 1], false);
 
   // Initialize the MFEM device and configure libCEED backend.
   int omp_threads = ConfigureOmp(), ngpu = GetDeviceCount();
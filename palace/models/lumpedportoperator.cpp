@@ -3,6 +3,8 @@
 
 #include "lumpedportoperator.hpp"
 
+#include <algorithm>
+
 #include "fem/coefficient.hpp"
 #include "fem/gridfunction.hpp"
 #include "fem/integrator.hpp"
@@ -281,6 +283,20 @@ std::complex<double> LumpedPortData::GetPower(GridFunction &E, GridFunction &B)
 }
 
 std::complex<double> LumpedPortData::GetSParameter(GridFunction &E) const
+{
+  std::complex<double> dot = GetLocalSParameter(E);
+  Mpi::GlobalSum(1, &dot, E.GetComm());
+  return dot;
+}
+
+std::complex<double> LumpedPortData::GetVoltage(GridFunction &E) const
+{
+  std::complex<double> dot = GetLocalVoltage(E);
+  Mpi::GlobalSum(1, &dot, E.GetComm());
+  return dot;
+}
+
+std::complex<double> LumpedPortData::GetLocalSParameter(GridFunction &E) const
 {
   // Compute port S-parameter, or the projection of the field onto the port mode.
   InitializeLinearForms(*E.ParFESpace());
@@ -289,11 +305,10 @@ std::complex<double> LumpedPortData::GetSParameter(GridFunction &E) const
   {
     dot.imag((*s) * E.Imag());
   }
-  Mpi::GlobalSum(1, &dot, E.GetComm());
   return dot;
 }
 
-std::complex<double> LumpedPortData::GetVoltage(GridFunction &E) const
+std::complex<double> LumpedPortData::GetLocalVoltage(GridFunction &E) const
 {
   // Compute the average voltage across the port.
   InitializeLinearForms(*E.ParFESpace());
@@ -302,7 +317,6 @@ std::complex<double> LumpedPortData::GetVoltage(GridFunction &E) const
   {
     dot.imag((*v) * E.Imag());
   }
-  Mpi::GlobalSum(1, &dot, E.GetComm());
   return dot;
 }
 
@@ -312,6 +326,13 @@ LumpedPortOperator::LumpedPortOperator(const IoData &iodata, const MaterialOpera
   // Set up lumped port boundary conditions.
   SetUpBoundaryProperties(iodata, mat_op, mesh);
   PrintBoundaryInfo(iodata, mesh);
+  for (const auto &[idx, data] : ports)
+  {
+    if (data.excitation)
+    {
+      excitation_idx.push_back(idx);
+    }
+  }
 }
 
 void LumpedPortOperator::SetUpBoundaryProperties(const IoData &iodata,
@@ -491,6 +512,16 @@ const LumpedPortData &LumpedPortOperator::GetPort(int idx) const
   return it->second;
 }
 
+void LumpedPortOperator::SetExcitationIndex(int idx)
+{
+  for (auto &[i, data] : ports)
+  {
+    data.excitation =
+        (idx < 0) ? std::binary_search(excitation_idx.begin(), excitation_idx.end(), i)
+                  : (i == idx);
+  }
+}
+
 mfem::Array<int> LumpedPortOperator::GetAttrList() const
 {
   mfem::Array<int> attr_list;
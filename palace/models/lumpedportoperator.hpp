@@ -75,6 +75,11 @@ public:
   std::complex<double> GetPower(GridFunction &E, GridFunction &B) const;
   std::complex<double> GetSParameter(GridFunction &E) const;
   std::complex<double> GetVoltage(GridFunction &E) const;
+
+  // Evaluate the S-parameter or voltage functionals on the local dofs without the global
+  // reduction, for combining the reductions for several solutions.
+  std::complex<double> GetLocalSParameter(GridFunction &E) const;
+  std::complex<double> GetLocalVoltage(GridFunction &E) const;
 };
 
 //
@@ -88,6 +93,9 @@ private:
   // ports.
   std::map<int, LumpedPortData> ports;
 
+  // Indices of the ports marked for excitation in the configuration file.
+  std::vector<int> excitation_idx;
+
   void SetUpBoundaryProperties(const IoData &iodata, const MaterialOperator &mat_op,
                                const mfem::ParMesh &mesh);
   void PrintBoundaryInfo(const IoData &iodata, const mfem::ParMesh &mesh);
@@ -104,6 +112,13 @@ public:
   auto rend() const { return ports.rend(); }
   auto Size() const { return ports.size(); }
 
+  // Return the indices of the ports marked for excitation in the configuration file.
+  const auto &GetExcitationIndices() const { return excitation_idx; }
+
+  // Restrict the excitation to the single port with the given index, or restore the
+  // excitations from the configuration file when idx < 0.
+  void SetExcitationIndex(int idx);
+
   // Returns array of lumped port attributes.
   mfem::Array<int> GetAttrList() const;
   mfem::Array<int> GetRsAttrList() const;
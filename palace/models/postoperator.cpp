@@ -48,7 +48,8 @@ PostOperator::PostOperator(const IoData &iodata, SpaceOperator &space_op,
     B(std::make_unique<GridFunction>(space_op.GetRTSpace(),
                                      iodata.problem.type !=
                                          config::ProblemData::Type::TRANSIENT)),
-    lumped_port_init(false), wave_port_init(false),
+    lumped_port_init(false), wave_port_init(false), rom_omega(0.0), rom_init(false),
+    rom_active(false), block_idx(-1),
     paraview(CreateParaviewPath(iodata, name), &space_op.GetNDSpace().GetParMesh()),
     paraview_bdr(CreateParaviewPath(iodata, name) + "_boundary",
                  &space_op.GetNDSpace().GetParMesh()),
@@ -91,7 +92,8 @@ PostOperator::PostOperator(const IoData &iodata, LaplaceOperator &laplace_op,
     dom_post_op(iodata, laplace_op.GetMaterialOp(), laplace_op.GetH1Space()),
     E(std::make_unique<GridFunction>(laplace_op.GetNDSpace())),
     V(std::make_unique<GridFunction>(laplace_op.GetH1Space())), lumped_port_init(false),
-    wave_port_init(false),
+    wave_port_init(false), rom_omega(0.0), rom_init(false), rom_active(false),
+    block_idx(-1),
     paraview(CreateParaviewPath(iodata, name), &laplace_op.GetNDSpace().GetParMesh()),
     paraview_bdr(CreateParaviewPath(iodata, name) + "_boundary",
                  &laplace_op.GetNDSpace().GetParMesh()),
@@ -118,7 +120,8 @@ PostOperator::PostOperator(const IoData &iodata, CurlCurlOperator &curlcurl_op,
     dom_post_op(iodata, curlcurl_op.GetMaterialOp(), curlcurl_op.GetNDSpace()),
     B(std::make_unique<GridFunction>(curlcurl_op.GetRTSpace())),
     A(std::make_unique<GridFunction>(curlcurl_op.GetNDSpace())), lumped_port_init(false),
-    wave_port_init(false),
+    wave_port_init(false), rom_omega(0.0), rom_init(false), rom_active(false),
+    block_idx(-1),
     paraview(CreateParaviewPath(iodata, name), &curlcurl_op.GetNDSpace().GetParMesh()),
     paraview_bdr(CreateParaviewPath(iodata, name) + "_boundary",
                  &curlcurl_op.GetNDSpace().GetParMesh()),
@@ -279,6 +282,8 @@ void PostOperator::SetEGridFunction(const ComplexVector &e, bool exchange_face_n
     E->Imag().ExchangeFaceNbrData();
   }
   lumped_port_init = wave_port_init = false;
+  rom_active = false;
+  block_idx = -1;
 }
 
 void PostOperator::SetBGridFunction(const ComplexVector &b, bool exchange_face_nbr_data)
@@ -294,6 +299,8 @@ void PostOperator::SetBGridFunction(const ComplexVector &b, bool exchange_face_n
     B->Imag().ExchangeFaceNbrData();
   }
   lumped_port_init = wave_port_init = false;
+  rom_active = false;
+  block_idx = -1;
 }
 
 void PostOperator::SetEGridFunction(const Vector &e, bool exchange_face_nbr_data)
@@ -307,6 +314,8 @@ void PostOperator::SetEGridFunction(const Vector &e, bool exchange_face_nbr_data
     E->Real().ExchangeFaceNbrData();
   }
   lumped_port_init = wave_port_init = false;
+  rom_active = false;
+  block_idx = -1;
 }
 
 void PostOperator::SetBGridFunction(const Vector &b, bool exchange_face_nbr_data)
@@ -320,6 +329,8 @@ void PostOperator::SetBGridFunction(const Vector &b, bool exchange_face_nbr_data
     B->Real().ExchangeFaceNbrData();
   }
   lumped_port_init = wave_port_init = false;
+  rom_active = false;
+  block_idx = -1;
 }
 
 void PostOperator::SetVGridFunction(const Vector &v, bool exchange_face_nbr_data)
@@ -346,8 +357,206 @@ void PostOperator::SetAGridFunction(const Vector &a, bool exchange_face_nbr_data
   }
 }
 
+bool PostOperator::SetReducedBasis(const std::vector<Vector> &V, std::size_t n,
+                                   const Operator &Curl,
+                                   const LumpedPortOperator &lumped_port_op,
+                                   const WavePortOperator &wave_port_op)
+{
+  // Surface postprocessing and wave port postprocessing (with frequency-dependent port
+  // modes) are only available from the full-space solution.
+  rom_init = rom_active = false;
+  if (!surf_post_op.flux_surfs.empty() || !surf_post_op.eps_surfs.empty() ||
+      wave_port_op.Size() > 0)
+  {
+    return false;
+  }
+  MFEM_VERIFY(HasImag() && E && B && dom_post_op.M_elec && dom_post_op.M_mag,
+              "PostOperator is not configured for reduced-order postprocessing!");
+  MFEM_VERIFY(n > 0 && n <= V.size(), "Invalid basis for reduced-order postprocessing!");
+  MPI_Comm comm = GetComm();
+  const int dim = static_cast<int>(n);
+
+  // Distribute the basis vectors and their curls (B = -1/(iω) ∇ x E = i/ω ∇ x E) to local
+  // dofs.
+  std::vector<Vector> e(dim), b(dim);
+  {
+    Vector bt(Curl.Height());
+    bt.UseDevice(true);
+    for (int j = 0; j < dim; j++)
+    {
+      E->Real().SetFromTrueDofs(V[j]);
+      e[j] = E->Real();
+      Curl.Mult(V[j], bt);
+      B->Real().SetFromTrueDofs(bt);
+      b[j] = B->Real();
+    }
+  }
+
+  // Project the energy matrices: Mᵣ = Vᵀ M V.
+  auto Project = [&](const Operator &M, const std::vector<Vector> &u, Vector &w,
+                     Eigen::MatrixXcd &Mr)
+  {
+    Eigen::MatrixXd Mr_loc(dim, dim);
+    for (int j = 0; j < dim; j++)
+    {
+      M.Mult(u[j], w);
+      for (int i = 0; i < dim; i++)
+      {
+        Mr_loc(i, j) = linalg::LocalDot(u[i], w);
+      }
+    }
+    Mpi::GlobalSum(dim * dim, Mr_loc.data(), comm);
+    Mr = Mr_loc.cast<std::complex<double>>();
+  };
+  Project(*dom_post_op.M_elec, e, dom_post_op.D, rom.M_elec);
+  Project(*dom_post_op.M_mag, b, dom_post_op.H, rom.M_mag);
+  rom.M_i.clear();
+  for (const auto &[idx, data] : dom_post_op.M_i)
+  {
+    auto &[M_elec_i, M_mag_i] = rom.M_i[idx];
+    if (data.first)
+    {
+      Project(*data.first, e, dom_post_op.D, M_elec_i);
+    }
+    if (data.second)
+    {
+      Project(*data.second, b, dom_post_op.H, M_mag_i);
+    }
+  }
+
+  // Evaluate the lumped port voltage and S-parameter functionals and the probes for each
+  // basis vector.
+  rom.lumped_port_vs.clear();
+  for (const auto &[idx, data] : lumped_port_op)
+  {
+    rom.lumped_port_vs[idx] = {Eigen::VectorXcd(dim), Eigen::VectorXcd(dim)};
+  }
+  const int n_probe_E = interp_op.GetProbes().size() ? interp_op.ProbeField(*E).size() : 0;
+  const int n_probe_B = interp_op.GetProbes().size() ? interp_op.ProbeField(*B).size() : 0;
+  rom.probe_E.resize(n_probe_E, dim);
+  rom.probe_B.resize(n_probe_B, dim);
+  E->Imag() = 0.0;
+  B->Imag() = 0.0;
+  for (int j = 0; j < dim; j++)
+  {
+    E->Real() = e[j];
+    B->Real() = b[j];
+    for (const auto &[idx, data] : lumped_port_op)
+    {
+      auto &[v, s] = rom.lumped_port_vs[idx];
+      v(j) = data.GetVoltage(*E);
+      s(j) = data.GetSParameter(*E);
+    }
+    if (n_probe_E > 0)
+    {
+      const auto vE = interp_op.ProbeField(E->Real());
+      const auto vB = interp_op.ProbeField(B->Real());
+      for (int i = 0; i < n_probe_E; i++)
+      {
+        rom.probe_E(i, j) = vE[i];
+      }
+      for (int i = 0; i < n_probe_B; i++)
+      {
+        rom.probe_B(i, j) = vB[i];
+      }
+    }
+  }
+  lumped_port_init = wave_port_init = false;
+  rom_init = true;
+  return true;
+}
+
+void PostOperator::SetReducedSolution(const Eigen::VectorXcd &y, double omega)
+{
+  MFEM_VERIFY(rom_init && y.size() == rom.M_elec.rows(),
+              "Incorrect usage of PostOperator::SetReducedSolution!");
+  rom_y = y;
+  rom_omega = omega;
+  rom_active = true;
+  lumped_port_init = wave_port_init = false;
+}
+
+void PostOperator::SetBlockSolutions(const std::vector<ComplexVector> &e,
+                                     const std::vector<ComplexVector> &b,
+                                     const LumpedPortOperator &lumped_port_op)
+{
+  MFEM_VERIFY(HasImag() && E && B && e.size() == b.size(),
+              "Incorrect usage of PostOperator::SetBlockSolutions!");
+
+  // Accumulate the local contributions for each solution (the electric and magnetic field
+  // energies, followed by the voltage and S-parameter of each lumped port), which are then
+  // reduced together. The grid functions are used as temporary storage.
+  const int n = static_cast<int>(e.size());
+  const int stride = 2 + 4 * static_cast<int>(lumped_port_op.Size());
+  std::vector<double> dots(n * stride, 0.0);
+  for (int i = 0; i < n; i++)
+  {
+    E->Real().SetFromTrueDofs(e[i].Real());
+    E->Imag().SetFromTrueDofs(e[i].Imag());
+    B->Real().SetFromTrueDofs(b[i].Real());
+    B->Imag().SetFromTrueDofs(b[i].Imag());
+    double *dot = dots.data() + i * stride;
+    for (auto *u : {&E->Real(), &E->Imag()})
+    {
+      dom_post_op.M_elec->Mult(*u, dom_post_op.D);
+      dot[0] += linalg::LocalDot(*u, dom_post_op.D);
+    }
+    for (auto *u : {&B->Real(), &B->Imag()})
+    {
+      dom_post_op.M_mag->Mult(*u, dom_post_op.H);
+      dot[1] += linalg::LocalDot(*u, dom_post_op.H);
+    }
+    int k = 2;
+    for (const auto &[idx, data] : lumped_port_op)
+    {
+      const auto v = data.GetLocalVoltage(*E), s = data.GetLocalSParameter(*E);
+      dot[k++] = v.real();
+      dot[k++] = v.imag();
+      dot[k++] = s.real();
+      dot[k++] = s.imag();
+    }
+  }
+  Mpi::GlobalSum(n * stride, dots.data(), GetComm());
+
+  block.E_elec.resize(n);
+  block.E_mag.resize(n);
+  block.lumped_port_vs.clear();
+  for (int i = 0; i < n; i++)
+  {
+    const double *dot = dots.data() + i * stride;
+    block.E_elec[i] = 0.5 * dot[0];
+    block.E_mag[i] = 0.5 * dot[1];
+    int k = 2;
+    for (const auto &[idx, data] : lumped_port_op)
+    {
+      block.lumped_port_vs[idx].emplace_back(std::complex<double>(dot[k], dot[k + 1]),
+                                             std::complex<double>(dot[k + 2], dot[k + 3]));
+      k += 4;
+    }
+  }
+  lumped_port_init = wave_port_init = false;
+  rom_active = false;
+  block_idx = -1;
+}
+
+void PostOperator::SetBlockIndex(int i)
+{
+  MFEM_VERIFY(i >= 0 && i < static_cast<int>(block.E_elec.size()),
+              "Invalid block solution index for PostOperator::SetBlockIndex!");
+  block_idx = i;
+  lumped_port_init = false;
+}
+
 double PostOperator::GetEFieldEnergy() const
 {
+  if (rom_active)
+  {
+    return 0.5 * rom_y.dot(rom.M_elec * rom_y).real();
+  }
+  if (block_idx >= 0)
+  {
+    return block.E_elec[block_idx];
+  }
   if (V)
   {
     return dom_post_op.GetElectricFieldEnergy(*V);
@@ -361,6 +570,14 @@ double PostOperator::GetEFieldEnergy() const
 
 double PostOperator::GetHFieldEnergy() const
 {
+  if (rom_active)
+  {
+    return 0.5 / (rom_omega * rom_omega) * rom_y.dot(rom.M_mag * rom_y).real();
+  }
+  if (block_idx >= 0)
+  {
+    return block.E_mag[block_idx];
+  }
   if (A)
   {
     return dom_post_op.GetMagneticFieldEnergy(*A);
@@ -374,6 +591,14 @@ double PostOperator::GetHFieldEnergy() const
 
 double PostOperator::GetEFieldEnergy(int idx) const
 {
+  if (rom_active)
+  {
+    auto it = rom.M_i.find(idx);
+    MFEM_VERIFY(it != rom.M_i.end(),
+                "Invalid domain index when postprocessing domain electric field energy!");
+    const auto &M_elec_i = it->second.first;
+    return (M_elec_i.size() > 0) ? 0.5 * rom_y.dot(M_elec_i * rom_y).real() : 0.0;
+  }
   if (V)
   {
     return dom_post_op.GetDomainElectricFieldEnergy(idx, *V);
@@ -387,6 +612,16 @@ double PostOperator::GetEFieldEnergy(int idx) const
 
 double PostOperator::GetHFieldEnergy(int idx) const
 {
+  if (rom_active)
+  {
+    auto it = rom.M_i.find(idx);
+    MFEM_VERIFY(it != rom.M_i.end(),
+                "Invalid domain index when postprocessing domain magnetic field energy!");
+    const auto &M_mag_i = it->second.second;
+    return (M_mag_i.size() > 0)
+               ? 0.5 / (rom_omega * rom_omega) * rom_y.dot(M_mag_i * rom_y).real()
+               : 0.0;
+  }
   if (A)
   {
     return dom_post_op.GetDomainMagneticFieldEnergy(idx, *A);
@@ -403,6 +638,7 @@ std::complex<double> PostOperator::GetSurfaceFlux(int idx) const
   // Compute the flux through a surface as Φ_j = ∫ F ⋅ n_j dS, with F = B, F = ε D, or F =
   // E x H. The special coefficient is used to avoid issues evaluating MFEM GridFunctions
   // which are discontinuous at interior boundary elements.
+  MFEM_VERIFY(!rom_active, "Surface flux postprocessing requires the full-space solution!");
   return surf_post_op.GetSurfaceFlux(idx, E.get(), B.get());
 }
 
@@ -414,6 +650,8 @@ double PostOperator::GetInterfaceParticipation(int idx, double E_m) const
   // with:
   //          p_mj = 1/2 t_j Re{∫_{Γ_j} (ε_j E_m)ᴴ E_m dS} /(E_elec + E_cap).
   MFEM_VERIFY(E, "Surface Q not defined, no electric field solution found!");
+  MFEM_VERIFY(!rom_active,
+              "Interface participation postprocessing requires the full-space solution!");
   return surf_post_op.GetInterfaceElectricFieldEnergy(idx, *E) / E_m;
 }
 
@@ -427,8 +665,25 @@ void PostOperator::UpdatePorts(const LumpedPortOperator &lumped_port_op, double
   for (const auto &[idx, data] : lumped_port_op)
   {
     auto &vi = lumped_port_vi[idx];
-    vi.P = data.GetPower(*E, *B);
-    vi.V = data.GetVoltage(*E);
+    if (rom_active)
+    {
+      // The port voltage and S-parameter are linear functionals of the field, evaluated
+      // from the PROM solution coefficients. The port power is not available.
+      vi.P = 0.0;
+      vi.V = rom.lumped_port_vs.at(idx).first.dot(rom_y);
+    }
+    else if (block_idx >= 0)
+    {
+      // The port voltage and S-parameter have been precomputed for the block solution. The
+      // port power is not available.
+      vi.P = 0.0;
+      vi.V = block.lumped_port_vs.at(idx)[block_idx].first;
+    }
+    else
+    {
+      vi.P = data.GetPower(*E, *B);
+      vi.V = data.GetVoltage(*E);
+    }
     if (HasImag())
     {
       // Compute current from the port impedance, separate contributions for R, L, C
@@ -448,7 +703,9 @@ void PostOperator::UpdatePorts(const LumpedPortOperator &lumped_port_op, double
           (std::abs(data.C) > 0.0)
               ? vi.V / data.GetCharacteristicImpedance(omega, LumpedPortData::Branch::C)
               : 0.0;
-      vi.S = data.GetSParameter(*E);
+      vi.S = rom_active            ? rom.lumped_port_vs.at(idx).second.dot(rom_y)
+             : (block_idx >= 0) ? block.lumped_port_vs.at(idx)[block_idx].second
+                                : data.GetSParameter(*E);
     }
     else
     {
@@ -463,6 +720,8 @@ void PostOperator::UpdatePorts(const LumpedPortOperator &lumped_port_op, double
 void PostOperator::UpdatePorts(const WavePortOperator &wave_port_op, double omega)
 {
   MFEM_VERIFY(HasImag() && E && B, "Incorrect usage of PostOperator::UpdatePorts!");
+  MFEM_VERIFY(!rom_active || wave_port_op.Size() == 0,
+              "Wave port postprocessing requires the full-space solution!");
   if (wave_port_init)
   {
     return;
@@ -714,6 +973,7 @@ void ScaleGridFunctions(double L, int dim, bool imag, T &E, T &B, T &V, T &A)
 
 void PostOperator::WriteFields(int step, double time) const
 {
+  MFEM_VERIFY(!rom_active, "Field output requires the full-space solution!");
   // Given the electric field and magnetic flux density, write the fields to disk for
   // visualization. Write the mesh coordinates in the same units as originally input.
   mfem::ParMesh &mesh =
@@ -808,12 +1068,22 @@ void PostOperator::WriteFieldsFinal(const ErrorIndicator *indicator) const
 std::vector<std::complex<double>> PostOperator::ProbeEField() const
 {
   MFEM_VERIFY(E, "PostOperator is not configured for electric field probes!");
+  if (rom_active)
+  {
+    const Eigen::VectorXcd v = rom.probe_E * rom_y;
+    return std::vector<std::complex<double>>(v.data(), v.data() + v.size());
+  }
   return interp_op.ProbeField(*E);
 }
 
 std::vector<std::complex<double>> PostOperator::ProbeBField() const
 {
   MFEM_VERIFY(B, "PostOperator is not configured for magnetic flux density probes!");
+  if (rom_active)
+  {
+    const Eigen::VectorXcd v = (1i / rom_omega) * (rom.probe_B * rom_y);
+    return std::vector<std::complex<double>>(v.data(), v.data() + v.size());
+  }
   return interp_op.ProbeField(*B);
 }
 
@@ -8,7 +8,9 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
+#include <Eigen/Dense>
 #include <mfem.hpp>
 #include "fem/gridfunction.hpp"
 #include "fem/interpolator.hpp"
@@ -64,6 +66,31 @@ private:
   std::map<int, PortPostData> lumped_port_vi, wave_port_vi;
   bool lumped_port_init, wave_port_init;
 
+  // Reduced-order postprocessing for a PROM solution E = V y with a real-valued basis V.
+  // The energy matrices are projected onto the basis (and its curl for the magnetic field
+  // energy), and the lumped port and probe functionals are evaluated for each basis vector,
+  // so postprocessing costs only O(n²) for a basis of dimension n.
+  struct ReducedPostData
+  {
+    Eigen::MatrixXcd M_elec, M_mag, probe_E, probe_B;
+    std::map<int, std::pair<Eigen::MatrixXcd, Eigen::MatrixXcd>> M_i;
+    std::map<int, std::pair<Eigen::VectorXcd, Eigen::VectorXcd>> lumped_port_vs;
+  } rom;
+  Eigen::VectorXcd rom_y;
+  double rom_omega;
+  bool rom_init, rom_active;
+
+  // Field energies and lumped port voltages and S-parameters precomputed for a block of
+  // solutions, and the index of the block solution which the grid functions correspond to
+  // (or -1).
+  struct BlockPostData
+  {
+    std::vector<double> E_elec, E_mag;
+    std::map<int, std::vector<std::pair<std::complex<double>, std::complex<double>>>>
+        lumped_port_vs;
+  } block;
+  int block_idx;
+
   // Data collection for writing fields to disk for visualization and sampling points.
   mutable mfem::ParaViewDataCollection paraview, paraview_bdr;
   mutable InterpolationOperator interp_op;
@@ -96,6 +123,29 @@ public:
   void SetVGridFunction(const Vector &v, bool exchange_face_nbr_data = true);
   void SetAGridFunction(const Vector &a, bool exchange_face_nbr_data = true);
 
+  // Configure reduced-order postprocessing for solutions in the span of the first n
+  // (real-valued) basis vectors of V. Returns false if the postprocessing configuration
+  // requires the full-space solution (surface postprocessing or wave ports).
+  bool SetReducedBasis(const std::vector<Vector> &V, std::size_t n, const Operator &Curl,
+                       const LumpedPortOperator &lumped_port_op,
+                       const WavePortOperator &wave_port_op);
+
+  // Set the PROM solution coefficients at the given frequency for reduced-order
+  // postprocessing, in place of the grid functions. Quantities requiring the full-space
+  // solution (surface postprocessing, port powers, and field output) are not available
+  // until the grid functions are set again.
+  void SetReducedSolution(const Eigen::VectorXcd &y, double omega);
+
+  // Precompute the field energies and the lumped port voltages and S-parameters for a block
+  // of complex-valued solutions on the true dofs, combining the global reductions for all
+  // of them. After the grid functions are set for solution i of the block,
+  // SetBlockIndex(i) selects its precomputed values for the field energies and UpdatePorts
+  // (the port power is not available), until the grid functions are set again.
+  void SetBlockSolutions(const std::vector<ComplexVector> &e,
+                         const std::vector<ComplexVector> &b,
+                         const LumpedPortOperator &lumped_port_op);
+  void SetBlockIndex(int i);
+
   // Access grid functions for field solutions.
   auto &GetEGridFunction()
   {
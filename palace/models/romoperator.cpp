@@ -3,6 +3,12 @@
 
 #include "romoperator.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <tuple>
 #include <Eigen/SVD>
 #include <mfem.hpp>
 #include "linalg/orthog.hpp"
@@ -31,6 +37,19 @@ namespace
 
 constexpr auto ORTHOG_TOL = 1.0e-12;
 
+// Relative tolerance for the boundary coefficients of A2(ω) to be considered in the span of
+// the snapshots for its affine approximation. This is well above the accuracy with which
+// the residual of the least-squares fit can be computed from the Gram matrix.
+constexpr auto A2_TOL = 1.0e-6;
+
+// Relative tolerance for the estimated error of the wave port propagation constants and
+// projected excitation vectors interpolated between sample points, above which they are
+// computed directly instead.
+constexpr auto INTERP_TOL = 1.0e-6;
+
+// Version number for the PROM model file format.
+constexpr std::int64_t MODEL_VERSION = 3;
+
 template <typename VecType, typename ScalarType>
 inline void OrthogonalizeColumn(GmresSolverBase::OrthogType type, MPI_Comm comm,
                                 const std::vector<VecType> &V, VecType &w, ScalarType *Rj,
@@ -51,21 +70,20 @@ inline void OrthogonalizeColumn(GmresSolverBase::OrthogType type, MPI_Comm comm,
   }
 }
 
-inline void ProjectMatInternal(MPI_Comm comm, const std::vector<Vector> &V,
-                               const ComplexOperator &A, Eigen::MatrixXcd &Ar,
-                               ComplexVector &r, int n0)
+inline void ProjectMatLocal(const std::vector<Vector> &V, const ComplexOperator &A,
+                            Eigen::MatrixXcd &Ar, ComplexVector &r, int n0)
 {
-  // Update Ar = Vᴴ A V for the new basis dimension n0 -> n. V is real and thus the result
-  // is complex symmetric if A is symmetric (which we assume is the case). Ar is replicated
-  // across all processes as a sequential n x n matrix.
+  // Compute the local contributions to the new columns of Ar = Vᴴ A V for the basis
+  // dimension n0 -> n. V is real and thus the result is complex symmetric if A is symmetric
+  // (which we assume is the case). The global reduction is performed by ProjectReduce.
   const auto n = Ar.rows();
   MFEM_VERIFY(n0 < n, "Invalid dimensions in PROM matrix projection!");
+  MFEM_VERIFY(A.Real() || A.Imag(),
+              "Invalid zero ComplexOperator for PROM matrix projection!");
   for (int j = n0; j < n; j++)
   {
     // Fill block of Vᴴ A V = [  | Vᴴ A vj ] . We can optimize the matrix-vector product
     // since the columns of V are real.
-    MFEM_VERIFY(A.Real() || A.Imag(),
-                "Invalid zero ComplexOperator for PROM matrix projection!");
     if (A.Real())
     {
       A.Real()->Mult(V[j], r.Real());
@@ -80,24 +98,13 @@ inline void ProjectMatInternal(MPI_Comm comm, const std::vector<Vector> &V,
       Ar(i, j).imag(A.Imag() ? V[i] * r.Imag() : 0.0);
     }
   }
-  Mpi::GlobalSum((n - n0) * n, Ar.data() + n0 * n, comm);
-
-  // Fill lower block of Vᴴ A V = [ ____________  |  ]
-  //                              [ vjᴴ A V[1:n0] |  ] .
-  for (int j = 0; j < n0; j++)
-  {
-    for (int i = n0; i < n; i++)
-    {
-      Ar(i, j) = Ar(j, i);
-    }
-  }
 }
 
-inline void ProjectVecInternal(MPI_Comm comm, const std::vector<Vector> &V,
-                               const ComplexVector &b, Eigen::VectorXcd &br, int n0)
+inline void ProjectVecLocal(const std::vector<Vector> &V, const ComplexVector &b,
+                            Eigen::VectorXcd &br, int n0)
 {
-  // Update br = Vᴴ b for the new basis dimension n0 -> n. br is replicated across all
-  // processes as a sequential n-dimensional vector.
+  // Compute the local contributions to the new entries of br = Vᴴ b for the basis dimension
+  // n0 -> n.
   const auto n = br.size();
   MFEM_VERIFY(n0 < n, "Invalid dimensions in PROM vector projection!");
   for (int i = n0; i < n; i++)
@@ -105,7 +112,55 @@ inline void ProjectVecInternal(MPI_Comm comm, const std::vector<Vector> &V,
     br(i).real(V[i] * b.Real());  // Local inner product
     br(i).imag(V[i] * b.Imag());
   }
-  Mpi::GlobalSum(n - n0, br.data() + n0, comm);
+}
+
+inline void ProjectReduce(MPI_Comm comm, const std::vector<Eigen::MatrixXcd *> &Ar,
+                          const std::vector<Eigen::VectorXcd *> &br, int n0)
+{
+  // Sum the local contributions to the new entries of all of the projected matrices and
+  // vectors using a single global reduction. The results are replicated across all
+  // processes as sequential n x n matrices and n-dimensional vectors.
+  std::size_t size = 0;
+  for (const auto *A : Ar)
+  {
+    size += (A->cols() - n0) * A->rows();
+  }
+  for (const auto *b : br)
+  {
+    size += b->size() - n0;
+  }
+  std::vector<std::complex<double>> buf(size);
+  auto *p = buf.data();
+  for (const auto *A : Ar)
+  {
+    p = std::copy_n(A->data() + n0 * A->rows(), (A->cols() - n0) * A->rows(), p);
+  }
+  for (const auto *b : br)
+  {
+    p = std::copy_n(b->data() + n0, b->size() - n0, p);
+  }
+  Mpi::GlobalSum(size, buf.data(), comm);
+  p = buf.data();
+  for (auto *A : Ar)
+  {
+    std::copy_n(p, (A->cols() - n0) * A->rows(), A->data() + n0 * A->rows());
+    p += (A->cols() - n0) * A->rows();
+
+    // Fill lower block of Vᴴ A V = [ ____________  |  ]
+    //                              [ vjᴴ A V[1:n0] |  ] .
+    for (int j = 0; j < n0; j++)
+    {
+      for (int i = n0; i < A->rows(); i++)
+      {
+        (*A)(i, j) = (*A)(j, i);
+      }
+    }
+  }
+  for (auto *b : br)
+  {
+    std::copy_n(p, b->size() - n0, b->data() + n0);
+    p += b->size() - n0;
+  }
 }
 
 inline void ComputeMRI(const Eigen::MatrixXcd &R, Eigen::VectorXcd &q)
@@ -199,13 +254,26 @@ RomOperator::RomOperator(const IoData &iodata, SpaceOperator &space_op, int max_
   MFEM_VERIFY(K && M, "Invalid empty HDM matrices when constructing PROM!");
 
   // Set up RHS vector (linear in frequency part) for the incident field at port boundaries,
-  // and the vector for the solution, which satisfies the Dirichlet (PEC) BC.
-  has_RHS1 = space_op.GetExcitationVector1(RHS1);
-  if (!has_RHS1)
+  // and the vector for the solution, which satisfies the Dirichlet (PEC) BC. For
+  // multi-excitation sweeps, a separate vector is assembled for each excited port.
+  if (iodata.solver.driven.multi_excitation)
   {
-    RHS1.SetSize(0);
+    excitation_idx = space_op.GetExcitationIndices();
   }
+  RHS1.resize(std::max(excitation_idx.size(), std::size_t(1)));
+  RHS1r.resize(RHS1.size());
+  for (std::size_t e = 0; e < RHS1.size(); e++)
+  {
+    SetExcitation(e);
+    if (!space_op.GetExcitationVector1(RHS1[e]))
+    {
+      RHS1[e].SetSize(0);
+    }
+  }
+  SetExcitation(-1);
   has_A2 = has_RHS2 = true;
+  omega_A = omega_Ar = -1.0;
+  dim_QW = dim_W = 0;
 
   // Initialize working vector storage.
   r.SetSize(K->Height());
@@ -217,12 +285,14 @@ RomOperator::RomOperator(const IoData &iodata, SpaceOperator &space_op, int max_
   // matrix.
   ksp = std::make_unique<ComplexKspSolver>(iodata, space_op.GetNDSpaces(),
                                            &space_op.GetH1Spaces());
+  omega_pc = 0.0;
+  pc_reuse_tol = iodata.solver.linear.pc_reuse_tol;
 
   // The initial PROM basis is empty. The provided maximum dimension is the number of sample
-  // points (2 basis vectors per point). Basis orthogonalization method is configured using
-  // GMRES/FGMRES settings.
+  // points (2 basis vectors per point and excitation). Basis orthogonalization method is
+  // configured using GMRES/FGMRES settings.
   MFEM_VERIFY(max_size > 0, "Reduced order basis storage must have > 0 columns!");
-  V.resize(2 * max_size, Vector());
+  V.resize(2 * max_size * RHS1.size(), Vector());
   Q.resize(max_size, ComplexVector());
   dim_V = dim_Q = 0;
   switch (iodata.solver.linear.gs_orthog_type)
@@ -239,43 +309,293 @@ RomOperator::RomOperator(const IoData &iodata, SpaceOperator &space_op, int max_
   }
 }
 
-void RomOperator::SolveHDM(double omega, ComplexVector &u)
+void RomOperator::SetExcitation(int e)
 {
-  // Compute HDM solution at the given frequency. The system matrix, A = K + iω C - ω² M +
-  // A2(ω) is built by summing the underlying operator contributions.
-  A2 = space_op.GetExtraSystemMatrix<ComplexOperator>(omega, Operator::DIAG_ZERO);
-  has_A2 = (A2 != nullptr);
-  auto A = space_op.GetSystemMatrix(std::complex<double>(1.0, 0.0), 1i * omega,
-                                    std::complex<double>(-omega * omega, 0.0), K.get(),
-                                    C.get(), M.get(), A2.get());
-  auto P =
-      space_op.GetPreconditionerMatrix<ComplexOperator>(1.0, omega, -omega * omega, omega);
-  ksp->SetOperators(*A, *P);
-
-  // The HDM excitation vector is computed as RHS = iω RHS1 + RHS2(ω).
-  Mpi::Print("\n");
-  if (has_RHS2)
+  if (!excitation_idx.empty())
   {
-    has_RHS2 = space_op.GetExcitationVector2(omega, r);
+    space_op.SetExcitationIndex((e < 0) ? -1 : excitation_idx[e]);
+  }
+}
+
+void RomOperator::AssembleHDM(double omega)
+{
+  // The system matrix, A = K + iω C - ω² M + A2(ω) is built by summing the underlying
+  // operator contributions.
+  if (!A || omega != omega_A)
+  {
+    A2 = space_op.GetExtraSystemMatrix<ComplexOperator>(omega, Operator::DIAG_ZERO);
+    has_A2 = (A2 != nullptr);
+    A = space_op.GetSystemMatrix(std::complex<double>(1.0, 0.0), 1i * omega,
+                                 std::complex<double>(-omega * omega, 0.0), K.get(),
+                                 C.get(), M.get(), A2.get());
+    AddBoundarySample(omega);
+    if (!P || std::abs(omega - omega_pc) > pc_reuse_tol * std::abs(omega_pc))
+    {
+      P = space_op.GetPreconditionerMatrix<ComplexOperator>(1.0, omega, -omega * omega,
+                                                            omega);
+      ksp->SetOperators(*A, *P);
+      omega_pc = omega;
+    }
+    else
+    {
+      ksp->SetOperator(*A);
+    }
+    omega_A = omega;
+  }
+}
+
+void RomOperator::GetHDMExcitation(double omega, int e, ComplexVector &b)
+{
+  // The HDM excitation vector is computed as RHS = iω RHS1 + RHS2(ω), where RHS2(ω) is
+  // recorded at the sample point when the system matrix is assembled.
+  const auto k = std::find(omega_k.begin(), omega_k.end(), omega) - omega_k.begin();
+  if (has_RHS2 && k < static_cast<std::ptrdiff_t>(RHS2k.size()) && !RHS2k[k].empty())
+  {
+    b = RHS2k[k][e];
+  }
+  else if (has_RHS2)
+  {
+    SetExcitation(e);
+    has_RHS2 = space_op.GetExcitationVector2(omega, b);
+    SetExcitation(-1);
   }
   else
   {
-    r = 0.0;
+    b = 0.0;
   }
-  if (has_RHS1)
+  if (RHS1[e].Size())
   {
-    r.Add(1i * omega, RHS1);
+    b.Add(1i * omega, RHS1[e]);
   }
+}
 
-  // Solve the linear system.
+void RomOperator::SolveHDM(double omega, ComplexVector &u, int e)
+{
+  // Compute HDM solution at the given frequency.
+  MFEM_VERIFY(e >= 0 && e < GetNumExcitations(),
+              "Invalid excitation index for HDM solve!");
+  AssembleHDM(omega);
+  Mpi::Print("\n");
+  GetHDMExcitation(omega, e, r);
   ksp->Mult(r, u);
 }
 
+void RomOperator::SolveHDM(double omega, std::vector<ComplexVector> &u)
+{
+  // Compute HDM solutions at the given frequency for all excitations, solved one after
+  // another with the same system matrix and preconditioner.
+  MFEM_VERIFY(static_cast<int>(u.size()) == GetNumExcitations(),
+              "Invalid number of solution vectors for multi-excitation HDM solve!");
+  AssembleHDM(omega);
+  Mpi::Print("\n");
+  std::vector<ComplexVector> b(u.size());
+  for (std::size_t e = 0; e < u.size(); e++)
+  {
+    b[e].SetSize(r.Size());
+    b[e].UseDevice(true);
+    GetHDMExcitation(omega, static_cast<int>(e), b[e]);
+  }
+  ksp->ArrayMult(b, u);
+}
+
+void RomOperator::AddHDMSample(double omega)
+{
+  // The system matrix is assembled again at the next HDM solve, since it may refer to the
+  // previous A2(ω).
+  A.reset();
+  omega_A = -1.0;
+  A2 = space_op.GetExtraSystemMatrix<ComplexOperator>(omega, Operator::DIAG_ZERO);
+  has_A2 = (A2 != nullptr);
+  AddBoundarySample(omega);
+  A2.reset();
+}
+
 void RomOperator::UpdatePROM(double omega, const ComplexVector &u)
+{
+  MFEM_VERIFY(GetNumExcitations() == 1,
+              "Multi-excitation PROM update requires solutions for all excitations!");
+  UpdatePROM(std::vector<double>{omega}, std::vector<const ComplexVector *>{&u});
+}
+
+void RomOperator::UpdatePROM(const std::vector<double> &omega,
+                             const std::vector<const ComplexVector *> &u)
+{
+  // Add all of the samples to the reduced-order basis before updating the PROM, so that the
+  // projection of the HDM operators onto the new basis vectors is performed only once for
+  // the batch.
+  const std::size_t n_exc = RHS1.size();
+  MFEM_VERIFY(omega.size() * n_exc == u.size(),
+              "Mismatch in number of frequencies and solution vectors for PROM update!");
+  BlockTimer bt(Timer::CONSTRUCT_PROM);
+  const std::size_t dim_V0 = dim_V;
+  ComplexVector u_sum;
+  for (std::size_t i = 0; i < omega.size(); i++)
+  {
+    for (std::size_t e = 0; e < n_exc; e++)
+    {
+      AddBasisVector(*u[i * n_exc + e]);
+    }
+    if (n_exc == 1)
+    {
+      AddMRISample(omega[i], *u[i]);
+      continue;
+    }
+    u_sum.SetSize(u[i * n_exc]->Size());
+    u_sum.UseDevice(true);
+    u_sum = *u[i * n_exc];
+    for (std::size_t e = 1; e < n_exc; e++)
+    {
+      u_sum.Add(1.0, *u[i * n_exc + e]);
+    }
+    AddMRISample(omega[i], u_sum);
+  }
+  ProjectOperators(dim_V0);
+}
+
+void RomOperator::ProjectOperators(std::size_t dim_V0)
+{
+  // Update reduced-order operators. Resize preserves the upper dim0 x dim0 block of each
+  // matrix and first dim0 entries of each vector and the projection uses the values
+  // computed for the unchanged basis vectors.
+  // The operators are applied to each new basis vector and all of the new entries of the
+  // reduced-order operators are summed with a single global reduction.
+  std::vector<Eigen::MatrixXcd *> mats = {&Kr, &Mr};
+  std::vector<Eigen::VectorXcd *> vecs;
+  Kr.conservativeResize(dim_V, dim_V);
+  ProjectMatLocal(V, *K, Kr, r, dim_V0);
+  if (C)
+  {
+    Cr.conservativeResize(dim_V, dim_V);
+    ProjectMatLocal(V, *C, Cr, r, dim_V0);
+    mats.push_back(&Cr);
+  }
+  Mr.conservativeResize(dim_V, dim_V);
+  ProjectMatLocal(V, *M, Mr, r, dim_V0);
+  std::vector<Eigen::MatrixXcd *> mats_new;
+  for (std::size_t k = 0; k < A2k.size(); k++)
+  {
+    // Snapshots of A2 added since the last update are projected onto the full basis.
+    const bool new_k = (A2rk[k].cols() == 0 && dim_V0 > 0);
+    A2rk[k].conservativeResize(dim_V, dim_V);
+    ProjectMatLocal(V, *A2k[k], A2rk[k], r, new_k ? 0 : dim_V0);
+    (new_k ? mats_new : mats).push_back(&A2rk[k]);
+  }
+  Ar.resize(dim_V, dim_V);
+  omega_Ar = -1.0;
+  for (std::size_t e = 0; e < RHS1.size(); e++)
+  {
+    if (RHS1[e].Size())
+    {
+      RHS1r[e].conservativeResize(dim_V);
+      ProjectVecLocal(V, RHS1[e], RHS1r[e], dim_V0);
+      vecs.push_back(&RHS1r[e]);
+    }
+  }
+  std::vector<Eigen::VectorXcd *> vecs_new;
+  for (std::size_t k = 0; k < RHS2k.size(); k++)
+  {
+    for (std::size_t e = 0; e < RHS2k[k].size(); e++)
+    {
+      const bool new_k = (RHS2rk[k][e].size() == 0 && dim_V0 > 0);
+      RHS2rk[k][e].conservativeResize(dim_V);
+      ProjectVecLocal(V, RHS2k[k][e], RHS2rk[k][e], new_k ? 0 : dim_V0);
+      (new_k ? vecs_new : vecs).push_back(&RHS2rk[k][e]);
+    }
+  }
+  ProjectReduce(space_op.GetComm(), mats, vecs, dim_V0);
+  if (!mats_new.empty() || !vecs_new.empty())
+  {
+    ProjectReduce(space_op.GetComm(), mats_new, vecs_new, 0);
+  }
+  RHSr.resize(dim_V);
+
+  // The residual-based error estimate is only available when the HDM samples have shown
+  // that the system matrix and excitation are affine in the frequency.
+  if (!has_A2 && !has_RHS2)
+  {
+    UpdateResidualQR();
+  }
+}
+
+void RomOperator::UpdateResidualQR()
+{
+  // Apply the HDM operators to the new basis vectors and orthonormalize the results against
+  // the previous columns of QW, updating W = QW RW. The columns of W for basis vector j are
+  // stored at j, N + j, and 2 N + j of RW, where N is the basis storage size, followed by
+  // the excitation vectors. Columns of W which are numerically in the span of the previous
+  // ones do not add a column to QW.
+  BlockTimer bt(Timer::CONSTRUCT_PROM);
+  MPI_Comm comm = space_op.GetComm();
+  const std::size_t N = V.size(), dim_W0 = dim_W;
+  if (dim_W0 == 0)
+  {
+    QW.resize(3 * N + RHS1.size());
+    RW.setZero(3 * N + RHS1.size(), 3 * N + RHS1.size());
+    dim_QW = 0;
+  }
+  auto Orthogonalize = [&](std::size_t k)
+  { OrthonormalizeColumn(orthog_type, comm, QW, dim_QW, RW.col(k).data()); };
+  auto Apply = [&](const ComplexOperator &A, const Vector &v, std::size_t k)
+  {
+    auto &w = QW[dim_QW];
+    w.SetSize(v.Size());
+    w.UseDevice(true);
+    w = 0.0;
+    if (A.Real())
+    {
+      A.Real()->Mult(v, w.Real());
+    }
+    if (A.Imag())
+    {
+      A.Imag()->Mult(v, w.Imag());
+    }
+    Orthogonalize(k);
+  };
+  if (dim_W0 == 0)
+  {
+    for (std::size_t e = 0; e < RHS1.size(); e++)
+    {
+      if (RHS1[e].Size())
+      {
+        QW[dim_QW].SetSize(RHS1[e].Size());
+        QW[dim_QW].UseDevice(true);
+        QW[dim_QW] = RHS1[e];
+        Orthogonalize(3 * N + e);
+      }
+    }
+  }
+  for (std::size_t j = dim_W0; j < dim_V; j++)
+  {
+    Apply(*K, V[j], j);
+    if (C)
+    {
+      Apply(*C, V[j], N + j);
+    }
+    Apply(*M, V[j], 2 * N + j);
+  }
+  dim_W = dim_V;
+}
+
+void RomOperator::OrthonormalizeColumn(GmresSolverBase::OrthogType type, MPI_Comm comm,
+                                      std::vector<ComplexVector> &Q, std::size_t &dim_Q,
+                                      std::complex<double> *Rk)
+{
+  auto &w = Q[dim_Q];
+  const double norm0 = linalg::Norml2(comm, w);
+  OrthogonalizeColumn(type, comm, Q, w, Rk, static_cast<int>(dim_Q));
+  const double norm = linalg::Norml2(comm, w);
+  if (norm > ORTHOG_TOL * norm0)
+  {
+    Rk[dim_Q] = norm;
+    w *= 1.0 / norm;
+    dim_Q++;
+  }
+}
+
+void RomOperator::AddBasisVector(const ComplexVector &u)
 {
   // Update V. The basis is always real (each complex solution adds two basis vectors if it
   // has a nonzero real and imaginary parts).
-  BlockTimer bt(Timer::CONSTRUCT_PROM);
   MPI_Comm comm = space_op.GetComm();
   const double normr = linalg::Norml2(comm, u.Real());
   const double normi = linalg::Norml2(comm, u.Imag());
@@ -283,7 +603,6 @@ void RomOperator::UpdatePROM(double omega, const ComplexVector &u)
   const bool has_imag = (normi > ORTHOG_TOL * std::sqrt(normr * normr + normi * normi));
   MFEM_VERIFY(dim_V + has_real + has_imag <= V.size(),
               "Unable to increase basis storage size, increase maximum number of vectors!");
-  const std::size_t dim_V0 = dim_V;
   std::vector<double> H(dim_V + has_real + has_imag);
   if (has_real)
   {
@@ -301,30 +620,14 @@ void RomOperator::UpdatePROM(double omega, const ComplexVector &u)
     V[dim_V] *= 1.0 / H[dim_V];
     dim_V++;
   }
+}
 
-  // Update reduced-order operators. Resize preserves the upper dim0 x dim0 block of each
-  // matrix and first dim0 entries of each vector and the projection uses the values
-  // computed for the unchanged basis vectors.
-  Kr.conservativeResize(dim_V, dim_V);
-  ProjectMatInternal(comm, V, *K, Kr, r, dim_V0);
-  if (C)
-  {
-    Cr.conservativeResize(dim_V, dim_V);
-    ProjectMatInternal(comm, V, *C, Cr, r, dim_V0);
-  }
-  Mr.conservativeResize(dim_V, dim_V);
-  ProjectMatInternal(comm, V, *M, Mr, r, dim_V0);
-  Ar.resize(dim_V, dim_V);
-  if (RHS1.Size())
-  {
-    RHS1r.conservativeResize(dim_V);
-    ProjectVecInternal(comm, V, RHS1, RHS1r, dim_V0);
-  }
-  RHSr.resize(dim_V);
-
+void RomOperator::AddMRISample(double omega, const ComplexVector &u)
+{
   // Compute the coefficients for the minimal rational interpolation of the state u used
   // as an error indicator. The complex-valued snapshot matrix U = [{u_i, (iω) u_i}] is
   // stored by its QR decomposition.
+  MPI_Comm comm = space_op.GetComm();
   MFEM_VERIFY(dim_Q + 1 <= Q.size(),
               "Unable to increase basis storage size, increase maximum number of vectors!");
   R.conservativeResizeLike(Eigen::MatrixXd::Zero(dim_Q + 1, dim_Q + 1));
@@ -349,58 +652,350 @@ void RomOperator::UpdatePROM(double omega, const ComplexVector &u)
   z.push_back(omega);
 }
 
-void RomOperator::SolvePROM(double omega, ComplexVector &u)
+std::vector<double> RomOperator::InterpolationWeights(const std::vector<double> &xk,
+                                                     double x, std::size_t n)
+{
+  std::vector<std::size_t> idx(xk.size());
+  std::iota(idx.begin(), idx.end(), 0);
+  n = std::min(idx.size(), n);
+  std::partial_sort(idx.begin(), idx.begin() + n, idx.end(),
+                    [&](std::size_t i, std::size_t j)
+                    { return std::abs(xk[i] - x) < std::abs(xk[j] - x); });
+  std::vector<double> w(xk.size(), 0.0);
+  for (std::size_t i = 0; i < n; i++)
+  {
+    w[idx[i]] = 1.0;
+    for (std::size_t j = 0; j < n; j++)
+    {
+      if (j != i)
+      {
+        w[idx[i]] *= (x - xk[idx[j]]) / (xk[idx[i]] - xk[idx[j]]);
+      }
+    }
+  }
+  return w;
+}
+
+bool RomOperator::GetInterpolationWeights(const std::vector<double> &xk, double x,
+                                          std::vector<double> &w, std::vector<double> &dw)
+{
+  // The interpolant through the nearest sample points may still extrapolate when they all
+  // lie on one side of x, so check the points with nonzero weights directly.
+  w = InterpolationWeights(xk, x);
+  bool lower = false, upper = false;
+  for (std::size_t k = 0; k < xk.size(); k++)
+  {
+    if (w[k] != 0.0)
+    {
+      lower = lower || xk[k] <= x;
+      upper = upper || xk[k] >= x;
+    }
+  }
+  if (!lower || !upper)
+  {
+    return false;
+  }
+  const std::size_t n = std::min(xk.size(), std::size_t(4));
+  dw = InterpolationWeights(xk, x, std::max(n, std::size_t(2)) - 1);
+  for (std::size_t k = 0; k < xk.size(); k++)
+  {
+    dw[k] = w[k] - dw[k];
+  }
+  return true;
+}
+
+bool RomOperator::GetAffineCoefficients(const Eigen::MatrixXd &G, const Eigen::VectorXd &b,
+                                        double c2, double tol, Eigen::VectorXd &theta)
+{
+  // The squared residual of the least-squares fit is ||c - C θ||² = cᵀ c - bᵀ θ.
+  theta = (b.size() > 0) ? Eigen::VectorXd(G.ldlt().solve(b)) : Eigen::VectorXd();
+  return c2 - b.dot(theta) <= tol * tol * c2;
+}
+
+void RomOperator::AddA2Snapshot(double omega)
+{
+  // The assembled A2(ω) is kept as a new term of the affine approximation unless its
+  // boundary coefficients are (numerically) in the span of the existing snapshots.
+  auto c = space_op.GetExtraSystemCoefficients(omega);
+  const std::size_t m = ck.size();
+  std::vector<double> dots(m + 1);
+  for (std::size_t k = 0; k < m; k++)
+  {
+    dots[k] = std::inner_product(ck[k].begin(), ck[k].end(), c.begin(), 0.0);
+  }
+  dots[m] = std::inner_product(c.begin(), c.end(), c.begin(), 0.0);
+  Mpi::GlobalSum(m + 1, dots.data(), space_op.GetComm());
+  const Eigen::VectorXd b = Eigen::Map<const Eigen::VectorXd>(dots.data(), m);
+  Eigen::VectorXd theta;
+  if (GetAffineCoefficients(Gc, b, dots[m], A2_TOL, theta))
+  {
+    return;
+  }
+  Gc.conservativeResize(m + 1, m + 1);
+  Gc.row(m).head(m) = b.transpose();
+  Gc.col(m).head(m) = b;
+  Gc(m, m) = dots[m];
+  ck.push_back(std::move(c));
+  A2k.push_back(std::move(A2));
+  A2rk.emplace_back();
+}
+
+bool RomOperator::InterpolateA2(const Eigen::VectorXcd &cr)
+{
+  // Compute the least-squares coefficients θ = Gc⁻¹ Cᵀ c for the boundary coefficients c
+  // of A2(ω) given the inner products [Cᵀ c, cᵀ c], and assemble Vᴴ A2 V = Σₖ θₖ Vᴴ A2ₖ V
+  // if the fit is exact to within the tolerance. Snapshots which are not yet projected onto
+  // the current basis cannot be used.
+  const std::size_t m = ck.size();
+  if (std::any_of(A2rk.begin(), A2rk.end(),
+                  [this](const Eigen::MatrixXcd &A2r)
+                  { return static_cast<std::size_t>(A2r.rows()) != dim_V; }))
+  {
+    return false;
+  }
+  Eigen::VectorXd theta;
+  if (!GetAffineCoefficients(Gc, cr.head(m).real(), cr(m).real(), A2_TOL, theta))
+  {
+    return false;
+  }
+  Ar.setZero();
+  for (std::size_t k = 0; k < m; k++)
+  {
+    Ar += theta(k) * A2rk[k];
+  }
+  return true;
+}
+
+void RomOperator::AddBoundarySample(double omega)
+{
+  // The boundary modes at the sample point are already computed for the assembly of A2(ω),
+  // so recording the propagation constants and assembling RHS2(ω) do not require any
+  // additional eigenvalue solves.
+  if (has_A2)
+  {
+    AddA2Snapshot(omega);
+  }
+  if ((!has_A2 && !has_RHS2) ||
+      std::find(omega_k.begin(), omega_k.end(), omega) != omega_k.end())
+  {
+    return;
+  }
+  omega_k.push_back(omega);
+  auto &kn = kn_k.emplace_back();
+  for (const auto &[idx, data] : space_op.GetWavePortOp())
+  {
+    kn.push_back(data.kn0);
+  }
+  auto &RHS2e = RHS2k.emplace_back();
+  RHS2rk.emplace_back();
+  if (has_RHS2)
+  {
+    bool nnz = false;
+    RHS2e.resize(RHS1.size());
+    for (std::size_t e = 0; e < RHS1.size(); e++)
+    {
+      SetExcitation(e);
+      nnz = space_op.GetExcitationVector2(omega, RHS2e[e]) || nnz;
+      SetExcitation(-1);
+    }
+    has_RHS2 = nnz;
+    if (has_RHS2)
+    {
+      RHS2rk.back().resize(RHS1.size());
+    }
+    else
+    {
+      RHS2e.clear();
+    }
+  }
+}
+
+bool RomOperator::InterpolatePropagationConstants(
+    double omega, std::vector<std::complex<double>> &kn) const
+{
+  std::vector<double> x(omega_k.size()), w, dw;
+  std::transform(omega_k.begin(), omega_k.end(), x.begin(),
+                 [](double omega) { return omega * omega; });
+  if (!GetInterpolationWeights(x, omega * omega, w, dw))
+  {
+    return false;
+  }
+  kn.assign(kn_k[0].size(), 0.0);
+  std::vector<std::complex<double>> dkn(kn.size(), 0.0);
+  for (std::size_t k = 0; k < kn_k.size(); k++)
+  {
+    for (std::size_t p = 0; (w[k] != 0.0 || dw[k] != 0.0) && p < kn.size(); p++)
+    {
+      kn[p] += w[k] * kn_k[k][p] * kn_k[k][p];
+      dkn[p] += dw[k] * kn_k[k][p] * kn_k[k][p];
+    }
+  }
+  for (std::size_t p = 0; p < kn.size(); p++)
+  {
+    if (std::abs(dkn[p]) > INTERP_TOL * std::abs(kn[p]))
+    {
+      return false;
+    }
+    kn[p] = std::sqrt(kn[p]);
+  }
+  return true;
+}
+
+void RomOperator::SolvePROM(double omega, ComplexVector &u, int e)
+{
+  Eigen::VectorXcd y;
+  SolvePROM(omega, y, e);
+  ProlongatePROM(y, u);
+}
+
+void RomOperator::ProlongatePROM(const Eigen::VectorXcd &y, ComplexVector &u) const
+{
+  MFEM_VERIFY(static_cast<std::size_t>(y.size()) == dim_V,
+              "Invalid PROM solution dimension for expansion into high-dimensional space!");
+  ProlongatePROMSolution(dim_V, V, y, u);
+}
+
+void RomOperator::SolvePROM(double omega, Eigen::VectorXcd &y, int e)
 {
   // Assemble the PROM linear system at the given frequency. The PROM system is defined by
   // the matrix Aᵣ(ω) = Kᵣ + iω Cᵣ - ω² Mᵣ + Vᴴ A2 V(ω) and source vector RHSᵣ(ω) =
   // iω RHS1ᵣ + Vᴴ RHS2(ω). A2(ω) and RHS2(ω) are constructed only if required and are
-  // only nonzero on boundaries, will be empty if not needed.
-  if (has_A2)
+  // only nonzero on boundaries, will be empty if not needed. Their projections are summed
+  // using a single global reduction. The system matrix is only assembled once for
+  // consecutive solves at the same frequency with different excitations.
+  MFEM_VERIFY(e >= 0 && e < GetNumExcitations(),
+              "Invalid excitation index for PROM solve!");
+  // A separate A2(ω) is used from the HDM one, which may still be referenced by the HDM
+  // system matrix. When snapshots of A2 are available, the boundary coefficients are
+  // computed with the wave port propagation constants interpolated from the sample points,
+  // and their local inner products with those of the snapshots are summed in a single
+  // reduction. A2(ω) is only assembled on the mesh if the coefficients are not in the span
+  // of the snapshots. Likewise, Vᴴ RHS2(ω) is interpolated from the projected snapshots.
+  const bool assemble = (omega != omega_Ar);
+  std::vector<Eigen::MatrixXcd *> mats;
+  std::vector<Eigen::VectorXcd *> vecs;
+  std::unique_ptr<ComplexOperator> A2r;
+  auto ProjectA2 = [&]()
   {
-    A2 = space_op.GetExtraSystemMatrix<ComplexOperator>(omega, Operator::DIAG_ZERO);
-    ProjectMatInternal(space_op.GetComm(), V, *A2, Ar, r, 0);
+    A2r = space_op.GetExtraSystemMatrix<ComplexOperator>(omega, Operator::DIAG_ZERO);
+    has_A2 = (A2r != nullptr);
+    if (has_A2)
+    {
+      ProjectMatLocal(V, *A2r, Ar, r, 0);
+      mats.push_back(&Ar);
+    }
+  };
+  Eigen::VectorXcd cr;
+  if (assemble && has_A2)
+  {
+    if (ck.empty())
+    {
+      ProjectA2();
+    }
+    else
+    {
+      // If the propagation constants cannot be interpolated, they are computed by the wave
+      // port eigenvalue solves.
+      std::vector<std::complex<double>> kn;
+      const bool interp_kn = InterpolatePropagationConstants(omega, kn);
+      const auto c = space_op.GetExtraSystemCoefficients(omega, interp_kn ? &kn : nullptr);
+      cr.resize(ck.size() + 1);
+      for (std::size_t k = 0; k < ck.size(); k++)
+      {
+        cr(k) = std::inner_product(ck[k].begin(), ck[k].end(), c.begin(), 0.0);
+      }
+      cr(ck.size()) = std::inner_product(c.begin(), c.end(), c.begin(), 0.0);
+      vecs.push_back(&cr);
+    }
   }
-  else
+  // Only the snapshots of RHS2 which have been projected onto the current basis are used.
+  // RHS2(ω) is assembled instead when the interpolant would extrapolate or its estimated
+  // error is too large.
+  std::vector<std::size_t> kp;
+  std::vector<double> omega_p, w, dw;
+  for (std::size_t k = 0; has_RHS2 && k < RHS2rk.size(); k++)
   {
-    Ar.setZero();
+    if (!RHS2rk[k].empty() && static_cast<std::size_t>(RHS2rk[k][e].size()) == dim_V)
+    {
+      kp.push_back(k);
+      omega_p.push_back(omega_k[k]);
+    }
   }
-  Ar += Kr;
-  if (C)
+  bool interp_RHS2 = false;
+  if (!kp.empty() && GetInterpolationWeights(omega_p, omega, w, dw))
   {
-    Ar += (1i * omega) * Cr;
+    Eigen::VectorXcd dRHSr = Eigen::VectorXcd::Zero(dim_V);
+    RHSr.setZero();
+    for (std::size_t i = 0; i < kp.size(); i++)
+    {
+      if (w[i] != 0.0 || dw[i] != 0.0)
+      {
+        RHSr += w[i] * RHS2rk[kp[i]][e];
+        dRHSr += dw[i] * RHS2rk[kp[i]][e];
+      }
+    }
+    interp_RHS2 = (dRHSr.norm() <= INTERP_TOL * RHSr.norm());
   }
-  Ar += (-omega * omega) * Mr;
-
-  if (has_RHS2)
+  if (!interp_RHS2 && has_RHS2)
   {
-    space_op.GetExcitationVector2(omega, RHS2);
-    ProjectVecInternal(space_op.GetComm(), V, RHS2, RHSr, 0);
+    SetExcitation(e);
+    has_RHS2 = space_op.GetExcitationVector2(omega, RHS2);
+    SetExcitation(-1);
+    if (has_RHS2)
+    {
+      ProjectVecLocal(V, RHS2, RHSr, 0);
+      vecs.push_back(&RHSr);
+    }
   }
-  else
+  if (!mats.empty() || !vecs.empty())
+  {
+    ProjectReduce(space_op.GetComm(), mats, vecs, 0);
+  }
+  if (cr.size() && !InterpolateA2(cr))
+  {
+    ProjectA2();
+    if (!mats.empty())
+    {
+      ProjectReduce(space_op.GetComm(), mats, {}, 0);
+    }
+  }
+  if (assemble)
+  {
+    if (!has_A2)
+    {
+      Ar.setZero();
+    }
+    Ar += Kr;
+    if (C)
+    {
+      Ar += (1i * omega) * Cr;
+    }
+    Ar += (-omega * omega) * Mr;
+    omega_Ar = omega;
+  }
+  if (!has_RHS2)
   {
     RHSr.setZero();
   }
-  if (has_RHS1)
+  if (RHS1r[e].size())
   {
-    RHSr += (1i * omega) * RHS1r;
+    RHSr += (1i * omega) * RHS1r[e];
   }
 
-  // Compute PROM solution at the given frequency and expand into high-dimensional space.
-  // The PROM is solved on every process so the matrix-vector product for vector expansion
-  // does not require communication.
+  // Compute PROM solution at the given frequency. The PROM is solved on every process so
+  // the matrix-vector product for vector expansion does not require communication.
   BlockTimer bt(Timer::SOLVE_PROM);
   if constexpr (false)
   {
     // LDLT solve
-    RHSr = Ar.ldlt().solve(RHSr);
-    RHSr = Ar.selfadjointView<Eigen::Lower>().ldlt().solve(RHSr);
+    y = Ar.ldlt().solve(RHSr);
+    y = Ar.selfadjointView<Eigen::Lower>().ldlt().solve(RHSr);
   }
   else
   {
     // LU solve
-    RHSr = Ar.partialPivLu().solve(RHSr);
+    y = Ar.partialPivLu().solve(RHSr);
   }
-  ProlongatePROMSolution(dim_V, V, RHSr, u);
 }
 
 std::vector<double> RomOperator::FindMaxError(int N) const
@@ -459,32 +1054,37 @@ std::vector<double> RomOperator::FindMaxError(int N) const
   //   }
   // }
 
-  // Fall back to sampling Q on discrete points if no roots exist in [start, end].
+  // Fall back to sampling Q on discrete points if no roots exist in [start, end]. Only the
+  // distinct local minima of |Q| are retained, so that multiple requested points are not
+  // clustered around a single minimum. Fewer than N points may be returned.
   if (std::abs(z_star[0]) == 0.0)
   {
-    const auto delta = (end - start) / 1.0e6;
-    std::vector<double> Q_star(N, mfem::infinity());
-    while (start <= end)
+    constexpr int n_grid = 1000000;
+    const auto delta = (end - start) / n_grid;
+    auto EvalQ = [&](double x)
+    { return std::abs((q.array() / (z_map.array() - x)).sum()); };
+    std::vector<std::pair<double, double>> minima;
+    double Q_prev = mfem::infinity(), Q_curr = EvalQ(start);
+    for (int i = 0; i <= n_grid; i++)
     {
-      const double Q = std::abs((q.array() / (z_map.array() - start)).sum());
-      for (int i = 0; i < N; i++)
+      const double Q_next =
+          (i < n_grid) ? EvalQ(start + (i + 1) * delta) : mfem::infinity();
+      if (Q_curr < Q_prev && Q_curr <= Q_next)
       {
-        if (Q < Q_star[i])
-        {
-          for (int j = i + 1; j < N; j++)
-          {
-            z_star[j] = z_star[j - 1];
-            Q_star[j] = Q_star[j - 1];
-          }
-          z_star[i] = start;
-          Q_star[i] = Q;
-        }
+        minima.emplace_back(Q_curr, start + i * delta);
       }
-      start += delta;
+      Q_prev = Q_curr;
+      Q_curr = Q_next;
     }
-    MFEM_VERIFY(N == 0 || std::abs(z_star[0]) > 0.0,
+    MFEM_VERIFY(N == 0 || !minima.empty(),
                 "Could not locate a maximum error in the range [" << start << ", " << end
                                                                   << "]!");
+    std::sort(minima.begin(), minima.end());
+    z_star.resize(std::min(static_cast<std::size_t>(N), minima.size()));
+    for (std::size_t i = 0; i < z_star.size(); i++)
+    {
+      z_star[i] = minima[i].second;
+    }
   }
   std::vector<double> vals(z_star.size());
   std::transform(z_star.begin(), z_star.end(), vals.begin(),
@@ -492,6 +1092,248 @@ std::vector<double> RomOperator::FindMaxError(int N) const
   return vals;
 }
 
+double RomOperator::ComputeResidualError(double omega)
+{
+  // The residual is r(ω) = iω RHS1 - (K + iω C - ω² M) V y(ω) = W θ(ω) = QW RW θ(ω), so
+  // its norm is given by ||r|| = ||RW θ|| without any HDM operations. Unlike evaluating
+  // θᴴ Wᴴ W θ, this retains full relative accuracy for small residuals.
+  MFEM_VERIFY(HasResidualEstimate() && dim_W == dim_V,
+              "Residual-based error estimate is not available for this PROM!");
+  const std::size_t N = V.size();
+  const auto Rk = RW.topRows(dim_QW);
+  Eigen::VectorXcd y, theta = Eigen::VectorXcd::Zero(RW.cols());
+  double error = 0.0;
+  for (std::size_t e = 0; e < RHS1.size(); e++)
+  {
+    if (!RHS1[e].Size())
+    {
+      continue;
+    }
+    SolvePROM(omega, y, e);
+    theta.setZero();
+    theta.head(dim_V) = -y;
+    if (C)
+    {
+      theta.segment(N, dim_V) = (-1i * omega) * y;
+    }
+    theta.segment(2 * N, dim_V) = (omega * omega) * y;
+    theta(3 * N + e) = 1i * omega;
+    const double res = (Rk * theta).norm();
+    const double rhs = std::abs(omega) * Rk.col(3 * N + e).norm();
+    error = std::max(error, res / rhs);
+  }
+  return error;
+}
+
+std::vector<double> RomOperator::FindMaxResidual(const std::vector<double> &omega, int N,
+                                                 double &max_error)
+{
+  // Evaluate the error estimate at all of the given frequencies. Previously sampled points
+  // are excluded, and are treated as having zero error when locating local maxima.
+  std::vector<double> errors(omega.size());
+  max_error = 0.0;
+  for (std::size_t i = 0; i < omega.size(); i++)
+  {
+    const bool sampled = std::any_of(z.begin(), z.end(),
+                                     [&](double zj) {
+                                       return std::abs(zj - omega[i]) <=
+                                              ORTHOG_TOL * std::abs(omega[i]);
+                                     });
+    errors[i] = sampled ? -1.0 : ComputeResidualError(omega[i]);
+    max_error = std::max(max_error, errors[i]);
+  }
+  std::vector<std::pair<double, double>> maxima;
+  for (std::size_t i = 0; i < omega.size(); i++)
+  {
+    if (errors[i] >= 0.0 && (i == 0 || errors[i] > errors[i - 1]) &&
+        (i == omega.size() - 1 || errors[i] >= errors[i + 1]))
+    {
+      maxima.emplace_back(errors[i], omega[i]);
+    }
+  }
+  std::sort(maxima.begin(), maxima.end(), std::greater<>());
+  std::vector<double> omega_star(std::min(static_cast<std::size_t>(N), maxima.size()));
+  for (std::size_t i = 0; i < omega_star.size(); i++)
+  {
+    omega_star[i] = maxima[i].second;
+  }
+  return omega_star;
+}
+
+void RomOperator::SaveModel(const std::string &prefix) const
+{
+  // Each process writes its local rows of the reduced basis, along with the sample points.
+  // The reduced-order operators are not stored since they are inexpensive to recompute from
+  // the basis, which also allows the model to be reused with modified port terminations.
+  // The snapshots of the frequency-dependent boundary terms are stored by their projections
+  // and the (local) boundary coefficients, since recomputing them would require the
+  // boundary mode solves at the sample points.
+  BlockTimer bt(Timer::IO);
+  MPI_Comm comm = space_op.GetComm();
+  const std::string file = fmt::format("{}{:06d}.bin", prefix, Mpi::Rank(comm));
+  {
+    std::ofstream fo(file, std::ios::binary);
+    const std::int64_t n = r.Size();
+    const std::int64_t header[] = {MODEL_VERSION, Mpi::Size(comm), n,
+                                   static_cast<std::int64_t>(dim_V),
+                                   static_cast<std::int64_t>(z.size())};
+    fo.write(reinterpret_cast<const char *>(header), sizeof(header));
+    fo.write(reinterpret_cast<const char *>(z.data()), z.size() * sizeof(double));
+    for (std::size_t j = 0; j < dim_V; j++)
+    {
+      fo.write(reinterpret_cast<const char *>(V[j].HostRead()), n * sizeof(double));
+    }
+    const std::int64_t bdr_header[] = {
+        has_A2, has_RHS2, static_cast<std::int64_t>(ck.size()),
+        static_cast<std::int64_t>(ck.empty() ? 0 : ck[0].size()),
+        static_cast<std::int64_t>(omega_k.size()),
+        static_cast<std::int64_t>(kn_k.empty() ? 0 : kn_k[0].size()),
+        static_cast<std::int64_t>(RHS1.size()),
+        static_cast<std::int64_t>(excitation_idx.size())};
+    fo.write(reinterpret_cast<const char *>(bdr_header), sizeof(bdr_header));
+    for (const auto idx : excitation_idx)
+    {
+      const std::int64_t idx64 = idx;
+      fo.write(reinterpret_cast<const char *>(&idx64), sizeof(idx64));
+    }
+    for (std::size_t k = 0; k < ck.size(); k++)
+    {
+      MFEM_VERIFY(static_cast<std::size_t>(A2rk[k].rows()) == dim_V,
+                  "PROM model must be saved after the snapshots of A2 are projected!");
+      fo.write(reinterpret_cast<const char *>(ck[k].data()), ck[k].size() * sizeof(double));
+      fo.write(reinterpret_cast<const char *>(A2rk[k].data()),
+               dim_V * dim_V * sizeof(std::complex<double>));
+    }
+    fo.write(reinterpret_cast<const char *>(Gc.data()), Gc.size() * sizeof(double));
+    fo.write(reinterpret_cast<const char *>(omega_k.data()),
+             omega_k.size() * sizeof(double));
+    for (std::size_t k = 0; k < omega_k.size(); k++)
+    {
+      fo.write(reinterpret_cast<const char *>(kn_k[k].data()),
+               kn_k[k].size() * sizeof(std::complex<double>));
+      const std::int64_t n_RHS2 = RHS2rk[k].size();
+      fo.write(reinterpret_cast<const char *>(&n_RHS2), sizeof(n_RHS2));
+      for (const auto &RHS2r : RHS2rk[k])
+      {
+        MFEM_VERIFY(static_cast<std::size_t>(RHS2r.size()) == dim_V,
+                    "PROM model must be saved after the snapshots of RHS2 are projected!");
+        fo.write(reinterpret_cast<const char *>(RHS2r.data()),
+                 dim_V * sizeof(std::complex<double>));
+      }
+    }
+    MFEM_VERIFY(fo.good(), "Failed to write PROM model file " << file << "!");
+  }
+  Mpi::Print(" Wrote PROM model (n = {:d}) to {}*.bin\n", dim_V, prefix);
+}
+
+void RomOperator::LoadModel(const std::string &prefix)
+{
+  // All processes must find a model file for the same discretization and number of
+  // processes.
+  BlockTimer bt(Timer::IO);
+  MPI_Comm comm = space_op.GetComm();
+  const std::string file = fmt::format("{}{:06d}.bin", prefix, Mpi::Rank(comm));
+  std::ifstream fi(file, std::ios::binary);
+  std::int64_t header[5] = {0};
+  if (fi)
+  {
+    fi.read(reinterpret_cast<char *>(header), sizeof(header));
+  }
+  const std::int64_t n = r.Size();
+  int valid = fi.good() && header[0] == MODEL_VERSION && header[1] == Mpi::Size(comm) &&
+              header[2] == n && header[3] > 0 && header[4] > 0;
+  Mpi::GlobalMin(1, &valid, comm);
+  MFEM_VERIFY(valid, "No valid PROM model found at " << prefix
+                                                     << "*.bin, the model must be saved "
+                                                        "for the same mesh and number of "
+                                                        "MPI processes!");
+  dim_V = static_cast<std::size_t>(header[3]);
+  z.resize(header[4]);
+  fi.read(reinterpret_cast<char *>(z.data()), z.size() * sizeof(double));
+  if (V.size() < dim_V)
+  {
+    V.resize(dim_V, Vector());
+  }
+  for (std::size_t j = 0; j < dim_V; j++)
+  {
+    V[j].SetSize(n);
+    V[j].UseDevice(true);
+    fi.read(reinterpret_cast<char *>(V[j].HostWrite()), n * sizeof(double));
+  }
+  std::int64_t bdr_header[8] = {0};
+  fi.read(reinterpret_cast<char *>(bdr_header), sizeof(bdr_header));
+  const std::size_t m = bdr_header[2], n_c = bdr_header[3], n_k = bdr_header[4],
+                    n_kn = bdr_header[5];
+  valid = fi.good() && (n_k == 0 || n_kn == space_op.GetWavePortOp().Size());
+  Mpi::GlobalMin(1, &valid, comm);
+  MFEM_VERIFY(valid, "Failed to read PROM model from "
+                         << prefix << "*.bin, or the model was saved for different wave "
+                                      "port boundaries!");
+
+  // The projected excitation snapshots are stored per excitation, so the model must have
+  // been saved for the same set of excited ports.
+  valid = (bdr_header[6] == static_cast<std::int64_t>(RHS1.size()) &&
+           bdr_header[7] == static_cast<std::int64_t>(excitation_idx.size()));
+  for (std::size_t e = 0; valid && e < excitation_idx.size(); e++)
+  {
+    std::int64_t idx64 = 0;
+    fi.read(reinterpret_cast<char *>(&idx64), sizeof(idx64));
+    valid = fi.good() && idx64 == excitation_idx[e];
+  }
+  Mpi::GlobalMin(1, &valid, comm);
+  MFEM_VERIFY(valid, "PROM model at " << prefix
+                                      << "*.bin was saved for a different set of "
+                                         "excitations!");
+
+  A2k.clear();
+  ck.assign(m, std::vector<double>(n_c));
+  A2rk.assign(m, Eigen::MatrixXcd(dim_V, dim_V));
+  for (std::size_t k = 0; k < m; k++)
+  {
+    fi.read(reinterpret_cast<char *>(ck[k].data()), n_c * sizeof(double));
+    fi.read(reinterpret_cast<char *>(A2rk[k].data()),
+            dim_V * dim_V * sizeof(std::complex<double>));
+  }
+  Gc.resize(m, m);
+  fi.read(reinterpret_cast<char *>(Gc.data()), Gc.size() * sizeof(double));
+  omega_k.resize(n_k);
+  fi.read(reinterpret_cast<char *>(omega_k.data()), n_k * sizeof(double));
+  kn_k.assign(n_k, std::vector<std::complex<double>>(n_kn));
+  RHS2k.assign(n_k, {});
+  RHS2rk.assign(n_k, {});
+  for (std::size_t k = 0; k < n_k; k++)
+  {
+    fi.read(reinterpret_cast<char *>(kn_k[k].data()), n_kn * sizeof(std::complex<double>));
+    std::int64_t n_RHS2 = 0;
+    fi.read(reinterpret_cast<char *>(&n_RHS2), sizeof(n_RHS2));
+    if (n_RHS2 != 0 && n_RHS2 != static_cast<std::int64_t>(RHS1.size()))
+    {
+      valid = false;
+      break;
+    }
+    RHS2rk[k].assign(n_RHS2, Eigen::VectorXcd(dim_V));
+    for (auto &RHS2r : RHS2rk[k])
+    {
+      fi.read(reinterpret_cast<char *>(RHS2r.data()), dim_V * sizeof(std::complex<double>));
+    }
+  }
+  valid = valid && fi.good();
+  Mpi::GlobalMin(1, &valid, comm);
+  MFEM_VERIFY(valid, "Failed to read PROM model from "
+                         << prefix
+                         << "*.bin, or the number of excitations does not match!");
+
+  // The MRI error indicator is not available for a loaded model, so no further samples can
+  // be added.
+  dim_Q = 0;
+  R.resize(0, 0);
+  q.resize(0);
+  dim_QW = dim_W = 0;
+  has_A2 = bdr_header[0];
+  has_RHS2 = bdr_header[1];
+  ProjectOperators(0);
+}
+
 std::vector<std::complex<double>> RomOperator::ComputeEigenvalueEstimates() const
 {
   // XX TODO: Not yet implemented
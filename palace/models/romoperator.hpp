@@ -6,6 +6,7 @@
 
 #include <complex>
 #include <memory>
+#include <string>
 #include <vector>
 #include <Eigen/Dense>
 #include "linalg/ksp.hpp"
@@ -28,17 +29,28 @@ private:
   // Reference to HDM discretization (not owned).
   SpaceOperator &space_op;
 
-  // HDM system matrices and excitation RHS.
+  // HDM system matrices and excitation RHS. For multi-excitation sweeps, the part of the
+  // RHS linear in frequency is stored separately for each excited port.
   std::unique_ptr<ComplexOperator> K, M, C, A2;
-  ComplexVector RHS1, RHS2, r;
-  bool has_A2, has_RHS1, has_RHS2;
+  std::vector<ComplexVector> RHS1;
+  ComplexVector RHS2, r;
+  bool has_A2, has_RHS2;
 
-  // HDM linear system solver and preconditioner.
+  // Indices of the excited ports for multi-excitation sweeps (empty otherwise).
+  std::vector<int> excitation_idx;
+
+  // HDM linear system solver and preconditioner. The preconditioner matrix is kept along
+  // with the frequency at which it was constructed in order to support its reuse.
   std::unique_ptr<ComplexKspSolver> ksp;
+  std::unique_ptr<ComplexOperator> A, P;
+  double omega_A, omega_pc, pc_reuse_tol;
 
-  // PROM matrices and vectors.
+  // PROM matrices and vectors. The PROM system matrix is reused for solves at the same
+  // frequency (omega_Ar is negative when it needs to be reassembled).
   Eigen::MatrixXcd Kr, Mr, Cr, Ar;
-  Eigen::VectorXcd RHS1r, RHSr;
+  std::vector<Eigen::VectorXcd> RHS1r;
+  Eigen::VectorXcd RHSr;
+  double omega_Ar;
 
   // PROM reduced-order basis (real-valued) and active dimension.
   std::vector<Vector> V;
@@ -54,6 +66,75 @@ private:
   Eigen::VectorXcd q;
   std::vector<double> z;
 
+  // Empirical affine approximation of the frequency-dependent boundary terms, A2(ω) ≈
+  // Σₖ θₖ(ω) A2(ωₖ), from HDM snapshots of A2 at the sampled frequencies. A2(ω) depends
+  // linearly on its boundary coefficients c(ω), so θ(ω) is the least-squares fit of c(ω)
+  // in the span of the snapshot coefficients Cᵀ = [cₖ], with Gram matrix Gc = Cᵀ C, and the
+  // reduced-order operator is formed from the projected snapshots without any assembly on
+  // the mesh.
+  std::vector<std::unique_ptr<ComplexOperator>> A2k;
+  std::vector<std::vector<double>> ck;
+  std::vector<Eigen::MatrixXcd> A2rk;
+  Eigen::MatrixXd Gc;
+
+  // Frequency-dependent boundary data at the HDM sample points ωₖ: the propagation
+  // constants of the wave port modes, and the excitation parts RHS2(ωₖ) for each excitation
+  // along with their projections. The PROM interpolates these between the sample points so
+  // that no boundary mode is computed and no excitation is assembled online.
+  std::vector<double> omega_k;
+  std::vector<std::vector<std::complex<double>>> kn_k;
+  std::vector<std::vector<ComplexVector>> RHS2k;
+  std::vector<std::vector<Eigen::VectorXcd>> RHS2rk;
+
+  // Affine decomposition of the PROM residual r(ω) = RHS(ω) - A(ω) V y(ω) for problems
+  // without frequency-dependent boundary terms A2(ω) and RHS2(ω): the HDM operators applied
+  // to the basis vectors, W = [K V, C V, M V, RHS1], are stored by their QR decomposition
+  // W = QW RW with dim_QW orthonormal columns. The block for each operator in the columns
+  // of RW has a fixed size given by the basis storage, and dim_W is the number of basis
+  // vectors included.
+  std::vector<ComplexVector> QW;
+  Eigen::MatrixXcd RW;
+  std::size_t dim_QW, dim_W;
+
+  // Add the solution vector to the reduced-order basis, or to the MRI error indicator,
+  // without updating the PROM operators.
+  void AddBasisVector(const ComplexVector &u);
+  void AddMRISample(double omega, const ComplexVector &u);
+
+  // Restrict the port excitation to the excitation with index e for multi-excitation
+  // sweeps, or restore the configured excitations when e < 0.
+  void SetExcitation(int e);
+
+  // Assemble the HDM system matrix and preconditioner at the given frequency (reused for
+  // consecutive solves at the same frequency), and compute the HDM excitation vector for
+  // the excitation with index e.
+  void AssembleHDM(double omega);
+  void GetHDMExcitation(double omega, int e, ComplexVector &b);
+
+  // Update the PROM operators for the basis vectors added after the first dim_V0.
+  void ProjectOperators(std::size_t dim_V0);
+
+  // Add the current HDM A2(ω) to the snapshots for its affine approximation if it is not in
+  // the span of the existing ones, or form Vᴴ A2 V from the snapshots given the inner
+  // products of the boundary coefficients, returning false if they are not in the span.
+  void AddA2Snapshot(double omega);
+  bool InterpolateA2(const Eigen::VectorXcd &cr);
+
+  // Record the frequency-dependent boundary terms at an HDM sample point, given A2(ω)
+  // assembled at the same frequency: the snapshot of A2, the wave port propagation
+  // constants, and RHS2(ω) for all excitations.
+  void AddBoundarySample(double omega);
+
+  // Interpolate the wave port propagation constants from the HDM sample points. kₙ² is
+  // interpolated in ω², which is exact for ports with a homogeneous cross-section. Returns
+  // false if the interpolant would extrapolate or its estimated error is too large.
+  bool InterpolatePropagationConstants(double omega,
+                                       std::vector<std::complex<double>> &kn) const;
+
+  // Update the QR decomposition of the affine residual decomposition for the basis vectors
+  // added since the last update.
+  void UpdateResidualQR();
+
 public:
   RomOperator(const IoData &iodata, SpaceOperator &space_op, int max_size);
 
@@ -63,23 +144,102 @@ public:
   // Return PROM dimension.
   int GetReducedDimension() const { return dim_V; }
 
+  // Return the number of excitations for which the HDM and PROM are solved (greater than
+  // one only for multi-excitation sweeps).
+  int GetNumExcitations() const { return static_cast<int>(RHS1.size()); }
+
+  // Return the PROM reduced-order basis (only the first GetReducedDimension() vectors are
+  // active).
+  const auto &GetReducedBasis() const { return V; }
+
   // Return set of sampled parameter points for basis construction.
   const auto &GetSamplePoints() const { return z; }
 
-  // Assemble and solve the HDM at the specified frequency.
-  void SolveHDM(double omega, ComplexVector &u);
-
-  // Add the solution vector to the reduced-order basis and update the PROM.
+  // Assemble and solve the HDM at the specified frequency, for the excitation with index e.
+  // The system matrix and preconditioner are reused for consecutive solves at the same
+  // frequency.
+  void SolveHDM(double omega, ComplexVector &u, int e = 0);
+
+  // Assemble and solve the HDM at the specified frequency for all excitations, with u
+  // containing one (sized) solution vector for each excitation. The excitations share the
+  // system matrix and preconditioner but are solved independently.
+  void SolveHDM(double omega, std::vector<ComplexVector> &u);
+
+  // Update the frequency-dependent HDM terms for a sample point at which the HDM is solved
+  // elsewhere (for example, on a group of processes with a redistributed mesh): the
+  // snapshots for the affine approximations of A2(ω) and RHS2(ω).
+  void AddHDMSample(double omega);
+
+  // Add the solution vector(s) to the reduced-order basis and update the PROM. For a batch
+  // of samples, the PROM operators are updated once after all samples have been added. For
+  // multi-excitation sweeps, u contains the solutions for all excitations at each sample
+  // point in turn, and all are added to the basis while their sum is used for the MRI.
   void UpdatePROM(double omega, const ComplexVector &u);
+  void UpdatePROM(const std::vector<double> &omega,
+                  const std::vector<const ComplexVector *> &u);
 
-  // Assemble and solve the PROM at the specified frequency, expanding the solution back
+  // Assemble and solve the PROM at the specified frequency for the excitation with index
+  // e, returning the reduced-order solution coefficients or expanding the solution back
   // into the high-dimensional space.
-  void SolvePROM(double omega, ComplexVector &u);
+  void SolvePROM(double omega, Eigen::VectorXcd &y, int e = 0);
+  void SolvePROM(double omega, ComplexVector &u, int e = 0);
+
+  // Expand the reduced-order solution coefficients into the high-dimensional space.
+  void ProlongatePROM(const Eigen::VectorXcd &y, ComplexVector &u) const;
 
   // Compute the location(s) of the maximum error in the range of the previously sampled
-  // parameter points.
+  // parameter points. When N > 1, the returned locations are distinct local maxima of the
+  // error estimate, and fewer than N may be returned.
   std::vector<double> FindMaxError(int N = 1) const;
 
+  // Return whether the residual-based error estimate is available, which requires that the
+  // system matrix and excitation are affine in the frequency.
+  bool HasResidualEstimate() const { return !has_A2 && !has_RHS2 && dim_W > 0; }
+
+  // Weights of the Lagrange interpolant through the (up to) n sample points closest to x,
+  // for interpolating functions of the frequency from their values at the HDM samples.
+  static std::vector<double> InterpolationWeights(const std::vector<double> &xk, double x,
+                                                  std::size_t n = 4);
+
+  // Compute the interpolation weights w at x along with the weights dw of the difference
+  // to the interpolant through one fewer sample point, which estimates the interpolation
+  // error. Returns false if x is not bracketed by the sample points of the interpolant.
+  static bool GetInterpolationWeights(const std::vector<double> &xk, double x,
+                                      std::vector<double> &w, std::vector<double> &dw);
+
+  // Compute the least-squares coefficients θ = G⁻¹ b of a vector c in the span of the
+  // snapshot vectors with Gram matrix G, given the inner products b of the snapshots with c
+  // and c2 = cᵀ c. Returns false if the relative residual of the fit exceeds the tolerance.
+  static bool GetAffineCoefficients(const Eigen::MatrixXd &G, const Eigen::VectorXd &b,
+                                    double c2, double tol, Eigen::VectorXd &theta);
+
+  // Orthonormalize the column w = Q[dim_Q] against the first dim_Q columns of Q, storing
+  // the coefficients in the column Rk of the triangular factor of the QR decomposition. The
+  // column is kept (incrementing dim_Q) unless it is numerically in the span of the
+  // previous ones, in which case its norm is not stored in Rk.
+  static void OrthonormalizeColumn(GmresSolverBase::OrthogType type, MPI_Comm comm,
+                                   std::vector<ComplexVector> &Q, std::size_t &dim_Q,
+                                   std::complex<double> *Rk);
+
+  // Compute the relative residual norm ||RHS(ω) - A(ω) V y(ω)|| / ||RHS(ω)|| of the PROM
+  // solution at the given frequency, maximized over the excitations. The cost is
+  // independent of the HDM size.
+  double ComputeResidualError(double omega);
+
+  // Compute the locations of up to N distinct local maxima of the residual-based error
+  // estimate over the given frequencies, excluding previously sampled points, along with
+  // the maximum estimated error.
+  std::vector<double> FindMaxResidual(const std::vector<double> &omega, int N,
+                                      double &max_error);
+
+  // Write the reduced-order basis and sample points to rank-local binary files with the
+  // given prefix, or read them back and recompute the PROM operators. The projected
+  // snapshots of the frequency-dependent boundary terms are stored along with the basis.
+  // The model must be loaded for the same mesh, number of MPI processes, and wave port,
+  // farfield, and conductivity boundaries.
+  void SaveModel(const std::string &prefix) const;
+  void LoadModel(const std::string &prefix);
+
   // Compute eigenvalue estimates for the current PROM system.
   std::vector<std::complex<double>> ComputeEigenvalueEstimates() const;
 };
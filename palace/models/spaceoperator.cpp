@@ -3,6 +3,7 @@
 
 #include "spaceoperator.hpp"
 
+#include <algorithm>
 #include <set>
 #include <type_traits>
 #include "fem/bilinearform.hpp"
@@ -442,6 +443,34 @@ SpaceOperator::GetExtraSystemMatrix(double omega, Operator::DiagonalPolicy diag_
   }
 }
 
+std::vector<double>
+SpaceOperator::GetExtraSystemCoefficients(double omega,
+                                          const std::vector<std::complex<double>> *kn)
+{
+  // The coefficients are stored for each attribute rather than for each material, since
+  // the materials shared between attributes can change with the frequency.
+  const int attr_max = mat_op.MaxCeedBdrAttribute(), sdim = mat_op.SpaceDimension();
+  MaterialPropertyCoefficient dfbr(attr_max), dfbi(attr_max), fbr(attr_max), fbi(attr_max);
+  AddExtraSystemBdrCoefficients(omega, dfbr, dfbi, fbr, fbi, kn);
+  std::vector<double> coeffs(4 * attr_max * sdim * sdim, 0.0);
+  auto it = coeffs.begin();
+  for (const auto *f : {&dfbr, &dfbi, &fbr, &fbi})
+  {
+    const auto &attr_mat = f->GetAttributeToMaterial();
+    const auto &mat_coeff = f->GetMaterialProperties();
+    for (int i = 0; i < attr_max; i++, it += sdim * sdim)
+    {
+      if (attr_mat[i] >= 0)
+      {
+        const auto &coeff = mat_coeff(attr_mat[i]);
+        std::copy_n(coeff.GetData(), std::min(coeff.Height() * coeff.Width(), sdim * sdim),
+                    it);
+      }
+    }
+  }
+  return coeffs;
+}
+
 namespace
 {
 
@@ -691,8 +720,14 @@ template <typename OperType>
 std::unique_ptr<OperType> SpaceOperator::GetPreconditionerMatrix(double a0, double a1,
                                                                  double a2, double a3)
 {
-  // XX TODO: Handle complex coeff a0/a1/a2/a3 (like GetSystemMatrix)
+  return GetPreconditionerMatrix<OperType>(a0, std::complex<double>(0.0, a1), a2, a3);
+}
 
+template <typename OperType>
+std::unique_ptr<OperType>
+SpaceOperator::GetPreconditionerMatrix(std::complex<double> a0, std::complex<double> a1,
+                                       std::complex<double> a2, double a3)
+{
   // When partially assembled, the coarse operators can reuse the fine operator quadrature
   // data if the spaces correspond to the same mesh. When appropriate, we build the
   // preconditioner on all levels based on the actual complex-valued system matrix. The
@@ -715,13 +750,33 @@ std::unique_ptr<OperType> SpaceOperator::GetPreconditionerMatrix(double a0, doub
         fi(mat_op.MaxCeedAttribute()), dfbr(mat_op.MaxCeedBdrAttribute()),
         dfbi(mat_op.MaxCeedBdrAttribute()), fbr(mat_op.MaxCeedBdrAttribute()),
         fbi(mat_op.MaxCeedBdrAttribute());
-    AddStiffnessCoefficients(a0, dfr, fr);
-    AddStiffnessBdrCoefficients(a0, fbr);
-    AddDampingCoefficients(a1, fi);
-    AddDampingBdrCoefficients(a1, fbi);
-    AddRealMassCoefficients(pc_mat_shifted ? std::abs(a2) : a2, fr);
-    AddRealMassBdrCoefficients(pc_mat_shifted ? std::abs(a2) : a2, fbr);
-    AddImagMassCoefficients(a2, fi);
+    // The real part of the mass coefficient is shifted, if requested, and the imaginary
+    // parts of the coefficients are only added if nonzero (for real-valued coefficients,
+    // C and Mi contribute only to the imaginary part).
+    const double a2r = pc_mat_shifted ? std::abs(a2.real()) : a2.real();
+    AddStiffnessCoefficients(a0.real(), dfr, fr);
+    AddStiffnessBdrCoefficients(a0.real(), fbr);
+    if (a0.imag() != 0.0)
+    {
+      AddStiffnessCoefficients(a0.imag(), dfi, fi);
+      AddStiffnessBdrCoefficients(a0.imag(), fbi);
+    }
+    if (a1.real() != 0.0)
+    {
+      AddDampingCoefficients(a1.real(), fr);
+      AddDampingBdrCoefficients(a1.real(), fbr);
+    }
+    AddDampingCoefficients(a1.imag(), fi);
+    AddDampingBdrCoefficients(a1.imag(), fbi);
+    AddRealMassCoefficients(a2r, fr);
+    AddRealMassBdrCoefficients(a2r, fbr);
+    AddImagMassCoefficients(a2.real(), fi);
+    if (a2.imag() != 0.0)
+    {
+      AddRealMassCoefficients(a2.imag(), fi);
+      AddRealMassBdrCoefficients(a2.imag(), fbi);
+      AddImagMassCoefficients(-a2.imag(), fr);
+    }
     AddExtraSystemBdrCoefficients(a3, dfbr, dfbi, fbr, fbi);
     int empty[2] = {(dfr.empty() && fr.empty() && dfbr.empty() && fbr.empty()),
                     (dfi.empty() && fi.empty() && dfbi.empty() && fbi.empty())};
@@ -746,12 +801,13 @@ std::unique_ptr<OperType> SpaceOperator::GetPreconditionerMatrix(double a0, doub
     MaterialPropertyCoefficient dfr(mat_op.MaxCeedAttribute()),
         fr(mat_op.MaxCeedAttribute()), dfbr(mat_op.MaxCeedBdrAttribute()),
         fbr(mat_op.MaxCeedBdrAttribute());
-    AddStiffnessCoefficients(a0, dfr, fr);
-    AddStiffnessBdrCoefficients(a0, fbr);
-    AddDampingCoefficients(a1, fr);
-    AddDampingBdrCoefficients(a1, fbr);
-    AddAbsMassCoefficients(pc_mat_shifted ? std::abs(a2) : a2, fr);
-    AddRealMassBdrCoefficients(pc_mat_shifted ? std::abs(a2) : a2, fbr);
+    const double a2r = pc_mat_shifted ? std::abs(a2.real()) : a2.real();
+    AddStiffnessCoefficients(a0.real(), dfr, fr);
+    AddStiffnessBdrCoefficients(a0.real(), fbr);
+    AddDampingCoefficients(std::abs(a1), fr);
+    AddDampingBdrCoefficients(std::abs(a1), fbr);
+    AddAbsMassCoefficients(a2r, fr);
+    AddRealMassBdrCoefficients(a2r, fbr);
     AddExtraSystemBdrCoefficients(a3, dfbr, dfbr, fbr, fbr);
     int empty = (dfr.empty() && fr.empty() && dfbr.empty() && fbr.empty());
     Mpi::GlobalMin(1, &empty, GetComm());
@@ -878,18 +934,41 @@ void SpaceOperator::AddAbsMassCoefficients(double coeff, MaterialPropertyCoeffic
   f.AddCoefficient(mat_op.GetAttributeToMaterial(), mat_op.GetPermittivityAbs(), coeff);
 }
 
-void SpaceOperator::AddExtraSystemBdrCoefficients(double omega,
-                                                  MaterialPropertyCoefficient &dfbr,
-                                                  MaterialPropertyCoefficient &dfbi,
-                                                  MaterialPropertyCoefficient &fbr,
-                                                  MaterialPropertyCoefficient &fbi)
+void SpaceOperator::AddExtraSystemBdrCoefficients(
+    double omega, MaterialPropertyCoefficient &dfbr, MaterialPropertyCoefficient &dfbi,
+    MaterialPropertyCoefficient &fbr, MaterialPropertyCoefficient &fbi,
+    const std::vector<std::complex<double>> *kn)
 {
   // Contribution for second-order farfield boundaries and finite conductivity boundaries.
   farfield_op.AddExtraSystemBdrCoefficients(omega, dfbr, dfbi);
   surf_sigma_op.AddExtraSystemBdrCoefficients(omega, fbr, fbi);
 
   // Contribution for numeric wave ports.
-  wave_port_op.AddExtraSystemBdrCoefficients(omega, fbr, fbi);
+  if (kn)
+  {
+    wave_port_op.AddExtraSystemBdrCoefficients(*kn, fbr, fbi);
+  }
+  else
+  {
+    wave_port_op.AddExtraSystemBdrCoefficients(omega, fbr, fbi);
+  }
+}
+
+std::vector<int> SpaceOperator::GetExcitationIndices() const
+{
+  const auto &lumped_idx = lumped_port_op.GetExcitationIndices();
+  const auto &wave_idx = wave_port_op.GetExcitationIndices();
+  MFEM_VERIFY(lumped_idx.empty() || wave_idx.empty(),
+              "Excitations on both lumped and wave ports are not supported for separate "
+              "solves for each excited port!");
+  return wave_idx.empty() ? lumped_idx : wave_idx;
+}
+
+void SpaceOperator::SetExcitationIndex(int idx)
+{
+  const bool wave = !wave_port_op.GetExcitationIndices().empty();
+  lumped_port_op.SetExcitationIndex(wave ? -1 : idx);
+  wave_port_op.SetExcitationIndex(wave ? idx : -1);
 }
 
 bool SpaceOperator::GetExcitationVector(Vector &RHS)
@@ -1048,5 +1127,13 @@ template std::unique_ptr<Operator>
 SpaceOperator::GetPreconditionerMatrix<Operator>(double, double, double, double);
 template std::unique_ptr<ComplexOperator>
 SpaceOperator::GetPreconditionerMatrix<ComplexOperator>(double, double, double, double);
+template std::unique_ptr<Operator>
+SpaceOperator::GetPreconditionerMatrix<Operator>(std::complex<double>,
+                                                 std::complex<double>,
+                                                 std::complex<double>, double);
+template std::unique_ptr<ComplexOperator>
+SpaceOperator::GetPreconditionerMatrix<ComplexOperator>(std::complex<double>,
+                                                        std::complex<double>,
+                                                        std::complex<double>, double);
 
 }  // namespace palace
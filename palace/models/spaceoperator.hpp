@@ -74,10 +74,10 @@ private:
   void AddRealMassBdrCoefficients(double coeff, MaterialPropertyCoefficient &fb);
   void AddImagMassCoefficients(double coeff, MaterialPropertyCoefficient &f);
   void AddAbsMassCoefficients(double coeff, MaterialPropertyCoefficient &f);
-  void AddExtraSystemBdrCoefficients(double omega, MaterialPropertyCoefficient &dfbr,
-                                     MaterialPropertyCoefficient &dfbi,
-                                     MaterialPropertyCoefficient &fbr,
-                                     MaterialPropertyCoefficient &fbi);
+  void AddExtraSystemBdrCoefficients(
+      double omega, MaterialPropertyCoefficient &dfbr, MaterialPropertyCoefficient &dfbi,
+      MaterialPropertyCoefficient &fbr, MaterialPropertyCoefficient &fbi,
+      const std::vector<std::complex<double>> *kn = nullptr);
 
   // Helper functions for excitation vector assembly.
   bool AddExcitationVector1Internal(Vector &RHS);
@@ -149,6 +149,14 @@ public:
   std::unique_ptr<OperType> GetExtraSystemMatrix(double omega,
                                                  Operator::DiagonalPolicy diag_policy);
 
+  // Return the values of the boundary coefficients defining the extra matrix A2(ω), which
+  // depends linearly on them, for all local boundary attributes in a fixed layout. If the
+  // propagation constants of the wave port modes are given, the boundary modes are not
+  // computed.
+  std::vector<double>
+  GetExtraSystemCoefficients(double omega,
+                             const std::vector<std::complex<double>> *kn = nullptr);
+
   // Construct the complete frequency or time domain system matrix using the provided
   // stiffness, damping, mass, and extra matrices:
   //                     A = a0 K + a1 C + a2 (Mr + i Mi) + A2 .
@@ -177,6 +185,15 @@ public:
   std::unique_ptr<OperType> GetPreconditionerMatrix(double a0, double a1, double a2,
                                                     double a3);
 
+  // Construct the preconditioner matrix for complex-valued coefficients, with the same
+  // convention as GetSystemMatrix():
+  //                 B = a0 K + a1 C -/+ a2 (Mr + i Mi) + A2r(a3) + A2i(a3) .
+  // If it is real-valued, it is constructed using Re{a0}, |a1|, and Re{a2}.
+  template <typename OperType>
+  std::unique_ptr<OperType>
+  GetPreconditionerMatrix(std::complex<double> a0, std::complex<double> a1,
+                          std::complex<double> a2, double a3);
+
   // Construct and return the discrete curl or gradient matrices.
   const Operator &GetGradMatrix() const
   {
@@ -187,6 +204,12 @@ public:
     return GetRTSpace().GetDiscreteInterpolator(GetNDSpace());
   }
 
+  // Return the indices of the lumped or wave ports marked for excitation, and restrict the
+  // excitation to the single port with the given index (or restore the excitations from
+  // the configuration file when idx < 0). Only ports of a single type may be excited.
+  std::vector<int> GetExcitationIndices() const;
+  void SetExcitationIndex(int idx);
+
   // Assemble the right-hand side source term vector for an incident field or current source
   // applied on specified excited boundaries. The return value indicates whether or not the
   // excitation is nonzero (and thus is true most of the time).
@@ -3,12 +3,21 @@
 
 #include "waveportoperator.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <string>
 #include <tuple>
+#include <type_traits>
+#include <Eigen/Dense>
 #include "fem/bilinearform.hpp"
 #include "fem/coefficient.hpp"
 #include "fem/integrator.hpp"
 #include "linalg/arpack.hpp"
 #include "linalg/iterative.hpp"
+#include "linalg/krylovschur.hpp"
 #include "linalg/mumps.hpp"
 #include "linalg/rap.hpp"
 #include "linalg/slepc.hpp"
@@ -514,6 +523,105 @@ public:
   }
 };
 
+// Number of values describing each element of a wave port boundary when checking for
+// congruent ports: the element centroid, the number of Dirichlet BC dofs on the element,
+// and the real and imaginary permittivity and inverse permeability tensors in the
+// neighboring domain element.
+constexpr int ELEM_DATA_SIZE = 3 + 1 + 3 * 9;
+
+// Maximum number of cached boundary mode solutions used for interpolation. When the cache
+// is full, the solution at the frequency farthest from the new one is evicted.
+constexpr std::size_t MODE_CACHE_SIZE = 8;
+
+// Helper for evaluating a boundary mode grid function on the serial mesh of a congruent
+// port at the image of a point under the rigid motion x ↦ c_src + R (x - c).
+class MappedPortEvaluator
+{
+private:
+  const mfem::Mesh &src_mesh;
+  const mfem::DenseMatrix &R;
+  const mfem::Vector &c, &c_src;
+  const std::vector<int> &src_elems;
+  mfem::IsoparametricTransformation T_src;
+  mfem::IntegrationPoint ip_src;
+
+public:
+  MappedPortEvaluator(const mfem::Mesh &src_mesh, const mfem::DenseMatrix &R,
+                      const mfem::Vector &c, const mfem::Vector &c_src,
+                      const std::vector<int> &src_elems)
+    : src_mesh(src_mesh), R(R), c(c), c_src(c_src), src_elems(src_elems)
+  {
+  }
+
+  const mfem::DenseMatrix &GetRotation() const { return R; }
+
+  mfem::ElementTransformation &Map(mfem::ElementTransformation &T,
+                                   const mfem::IntegrationPoint &ip)
+  {
+    double x_data[3], y_data[3];
+    mfem::Vector x(x_data, c.Size()), y(y_data, c.Size());
+    T.Transform(ip, x);
+    x -= c;
+    R.Mult(x, y);
+    y += c_src;
+    src_mesh.GetElementTransformation(src_elems[T.ElementNo], &T_src);
+    mfem::InverseElementTransformation inv_T(&T_src);
+    inv_T.SetPhysicalRelTol(1.0e-12);
+    const int res = inv_T.Transform(y, ip_src);
+    MFEM_VERIFY(res != mfem::InverseElementTransformation::Unknown,
+                "Failed to locate point on congruent wave port boundary!");
+    T_src.SetIntPoint(&ip_src);
+    return T_src;
+  }
+};
+
+// Return as a vector coefficient the tangential boundary mode electric field of a congruent
+// port: Eₜ(x) = Rᵀ Eₜ,src(c_src + R (x - c)).
+class MappedPortVectorCoefficient : public mfem::VectorCoefficient
+{
+private:
+  const mfem::GridFunction &U;
+  MappedPortEvaluator map;
+
+public:
+  MappedPortVectorCoefficient(const mfem::GridFunction &U, const MappedPortEvaluator &map)
+    : mfem::VectorCoefficient(U.VectorDim()), U(U), map(map)
+  {
+  }
+
+  void Eval(mfem::Vector &V, mfem::ElementTransformation &T,
+            const mfem::IntegrationPoint &ip) override
+  {
+    auto &T_src = map.Map(T, ip);
+    double U_data[3];
+    mfem::Vector Us(U_data, vdim);
+    U.GetVectorValue(T_src, T_src.GetIntPoint(), Us);
+    V.SetSize(vdim);
+    map.GetRotation().MultTranspose(Us, V);
+  }
+};
+
+// Return as a coefficient the normal boundary mode electric field of a congruent port:
+// Eₙ(x) = Eₙ,src(c_src + R (x - c)).
+class MappedPortCoefficient : public mfem::Coefficient
+{
+private:
+  const mfem::GridFunction &U;
+  MappedPortEvaluator map;
+
+public:
+  MappedPortCoefficient(const mfem::GridFunction &U, const MappedPortEvaluator &map)
+    : mfem::Coefficient(), U(U), map(map)
+  {
+  }
+
+  double Eval(mfem::ElementTransformation &T, const mfem::IntegrationPoint &ip) override
+  {
+    auto &T_src = map.Map(T, ip);
+    return U.GetValue(T_src, T_src.GetIntPoint());
+  }
+};
+
 }  // namespace
 
 WavePortData::WavePortData(const config::WavePortData &data,
@@ -528,7 +636,17 @@ WavePortData::WavePortData(const config::WavePortData &data,
   excitation = data.excitation;
   active = data.active;
   kn0 = 0.0;
-  omega0 = 0.0;
+  omega0 = omega1 = 0.0;
+  lambda = 0.0;
+  interp = false;
+  has_prev = false;
+  mode_tracking = data.mode_tracking;
+  interp_tol = data.interp_tol;
+  mode_src = nullptr;
+  serial_valid = mode_dependents = false;
+  serial_comm = MPI_COMM_NULL;
+  redist = false;
+  solve_round = 0;
 
   // Construct the SubMesh.
   MFEM_VERIFY(!data.attributes.empty(), "Wave port boundary found with no attributes!");
@@ -638,308 +756,1214 @@ WavePortData::WavePortData(const config::WavePortData &data,
   Mpi::GlobalMin(1, &port_root, comm);
   MFEM_VERIFY(port_root < Mpi::Size(comm), "No root process found for port!");
 
+  ConfigureSolver(data, solver);
+
+  // Configure port mode sign convention: 1ᵀ Re{-n x H} >= 0 on the "upper-right quadrant"
+  // of the wave port boundary, in order to deal with symmetry effectively.
+  {
+    Vector bbmin, bbmax;
+    mesh::GetAxisAlignedBoundingBox(*port_mesh, bbmin, bbmax);
+    const int dim = port_mesh->SpaceDimension();
+
+    double la = 0.0, lb = 0.0;
+    int da = -1, db = -1;
+    for (int d = 0; d < dim; d++)
+    {
+      double diff = bbmax(d) - bbmin(d);
+      if (diff > la)
+      {
+        lb = la;
+        la = diff;
+        db = da;
+        da = d;
+      }
+      else if (diff > lb)
+      {
+        lb = diff;
+        db = d;
+      }
+    }
+    MFEM_VERIFY(da >= 0 && db >= 0 && da != db,
+                "Unexpected wave port geometry for normalization!");
+    double ca = 0.5 * (bbmax[da] + bbmin[da]), cb = 0.5 * (bbmax[db] + bbmin[db]);
+
+    auto TDirection = [da, db, ca, cb, dim](const Vector &x, Vector &f)
+    {
+      MFEM_ASSERT(x.Size() == dim,
+                  "Invalid dimension mismatch for wave port mode normalization!");
+      f.SetSize(dim);
+      if (x[da] >= ca && x[db] >= cb)
+      {
+        f = 1.0;
+      }
+      else
+      {
+        f = 0.0;
+      }
+    };
+    mfem::VectorFunctionCoefficient tfunc(dim, TDirection);
+    port_S0t = std::make_unique<GridFunction>(*port_nd_fespace);
+    port_S0t->Real().ProjectCoefficient(tfunc);
+  }
+
+  // Compute the geometric properties of the port cross-section used to detect congruent
+  // ports.
+  ComputePortFrame();
+}
+
+WavePortData::~WavePortData()
+{
+  // Free the solvers before the communicator on which they are based.
+  ksp.reset();
+  eigen.reset();
+  if (port_comm != MPI_COMM_NULL)
+  {
+    MPI_Comm_free(&port_comm);
+  }
+  if (serial_comm != MPI_COMM_NULL)
+  {
+    MPI_Comm_free(&serial_comm);
+  }
+}
+
+void WavePortData::ConfigureSolver(const config::WavePortData &data,
+                                   const config::SolverData &solver)
+{
   // Configure the eigenvalue problem solver. As for the full 3D case, the system matrices
   // are in general complex and symmetric. We supply the operators to the solver in
-  // shift-inverted form and handle the back-transformation externally.
+  // shift-inverted form and handle the back-transformation externally. Only processes in
+  // the port communicator participate.
+  eigen.reset();
+  ksp.reset();
+  if (port_comm == MPI_COMM_NULL)
+  {
+    return;
+  }
+
+  // Define the linear solver to be used for solving systems associated with the
+  // generalized eigenvalue problem.
+  auto gmres = std::make_unique<GmresSolver<ComplexOperator>>(port_comm, data.verbose);
+  gmres->SetInitialGuess(false);
+  gmres->SetRelTol(data.ksp_tol);
+  gmres->SetMaxIter(data.ksp_max_its);
+  gmres->SetRestartDim(data.ksp_max_its);
+  // gmres->SetPrecSide(GmresSolverBase::PrecSide::RIGHT);
+
+  // The boundary mode problems are small, so mixed precision sparse direct solver types
+  // fall back to the corresponding double precision solver.
+  config::LinearSolverData::Type pc_type = solver.linear.type;
+  if (pc_type == config::LinearSolverData::Type::SUPERLU ||
+      pc_type == config::LinearSolverData::Type::SUPERLU_MP)
+  {
+#if !defined(MFEM_USE_SUPERLU)
+    MFEM_ABORT("Solver was not built with SuperLU_DIST support, please choose a "
+               "different solver!");
+#endif
+    pc_type = config::LinearSolverData::Type::SUPERLU;
+  }
+  else if (pc_type == config::LinearSolverData::Type::STRUMPACK ||
+           pc_type == config::LinearSolverData::Type::STRUMPACK_MP)
+  {
+#if !defined(MFEM_USE_STRUMPACK)
+    MFEM_ABORT("Solver was not built with STRUMPACK support, please choose a "
+               "different solver!");
+#endif
+    pc_type = config::LinearSolverData::Type::STRUMPACK;
+  }
+  else if (pc_type == config::LinearSolverData::Type::MUMPS ||
+           pc_type == config::LinearSolverData::Type::MUMPS_MP)
+  {
+#if !defined(MFEM_USE_MUMPS)
+    MFEM_ABORT("Solver was not built with MUMPS support, please choose a "
+               "different solver!");
+#endif
+    pc_type = config::LinearSolverData::Type::MUMPS;
+  }
+  else  // Default choice
+  {
+#if defined(MFEM_USE_SUPERLU)
+    pc_type = config::LinearSolverData::Type::SUPERLU;
+#elif defined(MFEM_USE_STRUMPACK)
+    pc_type = config::LinearSolverData::Type::STRUMPACK;
+#elif defined(MFEM_USE_MUMPS)
+    pc_type = config::LinearSolverData::Type::MUMPS;
+#else
+#error "Wave port solver requires building with SuperLU_DIST, STRUMPACK, or MUMPS!"
+#endif
+  }
+  auto pc = std::make_unique<MfemWrapperSolver<ComplexOperator>>(
+      [&]() -> std::unique_ptr<mfem::Solver>
+      {
+        if (pc_type == config::LinearSolverData::Type::SUPERLU)
+        {
+#if defined(MFEM_USE_SUPERLU)
+          auto slu = std::make_unique<SuperLUSolver>(
+              port_comm, config::LinearSolverData::SymFactType::DEFAULT, false,
+              data.verbose - 1);
+          // slu->GetSolver().SetColumnPermutation(mfem::superlu::MMD_AT_PLUS_A);
+          return slu;
+#endif
+        }
+        else if (pc_type == config::LinearSolverData::Type::STRUMPACK)
+        {
+#if defined(MFEM_USE_STRUMPACK)
+          auto strumpack = std::make_unique<StrumpackSolver>(
+              port_comm, config::LinearSolverData::SymFactType::DEFAULT,
+              config::LinearSolverData::CompressionType::NONE, 0.0, 0, 0,
+              data.verbose - 1);
+          // strumpack->SetReorderingStrategy(strumpack::ReorderingStrategy::AMD);
+          return strumpack;
+#endif
+        }
+        else if (pc_type == config::LinearSolverData::Type::MUMPS)
+        {
+#if defined(MFEM_USE_MUMPS)
+          auto mumps = std::make_unique<MumpsSolver>(
+              port_comm, mfem::MUMPSSolver::UNSYMMETRIC,
+              config::LinearSolverData::SymFactType::DEFAULT, 0.0, data.verbose - 1);
+          // mumps->SetReorderingStrategy(mfem::MUMPSSolver::AMD);
+          return mumps;
+#endif
+        }
+        return {};
+      }());
+  pc->SetSaveAssembled(false);
+  ksp = std::make_unique<ComplexKspSolver>(std::move(gmres), std::move(pc));
+
+  // Define the eigenvalue solver.
+  constexpr int print = 0;
+  config::WavePortData::EigenSolverType type = data.eigen_type;
+  if (type == config::WavePortData::EigenSolverType::SLEPC)
+  {
+#if !defined(PALACE_WITH_SLEPC)
+    MFEM_ABORT("Solver was not built with SLEPc support, please choose a "
+               "different solver!");
+#endif
+  }
+  else if (type == config::WavePortData::EigenSolverType::ARPACK)
+  {
+#if !defined(PALACE_WITH_ARPACK)
+    MFEM_ABORT("Solver was not built with ARPACK support, please choose a "
+               "different solver!");
+#endif
+  }
+  else if (type != config::WavePortData::EigenSolverType::BLOCK_KRYLOV_SCHUR)  // Default
+  {
+#if defined(PALACE_WITH_SLEPC)
+    type = config::WavePortData::EigenSolverType::SLEPC;
+#elif defined(PALACE_WITH_ARPACK)
+    type = config::WavePortData::EigenSolverType::ARPACK;
+#else
+    type = config::WavePortData::EigenSolverType::BLOCK_KRYLOV_SCHUR;
+#endif
+  }
+  if (type == config::WavePortData::EigenSolverType::BLOCK_KRYLOV_SCHUR)
+  {
+    auto ks = std::make_unique<BlockKrylovSchurSolver>(port_comm, print);
+    ks->SetBlockSize(1);
+    eigen = std::move(ks);
+  }
+  else if (type == config::WavePortData::EigenSolverType::ARPACK)
+  {
+#if defined(PALACE_WITH_ARPACK)
+    eigen = std::make_unique<arpack::ArpackEPSSolver>(port_comm, print);
+#endif
+  }
+  else  // config::WavePortData::EigenSolverType::SLEPC
+  {
+#if defined(PALACE_WITH_SLEPC)
+    auto slepc = std::make_unique<slepc::SlepcEPSSolver>(port_comm, print);
+    slepc->SetType(slepc::SlepcEigenvalueSolver::Type::KRYLOVSCHUR);
+    slepc->SetProblemType(slepc::SlepcEigenvalueSolver::ProblemType::GEN_NON_HERMITIAN);
+    eigen = std::move(slepc);
+#endif
+  }
+  eigen->SetNumModes(mode_idx, std::max(2 * mode_idx + 1, 5));
+  eigen->SetTol(data.eig_tol);
+  eigen->SetLinearSolver(*ksp);
+
+  // We want to ignore evanescent modes (kₙ with large imaginary component). The
+  // eigenvalue 1 / (-kₙ² - σ) of the shifted problem will be a large-magnitude negative
+  // real number for an eigenvalue kₙ² with real part close to but not below the cutoff σ.
+  eigen->SetWhichEigenpairs(EigenvalueSolver::WhichType::SMALLEST_REAL);
+}
+
+void WavePortData::Redistribute(MPI_Comm group_comm, int round,
+                                const config::WavePortData &data,
+                                const config::SolverData &solver)
+{
+  // The true dofs [eₜ, eₙ] of the eigenvalue problem are owned in contiguous blocks in the
+  // order of the parent communicator ranks, both by the processes owning the port elements
+  // and, after redistribution, by the processes of the group (in equal sizes).
+  MPI_Comm comm = port_mesh->GetComm();
+  const int size = Mpi::Size(comm), rank = Mpi::Rank(comm);
+  std::vector<HYPRE_BigInt> src_offsets(size + 1, 0), dst_offsets(size + 1, 0);
+  {
+    const int n_loc = port_nd_fespace->GetTrueVSize() + port_h1_fespace->GetTrueVSize();
+    const int group_rank = (group_comm != MPI_COMM_NULL) ? Mpi::Rank(group_comm) : -1;
+    std::vector<int> n(size), group_ranks(size);
+    MPI_Allgather(&n_loc, 1, MPI_INT, n.data(), 1, MPI_INT, comm);
+    MPI_Allgather(&group_rank, 1, MPI_INT, group_ranks.data(), 1, MPI_INT, comm);
+    const int group_size = static_cast<int>(std::count_if(
+        group_ranks.begin(), group_ranks.end(), [](int g) { return g >= 0; }));
+    MFEM_VERIFY(group_size > 0, "No processes found for wave port redistribution!");
+    for (int p = 0; p < size; p++)
+    {
+      src_offsets[p + 1] = src_offsets[p] + n[p];
+    }
+    redist_glob_size = src_offsets[size];
+    for (int p = 0; p < size; p++)
+    {
+      dst_offsets[p + 1] =
+          (group_ranks[p] >= 0) ? redist_glob_size * (group_ranks[p] + 1) / group_size
+                                : dst_offsets[p];
+    }
+  }
+  auto Overlap = [](HYPRE_BigInt a0, HYPRE_BigInt a1, HYPRE_BigInt b0, HYPRE_BigInt b1)
+  {
+    return static_cast<int>(
+        std::max(std::min(a1, b1) - std::max(a0, b0), static_cast<HYPRE_BigInt>(0)));
+  };
+  redist_send_counts.resize(size);
+  redist_recv_counts.resize(size);
+  for (int p = 0; p < size; p++)
+  {
+    redist_send_counts[p] = Overlap(src_offsets[rank], src_offsets[rank + 1],
+                                    dst_offsets[p], dst_offsets[p + 1]);
+    redist_recv_counts[p] = Overlap(dst_offsets[rank], dst_offsets[rank + 1],
+                                    src_offsets[p], src_offsets[p + 1]);
+  }
+  redist_first_row = dst_offsets[rank];
+  redist = true;
+  solve_round = round;
+
+  // Replace the port communicator with the group communicator, and move the operators and
+  // initial space for the eigenvalue problem to the group.
+  eigen.reset();
+  ksp.reset();
   if (port_comm != MPI_COMM_NULL)
   {
-    // Define the linear solver to be used for solving systems associated with the
-    // generalized eigenvalue problem.
-    auto gmres = std::make_unique<GmresSolver<ComplexOperator>>(port_comm, data.verbose);
-    gmres->SetInitialGuess(false);
-    gmres->SetRelTol(data.ksp_tol);
-    gmres->SetMaxIter(data.ksp_max_its);
-    gmres->SetRestartDim(data.ksp_max_its);
-    // gmres->SetPrecSide(GmresSolverBase::PrecSide::RIGHT);
-
-    config::LinearSolverData::Type pc_type = solver.linear.type;
-    if (pc_type == config::LinearSolverData::Type::SUPERLU)
+    MPI_Comm_free(&port_comm);
+  }
+  if (group_comm != MPI_COMM_NULL)
+  {
+    MPI_Comm_dup(group_comm, &port_comm);
+  }
+  port_root = (port_comm != MPI_COMM_NULL) ? rank : size;
+  Mpi::GlobalMin(1, &port_root, comm);
+  {
+    const auto *Br = dynamic_cast<const mfem::HypreParMatrix *>(opB->Real());
+    const auto *Bi = dynamic_cast<const mfem::HypreParMatrix *>(opB->Imag());
+    MFEM_VERIFY(Br, "Wave port boundary mode eigenvalue problem redistribution requires "
+                    "assembled matrices!");
+    auto new_Br = RedistributeMatrix(*Br);
+    auto new_Bi = Bi ? RedistributeMatrix(*Bi) : nullptr;
+    opB = std::make_unique<ComplexWrapperOperator>(std::move(new_Br), std::move(new_Bi));
+    ComplexVector v;
+    RedistributeVector(v0, v, true);
+    v0.SetSize(v.Size());
+    v0 = v;
+  }
+  ConfigureSolver(data, solver);
+}
+
+void WavePortData::RedistributeVector(const ComplexVector &x, ComplexVector &y,
+                                      bool forward) const
+{
+  MPI_Comm comm = port_mesh->GetComm();
+  const int size = Mpi::Size(comm);
+  const auto &send_counts = forward ? redist_send_counts : redist_recv_counts;
+  const auto &recv_counts = forward ? redist_recv_counts : redist_send_counts;
+  std::vector<int> send_displs(size + 1, 0), recv_displs(size + 1, 0);
+  std::partial_sum(send_counts.begin(), send_counts.end(), send_displs.begin() + 1);
+  std::partial_sum(recv_counts.begin(), recv_counts.end(), recv_displs.begin() + 1);
+  MFEM_ASSERT(x.Size() == send_displs.back(),
+              "Size mismatch for wave port boundary mode redistribution!");
+  y.SetSize(recv_displs.back());
+  y.UseDevice(true);
+  MPI_Alltoallv(x.Real().HostRead(), send_counts.data(), send_displs.data(), MPI_DOUBLE,
+                y.Real().HostWrite(), recv_counts.data(), recv_displs.data(), MPI_DOUBLE,
+                comm);
+  MPI_Alltoallv(x.Imag().HostRead(), send_counts.data(), send_displs.data(), MPI_DOUBLE,
+                y.Imag().HostWrite(), recv_counts.data(), recv_displs.data(), MPI_DOUBLE,
+                comm);
+}
+
+std::unique_ptr<mfem::HypreParMatrix>
+WavePortData::RedistributeMatrix(const mfem::HypreParMatrix &A) const
+{
+  // Send the local rows of the matrix with global column indices: first the number of
+  // nonzeros of each row, then the column indices and values. The global numbering of the
+  // rows and columns is unchanged.
+  MPI_Comm comm = port_mesh->GetComm();
+  const int size = Mpi::Size(comm);
+  auto *parcsr = (hypre_ParCSRMatrix *)const_cast<mfem::HypreParMatrix &>(A);
+  hypre_CSRMatrix *csr = hypre_MergeDiagAndOffd(parcsr);
+  hypre_CSRMatrixMigrate(csr, HYPRE_MEMORY_HOST);
+  const HYPRE_Int n_loc = hypre_CSRMatrixNumRows(csr);
+  const HYPRE_Int *I = hypre_CSRMatrixI(csr);
+  const HYPRE_BigInt *J = hypre_CSRMatrixBigJ(csr);
+  const double *data = hypre_CSRMatrixData(csr);
+  std::vector<int> row_nnz(n_loc), nnz_send_counts(size, 0);
+  for (HYPRE_Int i = 0; i < n_loc; i++)
+  {
+    row_nnz[i] = static_cast<int>(I[i + 1] - I[i]);
+  }
+  for (int p = 0, i = 0; p < size; i += redist_send_counts[p++])
+  {
+    nnz_send_counts[p] = static_cast<int>(I[i + redist_send_counts[p]] - I[i]);
+  }
+  auto Exchange = [&](const auto *send, const std::vector<int> &send_counts,
+                      const std::vector<int> &recv_counts, auto &recv)
+  {
+    using T = std::remove_const_t<std::remove_pointer_t<decltype(send)>>;
+    std::vector<int> send_displs(size + 1, 0), recv_displs(size + 1, 0);
+    std::partial_sum(send_counts.begin(), send_counts.end(), send_displs.begin() + 1);
+    std::partial_sum(recv_counts.begin(), recv_counts.end(), recv_displs.begin() + 1);
+    recv.resize(recv_displs.back());
+    MPI_Alltoallv(send, send_counts.data(), send_displs.data(), mpi::DataType<T>(),
+                  recv.data(), recv_counts.data(), recv_displs.data(), mpi::DataType<T>(),
+                  comm);
+  };
+  std::vector<int> new_nnz, nnz_recv_counts(size);
+  Exchange(row_nnz.data(), redist_send_counts, redist_recv_counts, new_nnz);
+  MPI_Alltoall(nnz_send_counts.data(), 1, MPI_INT, nnz_recv_counts.data(), 1, MPI_INT,
+               comm);
+  std::vector<HYPRE_BigInt> new_J;
+  std::vector<double> new_data;
+  Exchange(J, nnz_send_counts, nnz_recv_counts, new_J);
+  Exchange(data, nnz_send_counts, nnz_recv_counts, new_data);
+  hypre_CSRMatrixDestroy(csr);
+  if (port_comm == MPI_COMM_NULL)
+  {
+    return nullptr;
+  }
+
+  // Construct the matrix on the group communicator.
+  const int n_new = static_cast<int>(new_nnz.size());
+  std::vector<int> new_I(n_new + 1, 0);
+  std::partial_sum(new_nnz.begin(), new_nnz.end(), new_I.begin() + 1);
+  HYPRE_BigInt rows[2] = {redist_first_row, redist_first_row + n_new};
+  return std::make_unique<mfem::HypreParMatrix>(port_comm, n_new, redist_glob_size,
+                                                redist_glob_size, new_I.data(),
+                                                new_J.data(), new_data.data(), rows, rows);
+}
+
+void WavePortData::Initialize(double omega)
+{
+  AssembleMode(omega);
+  SolveMode();
+  FinalizeMode();
+}
+
+void WavePortData::AssembleMode(double omega)
+{
+  omega1 = omega;
+  if (omega1 == omega0 || mode_src)
+  {
+    // Modes of congruent ports are mapped from the source port in FinalizeMode.
+    return;
+  }
+
+  // Interpolate the boundary mode from the cached solutions at nearby frequencies if
+  // possible, otherwise construct the matrices for the generalized eigenvalue problem for
+  // the desired wave port mode. The B matrix is operating frequency-independent and has
+  // already been constructed.
+  interp = InterpolateMode(omega);
+  if (interp)
+  {
+    return;
+  }
+  const double sigma = -omega * omega * mu_eps_min;
+  auto [Attr, Atti] = GetAtt(mat_op, *port_nd_fespace, port_normal, omega, sigma);
+  auto [Ar, Ai] = GetSystemMatrixA(Attr.get(), Atti.get(), Atnr.get(), Atni.get(),
+                                   Antr.get(), Anti.get(), Annr.get(), Anni.get(),
+                                   port_dbc_tdof_list);
+  if (redist)
+  {
+    Ar = RedistributeMatrix(*Ar);
+    Ai = Ai ? RedistributeMatrix(*Ai) : nullptr;
+    if (!Ar)
+    {
+      // This process is not part of the group solving the eigenvalue problem.
+      return;
+    }
+  }
+  opA = std::make_unique<ComplexWrapperOperator>(std::move(Ar), std::move(Ai));
+}
+
+void WavePortData::FinalizeMode()
+{
+  if (omega1 == omega0)
+  {
+    return;
+  }
+  if (mode_src)
+  {
+    // Map the mode from the congruent source port, which has the same propagation
+    // constant, and normalize it.
+    MFEM_VERIFY(mode_src->omega0 == omega1,
+                "Wave port boundary mode source must be computed before dependent ports!");
+    kn0 = mode_src->kn0;
+    omega0 = omega1;
+    MapMode();
+    NormalizeMode();
+    return;
+  }
+  if (!interp)
+  {
+    // Extract the eigenmode solution. The extracted eigenvalue is λ = 1 / (-kₙ² - σ).
+    const double sigma = -omega1 * omega1 * mu_eps_min;
+    Mpi::Broadcast(1, &lambda, port_root, port_mesh->GetComm());
+    kn0 = std::sqrt(-sigma - 1.0 / lambda);
+    has_prev = true;
+    if (redist)
+    {
+      RedistributeVector(e_prev, e0, false);
+    }
+    else
+    {
+      e0 = e_prev;
+    }
+
+    // Transform back to true electric field variables: Eₜ = eₜ and Eₙ = eₙ / ikₙ.
+    e0.Real().Read();  // Ensure memory is allocated on device before aliasing
+    e0.Imag().Read();
+    Vector e0nr(e0.Real(), port_nd_fespace->GetTrueVSize(),
+                port_h1_fespace->GetTrueVSize());
+    Vector e0ni(e0.Imag(), port_nd_fespace->GetTrueVSize(),
+                port_h1_fespace->GetTrueVSize());
+    e0nr.UseDevice(true);
+    e0ni.UseDevice(true);
+    ComplexVector::AXPBY(1.0 / (1i * kn0), e0nr, e0ni, 0.0, e0nr, e0ni);
+  }
+  omega0 = omega1;
+
+  // Distribute the computed field Eₜ and Eₙ to the grid functions.
+  {
+    e0.Real().Read();  // Ensure memory is allocated on device before aliasing
+    e0.Imag().Read();
+    Vector e0tr(e0.Real(), 0, port_nd_fespace->GetTrueVSize());
+    Vector e0nr(e0.Real(), port_nd_fespace->GetTrueVSize(),
+                port_h1_fespace->GetTrueVSize());
+    Vector e0ti(e0.Imag(), 0, port_nd_fespace->GetTrueVSize());
+    Vector e0ni(e0.Imag(), port_nd_fespace->GetTrueVSize(),
+                port_h1_fespace->GetTrueVSize());
+    e0tr.UseDevice(true);
+    e0nr.UseDevice(true);
+    e0ti.UseDevice(true);
+    e0ni.UseDevice(true);
+    port_E0t->Real().SetFromTrueDofs(e0tr);  // Parallel distribute
+    port_E0t->Imag().SetFromTrueDofs(e0ti);
+    port_E0n->Real().SetFromTrueDofs(e0nr);
+    port_E0n->Imag().SetFromTrueDofs(e0ni);
+  }
+
+  // Normalize the mode and make it available to congruent ports.
+  NormalizeMode();
+  if (mode_dependents)
+  {
+    GatherSerialMode();
+  }
+
+  // Store the normalized mode for interpolation at later frequencies.
+  if (interp_tol > 0.0 && !interp)
+  {
+    if (mode_cache.size() >= MODE_CACHE_SIZE && !mode_cache.count(omega0))
+    {
+      auto first = mode_cache.begin(), last = std::prev(mode_cache.end());
+      mode_cache.erase((omega0 - first->first > last->first - omega0) ? first : last);
+    }
+    auto &[kn, e] = mode_cache[omega0];
+    kn = kn0;
+    e.SetSize(e0.Size());
+    e.UseDevice(true);
+    e.Real().Read();
+    e.Imag().Read();
+    Vector etr(e.Real(), 0, port_nd_fespace->GetTrueVSize());
+    Vector enr(e.Real(), port_nd_fespace->GetTrueVSize(), port_h1_fespace->GetTrueVSize());
+    Vector eti(e.Imag(), 0, port_nd_fespace->GetTrueVSize());
+    Vector eni(e.Imag(), port_nd_fespace->GetTrueVSize(), port_h1_fespace->GetTrueVSize());
+    port_E0t->Real().GetTrueDofs(etr);
+    port_E0t->Imag().GetTrueDofs(eti);
+    port_E0n->Real().GetTrueDofs(enr);
+    port_E0n->Imag().GetTrueDofs(eni);
+  }
+}
+
+void WavePortData::SolveMode()
+{
+  if (!opA)
+  {
+    return;
+  }
+
+  // Configure and solve the (inverse) eigenvalue problem for the desired boundary mode.
+  // Linear solves are preconditioned with the real part of the system matrix (ignore loss
+  // tangent). Only processes in the port communicator participate.
+  if (port_comm != MPI_COMM_NULL)
+  {
+    ComplexWrapperOperator opP(opA->Real(), nullptr);  // Non-owning constructor
+    ksp->SetOperators(*opA, opP);
+    eigen->SetOperators(*opB, *opA, EigenvalueSolver::ScaleType::NONE);
+    if (has_prev)
+    {
+      // Warm-start from the mode at the previous frequency, perturbed by the default
+      // initial vector so that the Krylov space is not restricted to a near-invariant
+      // subspace.
+      ComplexVector v(e_prev);
+      v.Add(0.1 / linalg::Norml2(port_comm, v0), v0);
+      eigen->SetInitialSpace(v);
+    }
+    else
+    {
+      eigen->SetInitialSpace(v0);
+    }
+    int num_conv = eigen->Solve();
+    MFEM_VERIFY(num_conv >= mode_idx, "Wave port eigensolver did not converge!");
+    int mode = mode_idx - 1;
+    ComplexVector e(v0.Size());
+    e.UseDevice(true);
+    if (mode_tracking && has_prev)
+    {
+      // Select the converged mode with the largest B-weighted overlap with the mode at the
+      // previous frequency, so that modes are not swapped when their propagation constants
+      // cross.
+      ComplexVector Be(e_prev.Size());
+      Be.UseDevice(true);
+      opB->Mult(e_prev, Be);
+      std::vector<std::complex<double>> dot(2 * num_conv + 1);
+      for (int j = 0; j < num_conv; j++)
+      {
+        eigen->GetEigenvector(j, e);
+        dot[2 * j] = linalg::LocalDot(e, Be);
+        opB->Mult(e, Be);
+        dot[2 * j + 1] = linalg::LocalDot(e, Be);
+        opB->Mult(e_prev, Be);
+      }
+      dot[2 * num_conv] = linalg::LocalDot(e_prev, Be);
+      Mpi::GlobalSum(2 * num_conv + 1, dot.data(), port_comm);
+      double max_overlap = -1.0;
+      for (int j = 0; j < num_conv; j++)
+      {
+        const double den =
+            std::sqrt(std::abs(dot[2 * j + 1]) * std::abs(dot[2 * num_conv]));
+        const double overlap = (den > 0.0) ? std::abs(dot[2 * j]) / den : 0.0;
+        if (overlap > max_overlap)
+        {
+          max_overlap = overlap;
+          mode = j;
+        }
+      }
+    }
+    lambda = eigen->GetEigenvalue(mode);
+    e_prev.SetSize(v0.Size());
+    e_prev.UseDevice(true);
+    eigen->GetEigenvector(mode, e_prev);
+    // Mpi::Print(port_comm, " ... Wave port eigensolver error = {} (bkwd), {} (abs)\n",
+    //            eigen->GetError(mode, EigenvalueSolver::ErrorType::BACKWARD),
+    //            eigen->GetError(mode, EigenvalueSolver::ErrorType::ABSOLUTE));
+  }
+  else
+  {
+    MFEM_ASSERT(v0.Size() == 0,
+                "Unexpected non-empty port FE space in wave port boundary mode solve!");
+  }
+  opA.reset();
+}
+
+void WavePortData::NormalizeMode()
+{
+  // Configure the linear forms for computing S-parameters (projection of the field onto the
+  // port mode). Normalize the mode for a chosen polarization direction and unit power,
+  // |E x H⋆| ⋅ n, integrated over the port surface (+n is the direction of propagation).
+  const auto &port_submesh = static_cast<const mfem::ParSubMesh &>(port_mesh->Get());
+  BdrSubmeshHVectorCoefficient<ValueType::REAL> port_nxH0r_func(
+      *port_E0t, *port_E0n, mat_op, port_submesh, submesh_parent_elems, kn0, omega0);
+  BdrSubmeshHVectorCoefficient<ValueType::IMAG> port_nxH0i_func(
+      *port_E0t, *port_E0n, mat_op, port_submesh, submesh_parent_elems, kn0, omega0);
+  {
+    port_sr = std::make_unique<mfem::LinearForm>(&port_nd_fespace->Get());
+    port_sr->AddDomainIntegrator(new VectorFEDomainLFIntegrator(port_nxH0r_func));
+    port_sr->UseFastAssembly(false);
+    port_sr->UseDevice(false);
+    port_sr->Assemble();
+    port_sr->UseDevice(true);
+  }
+  {
+    port_si = std::make_unique<mfem::LinearForm>(&port_nd_fespace->Get());
+    port_si->AddDomainIntegrator(new VectorFEDomainLFIntegrator(port_nxH0i_func));
+    port_si->UseFastAssembly(false);
+    port_si->UseDevice(false);
+    port_si->Assemble();
+    port_si->UseDevice(true);
+  }
+  Normalize(*port_S0t, *port_E0t, *port_E0n, *port_sr, *port_si);
+}
+
+void WavePortData::ComputePortFrame()
+{
+  // Integrate the zeroth, first, and second moments of area over the port cross-section.
+  const auto &mesh = port_mesh->Get();
+  MPI_Comm comm = port_mesh->GetComm();
+  port_area = 0.0;
+  if (mesh.SpaceDimension() != 3)
+  {
+    return;
+  }
+  double moments[13] = {0.0};
+  mfem::IsoparametricTransformation T;
+  for (int e = 0; e < mesh.GetNE(); e++)
+  {
+    mesh.GetElementTransformation(e, &T);
+    const mfem::IntegrationRule &ir =
+        mfem::IntRules.Get(mesh.GetElementGeometry(e), 2 * T.Order() + T.OrderW());
+    for (int j = 0; j < ir.GetNPoints(); j++)
+    {
+      const mfem::IntegrationPoint &ip = ir.IntPoint(j);
+      T.SetIntPoint(&ip);
+      double x_data[3];
+      mfem::Vector x(x_data, 3);
+      T.Transform(ip, x);
+      const double w = ip.weight * T.Weight();
+      moments[0] += w;
+      for (int d = 0; d < 3; d++)
+      {
+        moments[1 + d] += w * x(d);
+        for (int d2 = 0; d2 < 3; d2++)
+        {
+          moments[4 + 3 * d + d2] += w * x(d) * x(d2);
+        }
+      }
+    }
+  }
+  Mpi::GlobalSum(13, moments, comm);
+  port_area = moments[0];
+  port_c.SetSize(3);
+  for (int d = 0; d < 3; d++)
+  {
+    port_c(d) = moments[1 + d] / port_area;
+  }
+
+  // The principal axes are the eigenvectors of the second moment tensor about the centroid.
+  // The smallest moment (zero) corresponds to the normal direction.
+  Eigen::Matrix3d M;
+  for (int d = 0; d < 3; d++)
+  {
+    for (int d2 = 0; d2 < 3; d2++)
+    {
+      M(d, d2) = moments[4 + 3 * d + d2] - port_area * port_c(d) * port_c(d2);
+    }
+  }
+  Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eig(M);
+  port_axes.SetSize(3);
+  port_I.SetSize(2);
+  for (int j = 0; j < 3; j++)
+  {
+    for (int d = 0; d < 3; d++)
+    {
+      port_axes(d, j) = eig.eigenvectors()(d, 2 - j);
+    }
+  }
+  port_I(0) = eig.eigenvalues()(2);
+  port_I(1) = eig.eigenvalues()(1);
+
+  // For cross-sections with nearly equal principal moments, like circular or square ports,
+  // the in-plane axes are not well-defined and we instead align the major axis with the
+  // direction to the element centroid farthest from the port centroid (on the lowest rank
+  // in case of ties).
+  if (port_I(0) - port_I(1) < 1.0e-3 * port_I(0))
+  {
+    const std::vector<double> data = GetElementData();
+    const int ne = static_cast<int>(data.size()) / ELEM_DATA_SIZE;
+    auto Distance = [&](int e)
+    {
+      const double *x = data.data() + e * ELEM_DATA_SIZE;
+      return std::hypot(x[0] - port_c(0), x[1] - port_c(1), x[2] - port_c(2));
+    };
+    double d_max = 0.0;
+    for (int e = 0; e < ne; e++)
+    {
+      d_max = std::max(d_max, Distance(e));
+    }
+    Mpi::GlobalMax(1, &d_max, comm);
+    double x_far[3] = {0.0};
+    int rank = Mpi::Size(comm);
+    for (int e = 0; e < ne; e++)
+    {
+      if (Distance(e) >= (1.0 - 1.0e-6) * d_max)
+      {
+        std::copy(data.begin() + e * ELEM_DATA_SIZE,
+                  data.begin() + e * ELEM_DATA_SIZE + 3, x_far);
+        rank = Mpi::Rank(comm);
+        break;
+      }
+    }
+    Mpi::GlobalMin(1, &rank, comm);
+    Mpi::Broadcast(3, x_far, rank, comm);
+    mfem::Vector a(x_far, 3), n(3), b(3);
+    port_axes.GetColumn(2, n);
+    a -= port_c;
+    a.Add(-(a * n), n);
+    a /= a.Norml2();
+    n.cross3D(a, b);
+    port_axes.SetCol(0, a);
+    port_axes.SetCol(1, b);
+  }
+}
+
+std::vector<double> WavePortData::GetElementData() const
+{
+  const auto &port_submesh = static_cast<const mfem::ParSubMesh &>(port_mesh->Get());
+  const auto &parent = *port_submesh.GetParent();
+  const mfem::Array<int> &parent_elems = port_submesh.GetParentElementIDMap();
+
+  // Mark the Dirichlet BC dofs on the local elements of the port.
+  const int nd_tsize = port_nd_fespace->GetTrueVSize();
+  Vector tnd(nd_tsize), th1(port_h1_fespace->GetTrueVSize());
+  tnd = 0.0;
+  th1 = 0.0;
+  for (auto tdof : port_dbc_tdof_list)
+  {
+    if (tdof < nd_tsize)
     {
-#if !defined(MFEM_USE_SUPERLU)
-      MFEM_ABORT("Solver was not built with SuperLU_DIST support, please choose a "
-                 "different solver!");
-#endif
+      tnd(tdof) = 1.0;
     }
-    else if (pc_type == config::LinearSolverData::Type::STRUMPACK ||
-             pc_type == config::LinearSolverData::Type::STRUMPACK_MP)
+    else
     {
-#if !defined(MFEM_USE_STRUMPACK)
-      MFEM_ABORT("Solver was not built with STRUMPACK support, please choose a "
-                 "different solver!");
-#endif
+      th1(tdof - nd_tsize) = 1.0;
     }
-    else if (pc_type == config::LinearSolverData::Type::MUMPS)
+  }
+  mfem::ParGridFunction dnd(&port_nd_fespace->Get()), dh1(&port_h1_fespace->Get());
+  dnd.SetFromTrueDofs(tnd);
+  dh1.SetFromTrueDofs(th1);
+
+  std::vector<double> data;
+  data.reserve(port_submesh.GetNE() * ELEM_DATA_SIZE);
+  mfem::IsoparametricTransformation T;
+  mfem::Array<int> dofs;
+  for (int e = 0; e < port_submesh.GetNE(); e++)
+  {
+    double x_data[3];
+    mfem::Vector x(x_data, 3);
+    port_submesh.GetElementTransformation(e, &T);
+    T.Transform(mfem::Geometries.GetCenter(port_submesh.GetElementGeometry(e)), x);
+    data.insert(data.end(), x_data, x_data + 3);
+
+    double n_dbc = 0.0;
+    port_nd_fespace->Get().GetElementDofs(e, dofs);
+    for (auto dof : dofs)
     {
-#if !defined(MFEM_USE_MUMPS)
-      MFEM_ABORT("Solver was not built with MUMPS support, please choose a "
-                 "different solver!");
-#endif
+      n_dbc += dnd(dof >= 0 ? dof : -1 - dof);
     }
-    else  // Default choice
+    port_h1_fespace->Get().GetElementDofs(e, dofs);
+    for (auto dof : dofs)
     {
-#if defined(MFEM_USE_SUPERLU)
-      pc_type = config::LinearSolverData::Type::SUPERLU;
-#elif defined(MFEM_USE_STRUMPACK)
-      pc_type = config::LinearSolverData::Type::STRUMPACK;
-#elif defined(MFEM_USE_MUMPS)
-      pc_type = config::LinearSolverData::Type::MUMPS;
-#else
-#error "Wave port solver requires building with SuperLU_DIST, STRUMPACK, or MUMPS!"
-#endif
+      n_dbc += dh1(dof);
     }
-    auto pc = std::make_unique<MfemWrapperSolver<ComplexOperator>>(
-        [&]() -> std::unique_ptr<mfem::Solver>
-        {
-          if (pc_type == config::LinearSolverData::Type::SUPERLU)
-          {
-#if defined(MFEM_USE_SUPERLU)
-            auto slu = std::make_unique<SuperLUSolver>(
-                port_comm, config::LinearSolverData::SymFactType::DEFAULT, false,
-                data.verbose - 1);
-            // slu->GetSolver().SetColumnPermutation(mfem::superlu::MMD_AT_PLUS_A);
-            return slu;
-#endif
-          }
-          else if (pc_type == config::LinearSolverData::Type::STRUMPACK)
-          {
-#if defined(MFEM_USE_STRUMPACK)
-            auto strumpack = std::make_unique<StrumpackSolver>(
-                port_comm, config::LinearSolverData::SymFactType::DEFAULT,
-                config::LinearSolverData::CompressionType::NONE, 0.0, 0, 0,
-                data.verbose - 1);
-            // strumpack->SetReorderingStrategy(strumpack::ReorderingStrategy::AMD);
-            return strumpack;
-#endif
-          }
-          else if (pc_type == config::LinearSolverData::Type::MUMPS)
-          {
-#if defined(MFEM_USE_MUMPS)
-            auto mumps = std::make_unique<MumpsSolver>(
-                port_comm, mfem::MUMPSSolver::UNSYMMETRIC,
-                config::LinearSolverData::SymFactType::DEFAULT, 0.0, data.verbose - 1);
-            // mumps->SetReorderingStrategy(mfem::MUMPSSolver::AMD);
-            return mumps;
-#endif
-          }
-          return {};
-        }());
-    pc->SetSaveAssembled(false);
-    ksp = std::make_unique<ComplexKspSolver>(std::move(gmres), std::move(pc));
+    data.push_back(n_dbc);
+
+    int f, o, iel1, iel2;
+    parent.GetBdrElementFace(parent_elems[e], &f, &o);
+    parent.GetFaceElements(f, &iel1, &iel2);
+    const int attr = parent.GetAttribute(iel1);
+    for (const auto &M :
+         {mat_op.GetPermittivityReal(attr), mat_op.GetPermittivityImag(attr),
+          mat_op.GetInvPermeability(attr)})
+    {
+      MFEM_ASSERT(M.Height() == 3 && M.Width() == 3,
+                  "Unexpected material property size for wave port boundary!");
+      data.insert(data.end(), M.Data(), M.Data() + 9);
+    }
+  }
+  return data;
+}
 
-    // Define the eigenvalue solver.
-    constexpr int print = 0;
-    config::WavePortData::EigenSolverType type = data.eigen_type;
-    if (type == config::WavePortData::EigenSolverType::SLEPC)
+bool WavePortData::SetUpSerialMesh(bool local)
+{
+  // The serial mesh is only needed on processes with local elements of a port mapping its
+  // mode from this port, and on the root process which gathers it. It is constructed again
+  // if further processes require it.
+  MPI_Comm comm = port_mesh->GetComm();
+  int setup = (local && !serial_mesh);
+  Mpi::GlobalMax(1, &setup, comm);
+  if (!setup)
+  {
+    return serial_valid;
+  }
+  const bool keep = local || serial_mesh || Mpi::Root(comm);
+  if (serial_comm != MPI_COMM_NULL)
+  {
+    MPI_Comm_free(&serial_comm);
+  }
+  MPI_Comm_split(comm, keep ? 0 : MPI_UNDEFINED, Mpi::Rank(comm), &serial_comm);
+  serial_E0.clear();
+  serial_nd_fespace.reset();
+  serial_h1_fespace.reset();
+  serial_mesh.reset();
+  serial_elem_data.clear();
+  serial_elem_order.clear();
+
+  // Gather the port mesh on the root process and broadcast it to the processes which
+  // require it. The element ordering is preserved (no refinement reordering or orientation
+  // fixing) so that it matches the ordering used for gathering grid functions.
+  std::string buf;
+  {
+    mfem::Mesh smesh = port_mesh->Get().GetSerialMesh(0);
+    if (Mpi::Root(comm))
     {
-#if !defined(PALACE_WITH_SLEPC)
-      MFEM_ABORT("Solver was not built with SLEPc support, please choose a "
-                 "different solver!");
-#endif
+      std::ostringstream os;
+      os.precision(17);
+      smesh.Print(os);
+      buf = os.str();
     }
-    else if (type == config::WavePortData::EigenSolverType::ARPACK)
+  }
+
+  // Gather the per-element data in rank order, which is the element ordering of the serial
+  // mesh.
+  {
+    std::vector<double> data = GetElementData();
+    int count = static_cast<int>(data.size());
+    std::vector<int> counts(Mpi::Size(comm)), displs(Mpi::Size(comm) + 1, 0);
+    MPI_Gather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, comm);
+    std::partial_sum(counts.begin(), counts.end(), displs.begin() + 1);
+    serial_elem_data.resize(Mpi::Root(comm) ? displs.back() : 0);
+    MPI_Gatherv(data.data(), count, MPI_DOUBLE, serial_elem_data.data(), counts.data(),
+                displs.data(), MPI_DOUBLE, 0, comm);
+  }
+  int valid = 0;
+  if (serial_comm != MPI_COMM_NULL)
+  {
+    int len[2] = {static_cast<int>(buf.size()), static_cast<int>(serial_elem_data.size())};
+    Mpi::Broadcast(2, len, 0, serial_comm);
+    buf.resize(len[0]);
+    serial_elem_data.resize(len[1]);
+    Mpi::Broadcast(len[0], buf.data(), 0, serial_comm);
+    Mpi::Broadcast(len[1], serial_elem_data.data(), 0, serial_comm);
+    std::istringstream is(buf);
+    serial_mesh = std::make_unique<mfem::Mesh>(is, 1, 0, false);
+    serial_nd_fec = std::make_unique<mfem::ND_FECollection>(port_nd_fec->GetOrder(),
+                                                            serial_mesh->Dimension());
+    serial_h1_fec = std::make_unique<mfem::H1_FECollection>(port_h1_fec->GetOrder(),
+                                                            serial_mesh->Dimension());
+    serial_nd_fespace =
+        std::make_unique<mfem::FiniteElementSpace>(serial_mesh.get(), serial_nd_fec.get());
+    serial_h1_fespace =
+        std::make_unique<mfem::FiniteElementSpace>(serial_mesh.get(), serial_h1_fec.get());
+    for (int k = 0; k < 4; k++)
     {
-#if !defined(PALACE_WITH_ARPACK)
-      MFEM_ABORT("Solver was not built with ARPACK support, please choose a "
-                 "different solver!");
-#endif
+      serial_E0.push_back(std::make_unique<mfem::GridFunction>(
+          (k < 2) ? serial_nd_fespace.get() : serial_h1_fespace.get()));
     }
-    else  // Default choice
+
+    // Verify the element ordering and sort the elements by their coordinate along the
+    // major principal axis.
+    const int ne = serial_mesh->GetNE();
+    const double tol = 1.0e-6 * std::sqrt(port_area);
+    bool ordered = (static_cast<int>(serial_elem_data.size()) == ne * ELEM_DATA_SIZE);
+    mfem::IsoparametricTransformation T;
+    for (int e = 0; ordered && e < ne; e++)
     {
-#if defined(PALACE_WITH_SLEPC)
-      type = config::WavePortData::EigenSolverType::SLEPC;
-#elif defined(PALACE_WITH_ARPACK)
-      type = config::WavePortData::EigenSolverType::ARPACK;
-#else
-#error "Wave port solver requires building with ARPACK or SLEPc!"
-#endif
+      double x_data[3];
+      mfem::Vector x(x_data, 3);
+      serial_mesh->GetElementTransformation(e, &T);
+      T.Transform(mfem::Geometries.GetCenter(serial_mesh->GetElementGeometry(e)), x);
+      const double *xe = serial_elem_data.data() + e * ELEM_DATA_SIZE;
+      ordered = (std::hypot(x(0) - xe[0], x(1) - xe[1], x(2) - xe[2]) <= tol);
+      double s = 0.0;
+      for (int d = 0; d < 3; d++)
+      {
+        s += (xe[d] - port_c(d)) * port_axes(d, 0);
+      }
+      serial_elem_order.emplace_back(s, e);
     }
-    if (type == config::WavePortData::EigenSolverType::ARPACK)
+    std::sort(serial_elem_order.begin(), serial_elem_order.end());
+    valid = ordered;
+  }
+  Mpi::Broadcast(1, &valid, 0, comm);
+  serial_valid = valid;
+  return serial_valid;
+}
+
+std::vector<mfem::DenseMatrix>
+WavePortData::GetCongruentRotations(const mfem::DenseMatrix &axes,
+                                    const mfem::DenseMatrix &axes_src)
+{
+  // The candidates are R = V diag(s₁, s₂, s₃) Uᵀ for the principal axes U and V and signs
+  // sᵢ = ±1, restricted to proper rotations (det(R) = +1). An improper map between the
+  // cross-sections is equivalent on the port plane to a proper rotation composed with the
+  // reflection through the plane, so no congruence is missed, and mapped fields are not
+  // mirrored.
+  std::vector<mfem::DenseMatrix> rotations;
+  mfem::DenseMatrix R(3);
+  for (int s = 0; s < 8; s++)
+  {
+    const double sgn[3] = {(s & 1) ? -1.0 : 1.0, (s & 2) ? -1.0 : 1.0,
+                           (s & 4) ? -1.0 : 1.0};
+    for (int i = 0; i < 3; i++)
     {
-#if defined(PALACE_WITH_ARPACK)
-      eigen = std::make_unique<arpack::ArpackEPSSolver>(port_comm, print);
-#endif
+      for (int j = 0; j < 3; j++)
+      {
+        R(i, j) = 0.0;
+        for (int k = 0; k < 3; k++)
+        {
+          R(i, j) += axes_src(i, k) * sgn[k] * axes(j, k);
+        }
+      }
     }
-    else  // config::WavePortData::EigenSolverType::SLEPC
+    if (R.Det() > 0.0)
     {
-#if defined(PALACE_WITH_SLEPC)
-      auto slepc = std::make_unique<slepc::SlepcEPSSolver>(port_comm, print);
-      slepc->SetType(slepc::SlepcEigenvalueSolver::Type::KRYLOVSCHUR);
-      slepc->SetProblemType(slepc::SlepcEigenvalueSolver::ProblemType::GEN_NON_HERMITIAN);
-      eigen = std::move(slepc);
-#endif
+      rotations.push_back(R);
     }
-    eigen->SetNumModes(mode_idx, std::max(2 * mode_idx + 1, 5));
-    eigen->SetTol(data.eig_tol);
-    eigen->SetLinearSolver(*ksp);
-
-    // We want to ignore evanescent modes (kₙ with large imaginary component). The
-    // eigenvalue 1 / (-kₙ² - σ) of the shifted problem will be a large-magnitude negative
-    // real number for an eigenvalue kₙ² with real part close to but not below the cutoff σ.
-    eigen->SetWhichEigenpairs(EigenvalueSolver::WhichType::SMALLEST_REAL);
   }
+  return rotations;
+}
 
-  // Configure port mode sign convention: 1ᵀ Re{-n x H} >= 0 on the "upper-right quadrant"
-  // of the wave port boundary, in order to deal with symmetry effectively.
+bool WavePortData::SetModeSource(WavePortData &src)
+{
+  // Inexpensive checks first: mode index, problem sizes, number of Dirichlet BC dofs, and
+  // the area and principal moments of the cross-section.
+  MPI_Comm comm = port_mesh->GetComm();
+  if (port_area <= 0.0 || src.port_area <= 0.0 || src.mode_src || mode_src ||
+      mode_idx != src.mode_idx || GlobalTrueNDSize() != src.GlobalTrueNDSize() ||
+      GlobalTrueH1Size() != src.GlobalTrueH1Size())
   {
-    Vector bbmin, bbmax;
-    mesh::GetAxisAlignedBoundingBox(*port_mesh, bbmin, bbmax);
-    const int dim = port_mesh->SpaceDimension();
+    return false;
+  }
+  int n_dbc[2] = {port_dbc_tdof_list.Size(), src.port_dbc_tdof_list.Size()};
+  Mpi::GlobalSum(2, n_dbc, comm);
+  constexpr double rtol = 1.0e-6;
+  if (n_dbc[0] != n_dbc[1] || std::abs(port_area - src.port_area) > rtol * src.port_area ||
+      std::abs(port_I(0) - src.port_I(0)) > rtol * src.port_I(0) ||
+      std::abs(port_I(1) - src.port_I(1)) > rtol * src.port_I(0))
+  {
+    return false;
+  }
+  if (!src.SetUpSerialMesh(HasLocalElements()))
+  {
+    return false;
+  }
 
-    double la = 0.0, lb = 0.0;
-    int da = -1, db = -1;
-    for (int d = 0; d < dim; d++)
+  // Try the candidate rigid motions mapping the principal axes of this port to the
+  // principal axes of the source port up to sign. For each, every local element centroid
+  // must map to a source element centroid with the same number of Dirichlet BC dofs and
+  // rotated material properties.
+  const std::vector<double> data = GetElementData();
+  const int ne = static_cast<int>(data.size()) / ELEM_DATA_SIZE;
+  const double tol = 1.0e-6 * std::sqrt(src.port_area);
+  auto SameMaterial = [](const mfem::DenseMatrix &R, const double *M, const double *M_src)
+  {
+    // Compare M with Rᵀ M_src R (column-major storage).
+    double norm = 1.0, diff = 0.0;
+    for (int i = 0; i < 3; i++)
     {
-      double diff = bbmax(d) - bbmin(d);
-      if (diff > la)
+      for (int j = 0; j < 3; j++)
       {
-        lb = la;
-        la = diff;
-        db = da;
-        da = d;
-      }
-      else if (diff > lb)
-      {
-        lb = diff;
-        db = d;
+        double v = 0.0;
+        for (int k = 0; k < 3; k++)
+        {
+          for (int l = 0; l < 3; l++)
+          {
+            v += R(k, i) * M_src[k + 3 * l] * R(l, j);
+          }
+        }
+        norm = std::max(norm, std::abs(M[i + 3 * j]));
+        diff = std::max(diff, std::abs(M[i + 3 * j] - v));
       }
     }
-    MFEM_VERIFY(da >= 0 && db >= 0 && da != db,
-                "Unexpected wave port geometry for normalization!");
-    double ca = 0.5 * (bbmax[da] + bbmin[da]), cb = 0.5 * (bbmax[db] + bbmin[db]);
-
-    auto TDirection = [da, db, ca, cb, dim](const Vector &x, Vector &f)
+    return diff <= 1.0e-10 * norm;
+  };
+  std::vector<int> elems(ne);
+  for (const auto &R : GetCongruentRotations(port_axes, src.port_axes))
+  {
+    int match = 1;
+    for (int e = 0; e < ne && match; e++)
     {
-      MFEM_ASSERT(x.Size() == dim,
-                  "Invalid dimension mismatch for wave port mode normalization!");
-      f.SetSize(dim);
-      if (x[da] >= ca && x[db] >= cb)
+      const double *xe = data.data() + e * ELEM_DATA_SIZE;
+      double y[3], s_y = 0.0;
+      for (int i = 0; i < 3; i++)
       {
-        f = 1.0;
+        y[i] = src.port_c(i);
+        for (int j = 0; j < 3; j++)
+        {
+          y[i] += R(i, j) * (xe[j] - port_c(j));
+        }
       }
-      else
+      for (int d = 0; d < 3; d++)
       {
-        f = 0.0;
+        s_y += (y[d] - src.port_c(d)) * src.port_axes(d, 0);
       }
-    };
-    mfem::VectorFunctionCoefficient tfunc(dim, TDirection);
-    port_S0t = std::make_unique<GridFunction>(*port_nd_fespace);
-    port_S0t->Real().ProjectCoefficient(tfunc);
+      elems[e] = -1;
+      auto it = std::lower_bound(src.serial_elem_order.begin(),
+                                 src.serial_elem_order.end(),
+                                 std::make_pair(s_y - tol, -1));
+      for (; it != src.serial_elem_order.end() && it->first <= s_y + tol; ++it)
+      {
+        const double *xk = src.serial_elem_data.data() + it->second * ELEM_DATA_SIZE;
+        if (std::hypot(y[0] - xk[0], y[1] - xk[1], y[2] - xk[2]) <= tol)
+        {
+          elems[e] = it->second;
+          break;
+        }
+      }
+      if (elems[e] < 0)
+      {
+        match = 0;
+        break;
+      }
+      const double *xk = src.serial_elem_data.data() + elems[e] * ELEM_DATA_SIZE;
+      match = (xe[3] == xk[3]) && SameMaterial(R, xe + 4, xk + 4) &&
+              SameMaterial(R, xe + 13, xk + 13) && SameMaterial(R, xe + 22, xk + 22);
+    }
+    Mpi::GlobalMin(1, &match, comm);
+    if (match)
+    {
+      mode_src = &src;
+      mode_R = R;
+      mode_c = port_c;
+      mode_c_src = src.port_c;
+      mode_src_elems = std::move(elems);
+      src.mode_dependents = true;
+
+      // The eigenvalue problem is never solved for this port.
+      ksp.reset();
+      eigen.reset();
+      opB.reset();
+      Atnr.reset();
+      Atni.reset();
+      Antr.reset();
+      Anti.reset();
+      Annr.reset();
+      Anni.reset();
+      return true;
+    }
   }
+  return false;
 }
 
-WavePortData::~WavePortData()
+void WavePortData::GatherSerialMode()
 {
-  // Free the solvers before the communicator on which they are based.
-  ksp.reset();
-  eigen.reset();
-  if (port_comm != MPI_COMM_NULL)
+  // Gather the normalized mode on the root process and broadcast it to the processes with
+  // elements of congruent ports, for evaluation at arbitrary points of the port. The
+  // element dof values are gathered in rank order, which is the element ordering of the
+  // serial mesh.
+  MPI_Comm comm = port_mesh->GetComm();
+  const mfem::ParGridFunction *U[4] = {&port_E0t->Real(), &port_E0t->Imag(),
+                                       &port_E0n->Real(), &port_E0n->Imag()};
+  mfem::Array<int> dofs;
+  mfem::Vector vals;
+  for (int k = 0; k < 4; k++)
   {
-    MPI_Comm_free(&port_comm);
+    const mfem::ParFiniteElementSpace &fespace = *U[k]->ParFESpace();
+    std::vector<double> data;
+    U[k]->HostRead();
+    for (int e = 0; e < fespace.GetNE(); e++)
+    {
+      fespace.GetElementVDofs(e, dofs);
+      U[k]->GetSubVector(dofs, vals);
+      data.insert(data.end(), vals.begin(), vals.end());
+    }
+    int count = static_cast<int>(data.size());
+    std::vector<int> counts(Mpi::Size(comm)), displs(Mpi::Size(comm) + 1, 0);
+    MPI_Gather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, comm);
+    std::partial_sum(counts.begin(), counts.end(), displs.begin() + 1);
+    std::vector<double> serial_data(Mpi::Root(comm) ? displs.back() : 0);
+    MPI_Gatherv(data.data(), count, MPI_DOUBLE, serial_data.data(), counts.data(),
+                displs.data(), MPI_DOUBLE, 0, comm);
+    if (serial_comm == MPI_COMM_NULL)
+    {
+      continue;
+    }
+    auto &u = *serial_E0[k];
+    if (Mpi::Root(comm))
+    {
+      const mfem::FiniteElementSpace &serial_fespace = *u.FESpace();
+      for (int e = 0, i = 0; e < serial_fespace.GetNE(); e++)
+      {
+        serial_fespace.GetElementVDofs(e, dofs);
+        u.SetSubVector(dofs, serial_data.data() + i);
+        i += dofs.Size();
+      }
+    }
+    Mpi::Broadcast(u.Size(), u.HostReadWrite(), 0, serial_comm);
   }
 }
 
-void WavePortData::Initialize(double omega)
+void WavePortData::MapMode()
 {
-  if (omega == omega0)
+  // Evaluate the mode of the source port at the image of each point of this port under the
+  // rigid motion (a proper rotation) and project onto the port FE spaces. Eₙ is mapped as a
+  // scalar: if the rigid motion reverses the port normal, the mapped field is the mode
+  // propagating in the opposite direction, which has the same Eₜ and opposite normal field
+  // component, and the two sign changes cancel.
+  const auto &src = *mode_src;
+  if (!HasLocalElements())
   {
     return;
   }
+  MappedPortEvaluator map(*src.serial_mesh, mode_R, mode_c, mode_c_src, mode_src_elems);
+  MappedPortVectorCoefficient Etr_func(*src.serial_E0[0], map),
+      Eti_func(*src.serial_E0[1], map);
+  MappedPortCoefficient Enr_func(*src.serial_E0[2], map), Eni_func(*src.serial_E0[3], map);
+  port_E0t->Real().ProjectCoefficient(Etr_func);
+  port_E0t->Imag().ProjectCoefficient(Eti_func);
+  port_E0n->Real().ProjectCoefficient(Enr_func);
+  port_E0n->Imag().ProjectCoefficient(Eni_func);
+}
 
-  // Construct matrices and solve the generalized eigenvalue problem for the desired wave
-  // port mode. The B matrix is operating frequency-independent and has already been
-  // constructed.
-  std::unique_ptr<ComplexOperator> opA;
-  const double sigma = -omega * omega * mu_eps_min;
-  {
-    auto [Attr, Atti] = GetAtt(mat_op, *port_nd_fespace, port_normal, omega, sigma);
-    auto [Ar, Ai] =
-        GetSystemMatrixA(Attr.get(), Atti.get(), Atnr.get(), Atni.get(), Antr.get(),
-                         Anti.get(), Annr.get(), Anni.get(), port_dbc_tdof_list);
-    opA = std::make_unique<ComplexWrapperOperator>(std::move(Ar), std::move(Ai));
-  }
-
-  // Configure and solve the (inverse) eigenvalue problem for the desired boundary mode.
-  // Linear solves are preconditioned with the real part of the system matrix (ignore loss
-  // tangent).
-  std::complex<double> lambda;
-  if (port_comm != MPI_COMM_NULL)
+bool WavePortData::InterpolateMode(double omega)
+{
+  if (interp_tol <= 0.0 || mode_cache.empty())
   {
-    ComplexWrapperOperator opP(opA->Real(), nullptr);  // Non-owning constructor
-    ksp->SetOperators(*opA, opP);
-    eigen->SetOperators(*opB, *opA, EigenvalueSolver::ScaleType::NONE);
-    eigen->SetInitialSpace(v0);
-    int num_conv = eigen->Solve();
-    MFEM_VERIFY(num_conv >= mode_idx, "Wave port eigensolver did not converge!");
-    lambda = eigen->GetEigenvalue(mode_idx - 1);
-    // Mpi::Print(port_comm, " ... Wave port eigensolver error = {} (bkwd), {} (abs)\n",
-    //            eigen->GetError(mode_idx - 1, EigenvalueSolver::ErrorType::BACKWARD),
-    //            eigen->GetError(mode_idx - 1, EigenvalueSolver::ErrorType::ABSOLUTE));
+    return false;
   }
-  Mpi::Broadcast(1, &lambda, port_root, port_mesh->GetComm());
 
-  // Extract the eigenmode solution and postprocess. The extracted eigenvalue is λ =
-  // 1 / (-kₙ² - σ).
-  kn0 = std::sqrt(-sigma - 1.0 / lambda);
-  omega0 = omega;
-
-  // Separate the computed field out into eₜ and eₙ and and transform back to true
-  // electric field variables: Eₜ = eₜ and Eₙ = eₙ / ikₙ.
+  // Find the cached samples bracketing the requested frequency. Outside of the range of
+  // cached frequencies (as for a sweep in one direction), use the two nearest samples for
+  // extrapolation, at a distance from the nearest sample no larger than their spacing.
+  auto upper = mode_cache.lower_bound(omega), lower = upper;
+  if (upper == mode_cache.end() || (upper == mode_cache.begin() && upper->first > omega))
   {
-    if (port_comm != MPI_COMM_NULL)
+    if (mode_cache.size() < 2)
+    {
+      return false;
+    }
+    if (upper == mode_cache.end())
     {
-      eigen->GetEigenvector(mode_idx - 1, e0);
+      lower = std::prev(upper, 2);
+      upper = std::next(lower);
+      if (omega - upper->first > upper->first - lower->first)
+      {
+        return false;
+      }
     }
     else
     {
-      MFEM_ASSERT(e0.Size() == 0,
-                  "Unexpected non-empty port FE space in wave port boundary mode solve!");
+      upper = std::next(lower);
+      if (lower->first - omega > upper->first - lower->first)
+      {
+        return false;
+      }
     }
-    e0.Real().Read();  // Ensure memory is allocated on device before aliasing
-    e0.Imag().Read();
-    Vector e0tr(e0.Real(), 0, port_nd_fespace->GetTrueVSize());
-    Vector e0nr(e0.Real(), port_nd_fespace->GetTrueVSize(),
-                port_h1_fespace->GetTrueVSize());
-    Vector e0ti(e0.Imag(), 0, port_nd_fespace->GetTrueVSize());
-    Vector e0ni(e0.Imag(), port_nd_fespace->GetTrueVSize(),
-                port_h1_fespace->GetTrueVSize());
-    e0tr.UseDevice(true);
-    e0nr.UseDevice(true);
-    e0ti.UseDevice(true);
-    e0ni.UseDevice(true);
-    ComplexVector::AXPBY(1.0 / (1i * kn0), e0nr, e0ni, 0.0, e0nr, e0ni);
-    port_E0t->Real().SetFromTrueDofs(e0tr);  // Parallel distribute
-    port_E0t->Imag().SetFromTrueDofs(e0ti);
-    port_E0n->Real().SetFromTrueDofs(e0nr);
-    port_E0n->Imag().SetFromTrueDofs(e0ni);
   }
-
-  // Configure the linear forms for computing S-parameters (projection of the field onto the
-  // port mode). Normalize the mode for a chosen polarization direction and unit power,
-  // |E x H⋆| ⋅ n, integrated over the port surface (+n is the direction of propagation).
+  else if (upper->first > omega)
   {
-    const auto &port_submesh = static_cast<const mfem::ParSubMesh &>(port_mesh->Get());
-    BdrSubmeshHVectorCoefficient<ValueType::REAL> port_nxH0r_func(
-        *port_E0t, *port_E0n, mat_op, port_submesh, submesh_parent_elems, kn0, omega0);
-    BdrSubmeshHVectorCoefficient<ValueType::IMAG> port_nxH0i_func(
-        *port_E0t, *port_E0n, mat_op, port_submesh, submesh_parent_elems, kn0, omega0);
-    {
-      port_sr = std::make_unique<mfem::LinearForm>(&port_nd_fespace->Get());
-      port_sr->AddDomainIntegrator(new VectorFEDomainLFIntegrator(port_nxH0r_func));
-      port_sr->UseFastAssembly(false);
-      port_sr->UseDevice(false);
-      port_sr->Assemble();
-      port_sr->UseDevice(true);
-    }
-    {
-      port_si = std::make_unique<mfem::LinearForm>(&port_nd_fespace->Get());
-      port_si->AddDomainIntegrator(new VectorFEDomainLFIntegrator(port_nxH0i_func));
-      port_si->UseFastAssembly(false);
-      port_si->UseDevice(false);
-      port_si->Assemble();
-      port_si->UseDevice(true);
-    }
-    Normalize(*port_S0t, *port_E0t, *port_E0n, *port_sr, *port_si);
+    --lower;
+  }
+  if (std::max(upper->first, omega) - std::min(lower->first, omega) > interp_tol * omega)
+  {
+    return false;
   }
+
+  // Linear interpolation (or extrapolation) of the propagation constant and normalized
+  // mode fields. The cached fields share the same phase and polarization convention.
+  const double t = (upper->first > lower->first)
+                       ? (omega - lower->first) / (upper->first - lower->first)
+                       : 0.0;
+  kn0 = (1.0 - t) * lower->second.first + t * upper->second.first;
+  e0.AXPBY(1.0 - t, lower->second.second, 0.0);
+  e0.Add(t, upper->second.second);
+  return true;
 }
 
 std::unique_ptr<mfem::VectorCoefficient>
@@ -1051,6 +2075,15 @@ WavePortOperator::WavePortOperator(const IoData &iodata, const MaterialOperator
               "Mesh mismatch in WavePortOperator FE spaces!");
   SetUpBoundaryProperties(iodata, mat_op, nd_fespace, h1_fespace);
   PrintBoundaryInfo(iodata, *nd_fespace.GetParMesh());
+  SetUpModeSources();
+  SetUpModeGroups(iodata, nd_fespace.GetComm());
+  for (const auto &[idx, data] : ports)
+  {
+    if (data.excitation)
+    {
+      excitation_idx.push_back(idx);
+    }
+  }
 }
 
 void WavePortOperator::SetUpBoundaryProperties(const IoData &iodata,
@@ -1157,6 +2190,75 @@ void WavePortOperator::SetUpBoundaryProperties(const IoData &iodata,
       "Wave port boundaries are only available for frequency domain driven simulations!");
 }
 
+void WavePortOperator::SetUpModeSources()
+{
+  // Ports which are congruent to a port with lower index (identical cross-section geometry,
+  // materials, and boundary conditions up to a rigid motion) map their boundary modes from
+  // that port instead of solving the eigenvalue problem.
+  bool first = true;
+  for (auto it = ports.begin(); it != ports.end(); ++it)
+  {
+    for (auto src = ports.begin(); src != it; ++src)
+    {
+      if (src->second.HasModeSource() || !it->second.SetModeSource(src->second))
+      {
+        continue;
+      }
+      if (first)
+      {
+        Mpi::Print("\nReusing boundary modes for congruent wave ports:\n");
+        first = false;
+      }
+      Mpi::Print(" Index = {:d}: Mapped from port {:d}\n", it->first, src->first);
+      break;
+    }
+  }
+}
+
+void WavePortOperator::SetUpModeGroups(const IoData &iodata, MPI_Comm comm)
+{
+  // Eigenvalue solves for ports on disjoint sets of processes already run concurrently. If
+  // any process owns elements of more than one port with an eigenvalue problem, the solves
+  // would instead be serialized on that process, so the eigenvalue problems are moved onto
+  // disjoint groups of processes, with each group solving for its ports in rounds.
+  std::vector<int> solve_idx;
+  int local_ports = 0;
+  for (const auto &[idx, data] : ports)
+  {
+    if (data.HasModeSource())
+    {
+      continue;
+    }
+    solve_idx.push_back(idx);
+    local_ports += data.HasLocalElements();
+  }
+  if (solve_idx.size() < 2)
+  {
+    return;
+  }
+  Mpi::GlobalMax(1, &local_ports, comm);
+  if (local_ports < 2)
+  {
+    return;
+  }
+  const int num_ports = static_cast<int>(solve_idx.size());
+  const int size = Mpi::Size(comm), rank = Mpi::Rank(comm);
+  const int num_groups = std::min(num_ports, size), group = (rank * num_groups) / size;
+  MPI_Comm group_comm;
+  MPI_Comm_split(comm, group, rank, &group_comm);
+  for (int k = 0; k < num_ports; k++)
+  {
+    auto &data = ports.at(solve_idx[k]);
+    data.Redistribute((k % num_groups == group) ? group_comm : MPI_COMM_NULL,
+                      k / num_groups, iodata.boundaries.waveport.at(solve_idx[k]),
+                      iodata.solver);
+  }
+  MPI_Comm_free(&group_comm);
+  Mpi::Print("\nDistributing boundary mode eigenvalue problems for {:d} wave ports on {:d} "
+             "process group{}\n",
+             num_ports, num_groups, (num_groups > 1) ? "s" : "");
+}
+
 void WavePortOperator::PrintBoundaryInfo(const IoData &iodata, const mfem::ParMesh &mesh)
 {
   // Print out BC info for all port attributes.
@@ -1220,6 +2322,16 @@ const WavePortData &WavePortOperator::GetPort(int idx) const
   return it->second;
 }
 
+void WavePortOperator::SetExcitationIndex(int idx)
+{
+  for (auto &[i, data] : ports)
+  {
+    data.excitation =
+        (idx < 0) ? std::binary_search(excitation_idx.begin(), excitation_idx.end(), i)
+                  : (i == idx);
+  }
+}
+
 mfem::Array<int> WavePortOperator::GetAttrList() const
 {
   mfem::Array<int> attr_list;
@@ -1253,9 +2365,36 @@ void WavePortOperator::Initialize(double omega)
         "\nCalculating boundary modes at wave ports for ω/2π = {:.3e} GHz ({:.3e})\n",
         omega * fc, omega);
   }
+  // The eigenvalue solves for ports on disjoint sets of processes run concurrently, since
+  // they only require communication within the port communicator. When ports share
+  // processes, the eigenvalue problems have been distributed onto disjoint groups of
+  // processes and are solved in rounds, so that each process only stores the system
+  // matrix for a single port at a time.
+  int num_rounds = 0;
+  for (const auto &[idx, data] : ports)
+  {
+    num_rounds = std::max(num_rounds, data.GetSolveRound() + 1);
+  }
+  for (int round = 0; round < num_rounds; round++)
+  {
+    for (auto &[idx, data] : ports)
+    {
+      if (data.GetSolveRound() == round)
+      {
+        data.AssembleMode(omega);
+      }
+    }
+    for (auto &[idx, data] : ports)
+    {
+      if (data.GetSolveRound() == round)
+      {
+        data.SolveMode();
+      }
+    }
+  }
   for (auto &[idx, data] : ports)
   {
-    data.Initialize(omega);
+    data.FinalizeMode();
     if (!suppress_output)
     {
       if (first)
@@ -1279,8 +2418,25 @@ void WavePortOperator::AddExtraSystemBdrCoefficients(double omega,
   // port mode at the given operating frequency (note only the real part of the propagation
   // constant contributes).
   Initialize(omega);
+  std::vector<std::complex<double>> kn;
+  kn.reserve(ports.size());
+  for (const auto &[idx, data] : ports)
+  {
+    kn.push_back(data.kn0);
+  }
+  AddExtraSystemBdrCoefficients(kn, fbr, fbi);
+}
+
+void WavePortOperator::AddExtraSystemBdrCoefficients(
+    const std::vector<std::complex<double>> &kn, MaterialPropertyCoefficient &fbr,
+    MaterialPropertyCoefficient &fbi)
+{
+  MFEM_VERIFY(kn.size() == ports.size(),
+              "Invalid number of propagation constants for wave port boundaries!");
+  auto it = kn.begin();
   for (const auto &[idx, data] : ports)
   {
+    const auto kn0 = *it++;
     if (!data.active)
     {
       continue;
@@ -1291,9 +2447,9 @@ void WavePortOperator::AddExtraSystemBdrCoefficients(double omega,
     muinv_func.RestrictCoefficient(mat_op.GetCeedBdrAttributes(data.GetAttrList()));
     // fbr.AddCoefficient(muinv_func.GetAttributeToMaterial(),
     //                    muinv_func.GetMaterialProperties(),
-    //                    -data.kn0.imag());
+    //                    -kn0.imag());
     fbi.AddCoefficient(muinv_func.GetAttributeToMaterial(),
-                       muinv_func.GetMaterialProperties(), data.kn0.real());
+                       muinv_func.GetMaterialProperties(), kn0.real());
   }
 }
 
@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 #include <mfem.hpp>
 #include "fem/fespace.hpp"
 #include "fem/gridfunction.hpp"
@@ -66,21 +67,123 @@ private:
 
   // Operator storage for repeated boundary mode eigenvalue problem solves.
   std::unique_ptr<mfem::HypreParMatrix> Atnr, Atni, Antr, Anti, Annr, Anni;
-  std::unique_ptr<ComplexOperator> opB;
+  std::unique_ptr<ComplexOperator> opA, opB;
   ComplexVector v0, e0;
 
+  // Frequency, eigenvalue, and whether the mode is interpolated, for the boundary mode
+  // computation in progress.
+  double omega1;
+  std::complex<double> lambda;
+  bool interp;
+
+  // Eigenvector (in the transformed variables) of the boundary mode from the last
+  // eigenvalue solve, used to warm-start the solve at the next frequency and optionally to
+  // track the mode by overlap.
+  ComplexVector e_prev;
+  bool has_prev, mode_tracking;
+
+  // Cached boundary mode solutions at previously computed frequencies (propagation constant
+  // and true dofs of the normalized fields [Eₜ, Eₙ]), used for interpolation or
+  // extrapolation within a relative frequency band. The number of cached solutions is
+  // limited.
+  double interp_tol;
+  std::map<double, std::pair<std::complex<double>, ComplexVector>> mode_cache;
+
   // Eigenvalue solver for boundary modes.
   MPI_Comm port_comm;
   int port_root;
   std::unique_ptr<EigenvalueSolver> eigen;
   std::unique_ptr<ComplexKspSolver> ksp;
 
+  // When the eigenvalue problem is redistributed onto a group of processes, the numbers of
+  // true dofs sent from this process to each process of the parent communicator (and
+  // received), the first row owned by this process after redistribution, and the global
+  // size of the eigenvalue problem. The round is the index of the group of concurrent
+  // eigenvalue solves this port belongs to.
+  bool redist;
+  std::vector<int> redist_send_counts, redist_recv_counts;
+  HYPRE_BigInt redist_first_row, redist_glob_size;
+  int solve_round;
+
   // Grid functions storing the last computed electric field mode on the port, and stored
   // objects for computing functions of the port modes for use as an excitation or in
   // postprocessing.
   std::unique_ptr<GridFunction> port_E0t, port_E0n, port_S0t, port_E;
   std::unique_ptr<mfem::LinearForm> port_sr, port_si;
 
+  // For a port which is congruent to another port (same cross-section geometry, materials,
+  // and boundary conditions up to a rigid motion), the boundary mode is mapped from the
+  // source port (not owned) instead of being computed. The rigid motion maps a point x on
+  // this port to c_src + R (x - c) on the source port, and each local element of this port
+  // is associated with an element of the serial source port mesh.
+  const WavePortData *mode_src;
+  mfem::DenseMatrix mode_R;
+  mfem::Vector mode_c, mode_c_src;
+  std::vector<int> mode_src_elems;
+
+  // Centroid, area, principal axes of the second moment of area (columns of the matrix,
+  // with the largest moment first and the normal last), and the in-plane moments, used for
+  // detecting congruent ports.
+  mfem::Vector port_c, port_I;
+  mfem::DenseMatrix port_axes;
+  double port_area;
+
+  // Serial copy of the port mesh and finite element spaces, gathered per-element data, and
+  // the serial boundary mode grid functions ([Eₜ, Eₙ] real and imaginary parts) when this
+  // port is the source for the modes of other ports. Elements of the serial mesh are
+  // sorted by their coordinate along the major principal axis for lookup.
+  std::unique_ptr<mfem::Mesh> serial_mesh;
+  std::unique_ptr<mfem::FiniteElementCollection> serial_nd_fec, serial_h1_fec;
+  std::unique_ptr<mfem::FiniteElementSpace> serial_nd_fespace, serial_h1_fespace;
+  std::vector<double> serial_elem_data;
+  std::vector<std::pair<double, int>> serial_elem_order;
+  std::vector<std::unique_ptr<mfem::GridFunction>> serial_E0;
+  bool serial_valid, mode_dependents;
+
+  // Communicator for the processes storing the serial copy of the port mesh (the root
+  // process and processes with elements of congruent ports).
+  MPI_Comm serial_comm;
+
+  // Construct the eigenvalue and linear solvers for the boundary mode eigenvalue problem on
+  // the port communicator.
+  void ConfigureSolver(const config::WavePortData &data, const config::SolverData &solver);
+
+  // Move a vector of eigenvalue problem true dofs to (forward) or from the group of
+  // processes solving the eigenvalue problem. Collective on the parent mesh communicator.
+  void RedistributeVector(const ComplexVector &x, ComplexVector &y, bool forward) const;
+
+  // Move the rows of an eigenvalue problem matrix to the group of processes solving the
+  // eigenvalue problem. Collective on the parent mesh communicator, and returns nullptr on
+  // processes outside of the group.
+  std::unique_ptr<mfem::HypreParMatrix>
+  RedistributeMatrix(const mfem::HypreParMatrix &A) const;
+
+  // Interpolate or extrapolate the boundary mode from cached solutions if possible (returns
+  // false if not), setting kn0 and the true dofs of [Eₜ, Eₙ] in e0.
+  bool InterpolateMode(double omega);
+
+  // Compute the centroid, area, and principal axes of the port cross-section.
+  void ComputePortFrame();
+
+  // Return the per-element data (centroid, number of Dirichlet BC dofs, and material
+  // properties of the neighboring domain element) for the local elements of the port.
+  std::vector<double> GetElementData() const;
+
+  // Construct the serial copy of the port mesh and gather the per-element data on the
+  // processes which require it (local is true). Returns false if the serial mesh element
+  // ordering does not match the gathered data. Collective on the parent mesh communicator.
+  bool SetUpSerialMesh(bool local);
+
+  // Gather the current boundary mode to the serial grid functions on the processes of the
+  // serial communicator.
+  void GatherSerialMode();
+
+  // Map the boundary mode from the source port onto this port.
+  void MapMode();
+
+  // Build the linear forms for the n x H coefficients and normalize the current mode.
+  void NormalizeMode();
+
 public:
   WavePortData(const config::WavePortData &data, const config::SolverData &solver,
                const MaterialOperator &mat_op, mfem::ParFiniteElementSpace &nd_fespace,
@@ -89,7 +192,40 @@ public:
 
   const auto &GetAttrList() const { return attr_list; }
 
+  // Check whether this port is congruent to the given port, and if so, map the boundary
+  // mode from the given port rather than computing it with an eigenvalue solve. Returns
+  // true if the mode will be mapped. Collective on the parent mesh communicator, and the
+  // modes of this port must be computed after those of the source port.
+  bool SetModeSource(WavePortData &src);
+  bool HasModeSource() const { return mode_src != nullptr; }
+
+  // Return the candidate rigid motion rotations mapping the principal axes (columns) of a
+  // port to those of a congruent port, up to the sign of each axis. Only proper rotations
+  // are returned.
+  static std::vector<mfem::DenseMatrix>
+  GetCongruentRotations(const mfem::DenseMatrix &axes, const mfem::DenseMatrix &axes_src);
+
+  // Solve the boundary mode eigenvalue problem on the given group of processes
+  // (MPI_COMM_NULL on processes outside of the group) instead of on the processes owning
+  // the port elements, in the given round of concurrent eigenvalue solves. Collective on
+  // the parent mesh communicator.
+  void Redistribute(MPI_Comm group_comm, int round, const config::WavePortData &data,
+                    const config::SolverData &solver);
+  int GetSolveRound() const { return solve_round; }
+  bool HasLocalElements() const
+  {
+    return port_nd_fespace->GetVSize() > 0 || port_h1_fespace->GetVSize() > 0;
+  }
+
+  // Compute the boundary mode at the given frequency. This is split into three steps so
+  // that the eigenvalue solves for several ports can proceed concurrently: construction of
+  // the eigenvalue problem operators (collective on the parent mesh communicator), the
+  // eigenvalue solve (collective only on the port communicator), and extraction and
+  // normalization of the mode (collective on the parent mesh communicator).
   void Initialize(double omega);
+  void AssembleMode(double omega);
+  void SolveMode();
+  void FinalizeMode();
 
   HYPRE_BigInt GlobalTrueNDSize() const { return port_nd_fespace->GlobalTrueVSize(); }
   HYPRE_BigInt GlobalTrueH1Size() const { return port_h1_fespace->GlobalTrueVSize(); }
@@ -131,6 +267,9 @@ private:
   // Mapping from port index to data structure containing port information.
   std::map<int, WavePortData> ports;
 
+  // Indices of the ports marked for excitation in the configuration file.
+  std::vector<int> excitation_idx;
+
   // Flag which forces no printing during WavePortData::Print().
   bool suppress_output;
   double fc, kc;
@@ -140,6 +279,13 @@ private:
                                mfem::ParFiniteElementSpace &h1_fespace);
   void PrintBoundaryInfo(const IoData &iodata, const mfem::ParMesh &mesh);
 
+  // Detect congruent ports for which the boundary modes can be mapped from another port.
+  void SetUpModeSources();
+
+  // Distribute the boundary mode eigenvalue problems onto disjoint groups of processes
+  // when ports share processes, so that the eigenvalue solves run concurrently.
+  void SetUpModeGroups(const IoData &iodata, MPI_Comm comm);
+
   // Compute boundary modes for all wave port boundaries at the specified frequency.
   void Initialize(double omega);
 
@@ -159,6 +305,13 @@ public:
   // Enable or suppress all outputs (log printing and fields to disk).
   void SetSuppressOutput(bool suppress) { suppress_output = suppress; }
 
+  // Return the indices of the ports marked for excitation in the configuration file.
+  const auto &GetExcitationIndices() const { return excitation_idx; }
+
+  // Restrict the excitation to the single port with the given index, or restore the
+  // excitations from the configuration file when idx < 0.
+  void SetExcitationIndex(int idx);
+
   // Returns array of wave port attributes.
   mfem::Array<int> GetAttrList() const;
 
@@ -166,6 +319,12 @@ public:
   void AddExtraSystemBdrCoefficients(double omega, MaterialPropertyCoefficient &fbr,
                                      MaterialPropertyCoefficient &fbi);
 
+  // Add contributions to system matrix from wave ports given the propagation constants of
+  // the port modes (for each port in order), without computing the boundary modes.
+  void AddExtraSystemBdrCoefficients(const std::vector<std::complex<double>> &kn,
+                                     MaterialPropertyCoefficient &fbr,
+                                     MaterialPropertyCoefficient &fbi);
+
   // Add contributions to the right-hand side source term vector for an incident field at
   // excited port boundaries.
   void AddExcitationBdrCoefficients(double omega, SumVectorCoefficient &fbr,
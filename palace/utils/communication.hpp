@@ -4,6 +4,7 @@
 #ifndef PALACE_UTILS_COMMUNICATION_HPP
 #define PALACE_UTILS_COMMUNICATION_HPP
 
+#include <algorithm>
 #include <complex>
 #include <fmt/color.h>
 #include <fmt/format.h>
@@ -372,6 +373,14 @@ public:
   // Return the global communicator.
   static MPI_Comm World() { return MPI_COMM_WORLD; }
 
+  // Return the level of thread support provided by the MPI library.
+  static int QueryThread()
+  {
+    int provided;
+    MPI_Query_thread(&provided);
+    return provided;
+  }
+
   // Default level of threading used in MPI_Init_thread unless provided to Init.
 #if defined(MFEM_USE_OPENMP)
   inline static int default_thread_required = MPI_THREAD_FUNNELED;
@@ -379,6 +388,11 @@ public:
   inline static int default_thread_required = MPI_THREAD_SINGLE;
 #endif
 
+  // Level of threading requested in MPI_Init_thread, if higher than the required level. The
+  // MPI library may provide less than this level, in which case functionality which relies
+  // on it (such as background field output) is disabled.
+  inline static int default_thread_requested = MPI_THREAD_SINGLE;
+
 private:
   // Prevent direct construction of objects of this class.
   Mpi() = default;
@@ -397,7 +411,7 @@ private:
     // implementations.
     MFEM_VERIFY(!IsInitialized(), "MPI should not be initialized more than once!");
     int provided;
-    MPI_Init_thread(argc, argv, requested, &provided);
+    MPI_Init_thread(argc, argv, std::max(requested, default_thread_requested), &provided);
     MFEM_VERIFY(provided >= requested,
                 "MPI could not provide the requested level of thread support!");
     // Initialize the singleton Instance.
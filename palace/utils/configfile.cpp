@@ -1083,7 +1083,9 @@ void PeriodicBoundaryData::SetUp(json &boundaries)
 PALACE_JSON_SERIALIZE_ENUM(WavePortData::EigenSolverType,
                            {{WavePortData::EigenSolverType::DEFAULT, "Default"},
                             {WavePortData::EigenSolverType::SLEPC, "SLEPc"},
-                            {WavePortData::EigenSolverType::ARPACK, "ARPACK"}})
+                            {WavePortData::EigenSolverType::ARPACK, "ARPACK"},
+                            {WavePortData::EigenSolverType::BLOCK_KRYLOV_SCHUR,
+                             "BlockKrylovSchur"}})
 
 void WavePortBoundaryData::SetUp(json &boundaries)
 {
@@ -1118,6 +1120,10 @@ void WavePortBoundaryData::SetUp(json &boundaries)
     data.ksp_tol = it->value("KSPTol", data.ksp_tol);
     data.eig_tol = it->value("EigenTol", data.eig_tol);
     data.verbose = it->value("Verbose", data.verbose);
+    data.mode_tracking = it->value("ModeTracking", data.mode_tracking);
+    data.interp_tol = it->value("InterpolationTol", data.interp_tol);
+    MFEM_VERIFY(data.interp_tol >= 0.0,
+                "\"WavePort\" boundary \"InterpolationTol\" must be non-negative!");
 
     // Cleanup
     it->erase("Index");
@@ -1131,6 +1137,8 @@ void WavePortBoundaryData::SetUp(json &boundaries)
     it->erase("KSPTol");
     it->erase("EigenTol");
     it->erase("Verbose");
+    it->erase("ModeTracking");
+    it->erase("InterpolationTol");
     MFEM_VERIFY(it->empty(),
                 "Found an unsupported configuration file keyword under \"WavePort\"!\n"
                     << it->dump(2));
@@ -1149,6 +1157,8 @@ void WavePortBoundaryData::SetUp(json &boundaries)
       std::cout << "KSPTol: " << data.ksp_tol << '\n';
       std::cout << "EigenTol: " << data.eig_tol << '\n';
       std::cout << "Verbose: " << data.verbose << '\n';
+      std::cout << "ModeTracking: " << data.mode_tracking << '\n';
+      std::cout << "InterpolationTol: " << data.interp_tol << '\n';
     }
   }
 }
@@ -1468,20 +1478,36 @@ void DrivenSolverData::SetUp(json &solver)
   max_f = driven->at("MaxFreq");     // Required
   delta_f = driven->at("FreqStep");  // Required
   delta_post = driven->value("SaveStep", delta_post);
+  estimator_step = driven->value("EstimatorStep", estimator_step);
   rst = driven->value("Restart", rst);
+  multi_excitation = driven->value("MultiExcitation", multi_excitation);
+  frequency_groups = driven->value("FrequencyGroups", frequency_groups);
+  MFEM_VERIFY(frequency_groups > 0,
+              "config[\"Driven\"][\"FrequencyGroups\"] must be positive!");
   adaptive_tol = driven->value("AdaptiveTol", adaptive_tol);
   adaptive_max_size = driven->value("AdaptiveMaxSamples", adaptive_max_size);
   adaptive_memory = driven->value("AdaptiveConvergenceMemory", adaptive_memory);
+  adaptive_batch_size = driven->value("AdaptiveBatchSize", adaptive_batch_size);
+  MFEM_VERIFY(adaptive_batch_size > 0,
+              "config[\"Driven\"][\"AdaptiveBatchSize\"] must be positive!");
+  adaptive_save_model = driven->value("AdaptiveSaveModel", adaptive_save_model);
+  adaptive_load_model = driven->value("AdaptiveLoadModel", adaptive_load_model);
 
   // Cleanup
   driven->erase("MinFreq");
   driven->erase("MaxFreq");
   driven->erase("FreqStep");
   driven->erase("SaveStep");
+  driven->erase("EstimatorStep");
   driven->erase("Restart");
+  driven->erase("MultiExcitation");
+  driven->erase("FrequencyGroups");
   driven->erase("AdaptiveTol");
   driven->erase("AdaptiveMaxSamples");
   driven->erase("AdaptiveConvergenceMemory");
+  driven->erase("AdaptiveBatchSize");
+  driven->erase("AdaptiveSaveModel");
+  driven->erase("AdaptiveLoadModel");
   MFEM_VERIFY(driven->empty(),
               "Found an unsupported configuration file keyword under \"Driven\"!\n"
                   << driven->dump(2));
@@ -1493,13 +1519,28 @@ void DrivenSolverData::SetUp(json &solver)
     std::cout << "MaxFreq: " << max_f << '\n';
     std::cout << "FreqStep: " << delta_f << '\n';
     std::cout << "SaveStep: " << delta_post << '\n';
+    std::cout << "EstimatorStep: " << estimator_step << '\n';
     std::cout << "Restart: " << rst << '\n';
+    std::cout << "MultiExcitation: " << multi_excitation << '\n';
+    std::cout << "FrequencyGroups: " << frequency_groups << '\n';
     std::cout << "AdaptiveTol: " << adaptive_tol << '\n';
     std::cout << "AdaptiveMaxSamples: " << adaptive_max_size << '\n';
     std::cout << "AdaptiveConvergenceMemory: " << adaptive_memory << '\n';
+    std::cout << "AdaptiveBatchSize: " << adaptive_batch_size << '\n';
+    std::cout << "AdaptiveSaveModel: " << adaptive_save_model << '\n';
+    std::cout << "AdaptiveLoadModel: " << adaptive_load_model << '\n';
   }
 }
 
+// Helper for converting string keys to enum for EigenSolverData::Type.
+PALACE_JSON_SERIALIZE_ENUM(EigenSolverData::Type,
+                           {{EigenSolverData::Type::DEFAULT, "Default"},
+                            {EigenSolverData::Type::SLEPC, "SLEPc"},
+                            {EigenSolverData::Type::ARPACK, "ARPACK"},
+                            {EigenSolverData::Type::BLOCK_KRYLOV_SCHUR,
+                             "BlockKrylovSchur"},
+                            {EigenSolverData::Type::CONTOUR, "Contour"}})
+
 void EigenSolverData::SetUp(json &solver)
 {
   auto eigenmode = solver.find("Eigenmode");
@@ -1518,10 +1559,43 @@ void EigenSolverData::SetUp(json &solver)
   n_post = eigenmode->value("Save", n_post);
   type = eigenmode->value("Type", type);
   pep_linear = eigenmode->value("PEPLinear", pep_linear);
+  block_size = eigenmode->value("BlockSize", block_size);
+  checkpoint_it = eigenmode->value("CheckpointInterval", checkpoint_it);
+  checkpoint_restart = eigenmode->value("CheckpointRestart", checkpoint_restart);
   scale = eigenmode->value("Scaling", scale);
   init_v0 = eigenmode->value("StartVector", init_v0);
   init_v0_const = eigenmode->value("StartVectorConstant", init_v0_const);
   mass_orthog = eigenmode->value("MassOrthogonal", mass_orthog);
+  n_slices = eigenmode->value("Slices", n_slices);
+  slice_target_upper = eigenmode->value("SliceTargetUpper", slice_target_upper);
+  contour_target_upper = eigenmode->value("ContourTargetUpper", contour_target_upper);
+  contour_aspect_ratio = eigenmode->value("ContourAspectRatio", contour_aspect_ratio);
+  contour_n_points = eigenmode->value("ContourNPoints", contour_n_points);
+  contour_moments = eigenmode->value("ContourMoments", contour_moments);
+  contour_groups = eigenmode->value("ContourGroups", contour_groups);
+  MFEM_VERIFY(block_size > 0, "Eigenmode solver \"BlockSize\" must be positive!");
+  MFEM_VERIFY(checkpoint_it >= 0,
+              "Eigenmode solver \"CheckpointInterval\" must be nonnegative!");
+  MFEM_VERIFY(n_slices > 0, "Eigenmode solver \"Slices\" must be positive!");
+  MFEM_VERIFY(n_slices == 1 || slice_target_upper > target,
+              "Eigenmode solver \"SliceTargetUpper\" must be greater than \"Target\" for "
+              "spectrum slicing!");
+  if (type == Type::CONTOUR)
+  {
+    MFEM_VERIFY(contour_target_upper > target,
+                "Eigenmode solver \"ContourTargetUpper\" must be greater than \"Target\" "
+                "for the contour integral eigensolver!");
+    MFEM_VERIFY(contour_aspect_ratio > 0.0,
+                "Eigenmode solver \"ContourAspectRatio\" must be positive!");
+    MFEM_VERIFY(contour_n_points > 0 && contour_moments > 0,
+                "Eigenmode solver \"ContourNPoints\" and \"ContourMoments\" must be "
+                "positive!");
+    MFEM_VERIFY(contour_groups > 0 && contour_groups <= contour_n_points,
+                "Eigenmode solver \"ContourGroups\" must be positive and no greater than "
+                "\"ContourNPoints\"!");
+    MFEM_VERIFY(n_slices == 1, "Spectrum slicing is not supported with the contour "
+                               "integral eigensolver!");
+  }
 
   // Cleanup
   eigenmode->erase("Target");
@@ -1532,10 +1606,20 @@ void EigenSolverData::SetUp(json &solver)
   eigenmode->erase("Save");
   eigenmode->erase("Type");
   eigenmode->erase("PEPLinear");
+  eigenmode->erase("BlockSize");
+  eigenmode->erase("CheckpointInterval");
+  eigenmode->erase("CheckpointRestart");
   eigenmode->erase("Scaling");
   eigenmode->erase("StartVector");
   eigenmode->erase("StartVectorConstant");
   eigenmode->erase("MassOrthogonal");
+  eigenmode->erase("Slices");
+  eigenmode->erase("SliceTargetUpper");
+  eigenmode->erase("ContourTargetUpper");
+  eigenmode->erase("ContourAspectRatio");
+  eigenmode->erase("ContourNPoints");
+  eigenmode->erase("ContourMoments");
+  eigenmode->erase("ContourGroups");
   MFEM_VERIFY(eigenmode->empty(),
               "Found an unsupported configuration file keyword under \"Eigenmode\"!\n"
                   << eigenmode->dump(2));
@@ -1551,10 +1635,20 @@ void EigenSolverData::SetUp(json &solver)
     std::cout << "Save: " << n_post << '\n';
     std::cout << "Type: " << type << '\n';
     std::cout << "PEPLinear: " << pep_linear << '\n';
+    std::cout << "BlockSize: " << block_size << '\n';
+    std::cout << "CheckpointInterval: " << checkpoint_it << '\n';
+    std::cout << "CheckpointRestart: " << checkpoint_restart << '\n';
     std::cout << "Scaling: " << scale << '\n';
     std::cout << "StartVector: " << init_v0 << '\n';
     std::cout << "StartVectorConstant: " << init_v0_const << '\n';
     std::cout << "MassOrthogonal: " << mass_orthog << '\n';
+    std::cout << "Slices: " << n_slices << '\n';
+    std::cout << "SliceTargetUpper: " << slice_target_upper << '\n';
+    std::cout << "ContourTargetUpper: " << contour_target_upper << '\n';
+    std::cout << "ContourAspectRatio: " << contour_aspect_ratio << '\n';
+    std::cout << "ContourNPoints: " << contour_n_points << '\n';
+    std::cout << "ContourMoments: " << contour_moments << '\n';
+    std::cout << "ContourGroups: " << contour_groups << '\n';
   }
 }
 
@@ -1708,10 +1802,14 @@ PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::Type,
                             {LinearSolverData::Type::AMS, "AMS"},
                             {LinearSolverData::Type::BOOMER_AMG, "BoomerAMG"},
                             {LinearSolverData::Type::MUMPS, "MUMPS"},
+                            {LinearSolverData::Type::MUMPS_MP, "MUMPS-MP"},
                             {LinearSolverData::Type::SUPERLU, "SuperLU"},
+                            {LinearSolverData::Type::SUPERLU_MP, "SuperLU-MP"},
                             {LinearSolverData::Type::STRUMPACK, "STRUMPACK"},
                             {LinearSolverData::Type::STRUMPACK_MP, "STRUMPACK-MP"},
-                            {LinearSolverData::Type::JACOBI, "Jacobi"}})
+                            {LinearSolverData::Type::RAS, "RAS"},
+                            {LinearSolverData::Type::JACOBI, "Jacobi"},
+                            {LinearSolverData::Type::GMRES_POLY, "GMRESPolynomial"}})
 PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::KspType,
                            {{LinearSolverData::KspType::DEFAULT, "Default"},
                             {LinearSolverData::KspType::CG, "CG"},
@@ -1763,6 +1861,9 @@ void LinearSolverData::SetUp(json &solver)
   max_it = linear->value("MaxIts", max_it);
   max_size = linear->value("MaxSize", max_size);
   initial_guess = linear->value("InitialGuess", initial_guess);
+  initial_guess_history = linear->value("InitialGuessHistory", initial_guess_history);
+  MFEM_VERIFY(initial_guess_history >= 0,
+              "config[\"Linear\"][\"InitialGuessHistory\"] must be non-negative!");
 
   // Options related to multigrid.
   mg_max_levels = linear->value("MGMaxLevels", mg_max_levels);
@@ -1775,11 +1876,14 @@ void LinearSolverData::SetUp(json &solver)
   mg_smooth_sf_max = linear->value("MGSmoothEigScaleMax", mg_smooth_sf_max);
   mg_smooth_sf_min = linear->value("MGSmoothEigScaleMin", mg_smooth_sf_min);
   mg_smooth_cheby_4th = linear->value("MGSmoothChebyshev4th", mg_smooth_cheby_4th);
+  mg_smooth_gs = linear->value("MGSmoothGaussSeidel", mg_smooth_gs);
+  mg_smooth_gmres_poly = linear->value("MGSmoothGMRESPolynomial", mg_smooth_gmres_poly);
 
   // Preconditioner-specific options.
   pc_mat_real = linear->value("PCMatReal", pc_mat_real);
   pc_mat_shifted = linear->value("PCMatShifted", pc_mat_shifted);
   pc_side_type = linear->value("PCSide", pc_side_type);
+  pc_reuse_tol = linear->value("PCReuseTol", pc_reuse_tol);
   sym_fact_type = linear->value("ColumnOrdering", sym_fact_type);
   strumpack_compression_type =
       linear->value("STRUMPACKCompressionType", strumpack_compression_type);
@@ -1788,6 +1892,9 @@ void LinearSolverData::SetUp(json &solver)
       linear->value("STRUMPACKLossyPrecision", strumpack_lossy_precision);
   strumpack_butterfly_l = linear->value("STRUMPACKButterflyLevels", strumpack_butterfly_l);
   superlu_3d = linear->value("SuperLU3DCommunicator", superlu_3d);
+  ras_overlap = linear->value("RASOverlap", ras_overlap);
+  ras_interface_shift = linear->value("RASInterfaceShift", ras_interface_shift);
+  gmres_poly_order = linear->value("GMRESPolynomialOrder", gmres_poly_order);
   ams_vector_interp = linear->value("AMSVectorInterpolation", ams_vector_interp);
   ams_singular_op = linear->value("AMSSingularOperator", ams_singular_op);
   amg_agg_coarsen = linear->value("AMGAggressiveCoarsening", amg_agg_coarsen);
@@ -1807,6 +1914,7 @@ void LinearSolverData::SetUp(json &solver)
   linear->erase("MaxIts");
   linear->erase("MaxSize");
   linear->erase("InitialGuess");
+  linear->erase("InitialGuessHistory");
 
   linear->erase("MGMaxLevels");
   linear->erase("MGCoarsenType");
@@ -1818,16 +1926,22 @@ void LinearSolverData::SetUp(json &solver)
   linear->erase("MGSmoothEigScaleMax");
   linear->erase("MGSmoothEigScaleMin");
   linear->erase("MGSmoothChebyshev4th");
+  linear->erase("MGSmoothGaussSeidel");
+  linear->erase("MGSmoothGMRESPolynomial");
 
   linear->erase("PCMatReal");
   linear->erase("PCMatShifted");
   linear->erase("PCSide");
+  linear->erase("PCReuseTol");
   linear->erase("ColumnOrdering");
   linear->erase("STRUMPACKCompressionType");
   linear->erase("STRUMPACKCompressionTol");
   linear->erase("STRUMPACKLossyPrecision");
   linear->erase("STRUMPACKButterflyLevels");
   linear->erase("SuperLU3DCommunicator");
+  linear->erase("RASOverlap");
+  linear->erase("RASInterfaceShift");
+  linear->erase("GMRESPolynomialOrder");
   linear->erase("AMSVectorInterpolation");
   linear->erase("AMSSingularOperator");
   linear->erase("AMGAggressiveCoarsening");
@@ -1851,6 +1965,7 @@ void LinearSolverData::SetUp(json &solver)
     std::cout << "MaxIts: " << max_it << '\n';
     std::cout << "MaxSize: " << max_size << '\n';
     std::cout << "InitialGuess: " << initial_guess << '\n';
+    std::cout << "InitialGuessHistory: " << initial_guess_history << '\n';
 
     std::cout << "MGMaxLevels: " << mg_max_levels << '\n';
     std::cout << "MGCoarsenType: " << mg_coarsen_type << '\n';
@@ -1862,16 +1977,22 @@ void LinearSolverData::SetUp(json &solver)
     std::cout << "MGSmoothEigScaleMax: " << mg_smooth_sf_max << '\n';
     std::cout << "MGSmoothEigScaleMin: " << mg_smooth_sf_min << '\n';
     std::cout << "MGSmoothChebyshev4th: " << mg_smooth_cheby_4th << '\n';
+    std::cout << "MGSmoothGaussSeidel: " << mg_smooth_gs << '\n';
+    std::cout << "MGSmoothGMRESPolynomial: " << mg_smooth_gmres_poly << '\n';
 
     std::cout << "PCMatReal: " << pc_mat_real << '\n';
     std::cout << "PCMatShifted: " << pc_mat_shifted << '\n';
     std::cout << "PCSide: " << pc_side_type << '\n';
+    std::cout << "PCReuseTol: " << pc_reuse_tol << '\n';
     std::cout << "ColumnOrdering: " << sym_fact_type << '\n';
     std::cout << "STRUMPACKCompressionType: " << strumpack_compression_type << '\n';
     std::cout << "STRUMPACKCompressionTol: " << strumpack_lr_tol << '\n';
     std::cout << "STRUMPACKLossyPrecision: " << strumpack_lossy_precision << '\n';
     std::cout << "STRUMPACKButterflyLevels: " << strumpack_butterfly_l << '\n';
     std::cout << "SuperLU3DCommunicator: " << superlu_3d << '\n';
+    std::cout << "RASOverlap: " << ras_overlap << '\n';
+    std::cout << "RASInterfaceShift: " << ras_interface_shift << '\n';
+    std::cout << "GMRESPolynomialOrder: " << gmres_poly_order << '\n';
     std::cout << "AMSVectorInterpolation: " << ams_vector_interp << '\n';
     std::cout << "AMSSingularOperator: " << ams_singular_op << '\n';
     std::cout << "AMGAggressiveCoarsening: " << amg_agg_coarsen << '\n';
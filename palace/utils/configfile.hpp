@@ -498,7 +498,8 @@ public:
   {
     DEFAULT,
     SLEPC,
-    ARPACK
+    ARPACK,
+    BLOCK_KRYLOV_SCHUR
   };
   EigenSolverType eigen_type = EigenSolverType::DEFAULT;
 
@@ -522,6 +523,14 @@ public:
 
   // Print level for linear and eigenvalue solvers.
   int verbose = 0;
+
+  // Track the boundary mode between frequencies by its overlap with the previously computed
+  // mode, rather than by the mode index.
+  bool mode_tracking = false;
+
+  // Relative frequency band within which the boundary mode is interpolated from previously
+  // computed solutions rather than solving the eigenvalue problem (0 to disable).
+  double interp_tol = 0.0;
 };
 
 struct WavePortBoundaryData : public internal::DataMap<WavePortData>
@@ -659,9 +668,20 @@ public:
   // Step increment for saving fields to disk.
   int delta_post = 0;
 
+  // Step increment for computing error estimates (0 to disable, -1 for automatic).
+  int estimator_step = -1;
+
   // Restart iteration for a partial sweep.
   int rst = 1;
 
+  // Solve separately for each port marked for excitation, computing the full S-matrix
+  // rather than the single column for one excited port.
+  bool multi_excitation = false;
+
+  // Number of process groups over which the frequencies of a uniform sweep, or the
+  // full-order solves of each batch of the adaptive sweep offline phase, are distributed.
+  int frequency_groups = 1;
+
   // Error tolerance for enabling adaptive frequency sweep.
   double adaptive_tol = 0.0;
 
@@ -671,6 +691,15 @@ public:
   // Memory required for adaptive sampling convergence.
   int adaptive_memory = 2;
 
+  // Number of frequency samples added to the reduced-order model per greedy iteration of
+  // the adaptive frequency sweep.
+  int adaptive_batch_size = 1;
+
+  // Write the reduced-order model constructed during the adaptive frequency sweep to disk,
+  // or load a previously saved model from the given directory and skip the offline phase.
+  bool adaptive_save_model = false;
+  std::string adaptive_load_model = "";
+
   void SetUp(json &solver);
 };
 
@@ -707,13 +736,46 @@ public:
   bool mass_orthog = false;
 
   // Eigenvalue solver type.
-  using Type = WavePortData::EigenSolverType;
+  enum class Type
+  {
+    DEFAULT,
+    SLEPC,
+    ARPACK,
+    BLOCK_KRYLOV_SCHUR,
+    CONTOUR
+  };
   Type type = Type::DEFAULT;
 
   // For SLEPc eigenvalue solver, use linearized formulation for quadratic eigenvalue
   // problems.
   bool pep_linear = true;
 
+  // For the native block Krylov-Schur eigenvalue solver, number of vectors in each block of
+  // the subspace expansion.
+  int block_size = 4;
+
+  // For the native block Krylov-Schur eigenvalue solver, number of restarts between
+  // checkpoints of the solver state to disk (0 to disable), and whether to resume from an
+  // existing checkpoint.
+  int checkpoint_it = 0;
+  bool checkpoint_restart = false;
+
+  // Number of spectrum slices, and upper end of the frequency band [GHz], for spectrum
+  // slicing. The band is split into intervals which are solved concurrently on disjoint
+  // groups of processes.
+  int n_slices = 1;
+  double slice_target_upper = 0.0;
+
+  // For the contour integral eigenvalue solver, upper end of the frequency window [GHz],
+  // ratio of the imaginary to real semi-axis of the elliptical contour, number of
+  // quadrature points and moments, and number of process groups over which the quadrature
+  // point solves are distributed.
+  double contour_target_upper = 0.0;
+  double contour_aspect_ratio = 1.0;
+  int contour_n_points = 16;
+  int contour_moments = 4;
+  int contour_groups = 1;
+
   void SetUp(json &solver);
 };
 
@@ -796,10 +858,14 @@ public:
     AMS,
     BOOMER_AMG,
     MUMPS,
+    MUMPS_MP,
     SUPERLU,
+    SUPERLU_MP,
     STRUMPACK,
     STRUMPACK_MP,
-    JACOBI
+    RAS,
+    JACOBI,
+    GMRES_POLY
   };
   Type type = Type::DEFAULT;
 
@@ -827,6 +893,10 @@ public:
   // Reuse previous solution as initial guess for Krylov solvers.
   int initial_guess = -1;
 
+  // Number of previous solutions used to compute a projection-based initial guess for
+  // Krylov solvers in sequences of related linear systems (0 to disable).
+  int initial_guess_history = 0;
+
   // Maximum number of levels for geometric multigrid (set to 1 to disable multigrid).
   int mg_max_levels = 100;
 
@@ -865,6 +935,15 @@ public:
   // use standard 1st-kind polynomials.
   bool mg_smooth_cheby_4th = true;
 
+  // Use symmetric Gauss-Seidel smoothing for geometric multigrid levels with assembled
+  // operators (Chebyshev smoothing is still used for partially assembled levels).
+  bool mg_smooth_gs = false;
+
+  // Smooth using GMRES polynomials for geometric multigrid, instead of Chebyshev
+  // polynomials (does not require eigenvalue estimates, suitable for non-symmetric
+  // operators).
+  bool mg_smooth_gmres_poly = false;
+
   // For frequency domain applications, precondition linear systems with a real-valued
   // approximation to the system matrix.
   bool pc_mat_real = false;
@@ -882,6 +961,12 @@ public:
   };
   SideType pc_side_type = SideType::DEFAULT;
 
+  // For frequency domain applications, reuse the existing preconditioner (for example a
+  // sparse direct factorization) for all frequencies within this relative distance of the
+  // frequency at which it was constructed, relying on the Krylov solver for iterative
+  // refinement. A value of zero reconstructs the preconditioner at every frequency.
+  double pc_reuse_tol = 0.0;
+
   // Specify details for the column ordering method in the symbolic factorization for sparse
   // direct solvers.
   enum class SymFactType
@@ -917,6 +1002,15 @@ public:
   // Option to enable 3D process grid for SuperLU_DIST solver.
   bool superlu_3d = false;
 
+  // Number of layers of overlap between subdomains and scaling coefficient for the
+  // diagonal shift replacing the dropped couplings on the subdomain boundaries for the RAS
+  // preconditioner.
+  int ras_overlap = 1;
+  double ras_interface_shift = 1.0;
+
+  // Polynomial degree for the GMRES polynomial preconditioner.
+  int gmres_poly_order = 20;
+
   // Option to use vector or scalar Pi-space corrections for the AMS preconditioner.
   bool ams_vector_interp = false;
 
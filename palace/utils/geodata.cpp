@@ -11,6 +11,7 @@
 #include <random>
 #include <sstream>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -68,13 +69,23 @@ std::unique_ptr<int[]> GetMeshPartitioning(const mfem::Mesh &, int,
 
 // Given a serial mesh on the root processor and element partitioning, create a parallel
 // mesh over the given communicator. The serial mesh is destroyed when no longer needed.
+// Optionally skip marking the mesh for refinement, which preserves the element vertex
+// ordering of the serial mesh.
 std::unique_ptr<mfem::ParMesh> DistributeMesh(MPI_Comm, std::unique_ptr<mfem::Mesh> &,
-                                              const int *, const std::string & = "");
+                                              const int *, const std::string & = "",
+                                              bool = true);
 
 // Rebalance a conformal mesh across processor ranks, using the MeshPartitioner. Gathers the
 // mesh onto the root rank before scattering the partitioned mesh.
 void RebalanceConformalMesh(std::unique_ptr<mfem::ParMesh> &);
 
+// Given two hierarchies of uniformly refined meshes over different communicators, with the
+// global indices in the first of the coarsest elements of the second, compute the global
+// indices in the first finest mesh of the second finest mesh elements.
+std::vector<int> MapRefinedElements(const std::vector<const mfem::ParMesh *> &,
+                                    const std::vector<std::unique_ptr<mfem::ParMesh>> &,
+                                    const std::vector<int> &);
+
 }  // namespace
 
 namespace mesh
@@ -1716,6 +1727,143 @@ double RebalanceMesh(std::unique_ptr<mfem::ParMesh> &mesh, const IoData &iodata)
   return ratio;
 }
 
+std::unique_ptr<mfem::ParMesh> RedistributeMesh(const mfem::ParMesh &mesh, MPI_Comm comm,
+                                                std::vector<int> &elem_map)
+{
+  BlockTimer bt0(Timer::REBALANCE);
+  MFEM_VERIFY(!mesh.Nonconforming(),
+              "Mesh redistribution is only supported for conforming meshes!");
+  MPI_Comm orig_comm = mesh.GetComm();
+  MFEM_VERIFY(!Mpi::Root(orig_comm) || Mpi::Root(comm),
+              "Mesh redistribution requires the original root process to be the root of "
+              "the new communicator!");
+
+  // Gather the serial mesh on the root of the original communicator, and send it as a
+  // string to the root process of each new communicator.
+  std::string so;
+  {
+    mfem::Mesh smesh = mesh.GetSerialMesh(0);
+    if (Mpi::Root(orig_comm))
+    {
+      std::ostringstream fo(std::stringstream::out);
+      // fo << std::fixed;
+      fo << std::scientific;
+      fo.precision(MSH_FLT_PRECISION);
+      smesh.Print(fo);
+      so = fo.str();
+    }
+  }
+  MPI_Comm root_comm;
+  MPI_Comm_split(orig_comm, Mpi::Root(comm) ? 0 : MPI_UNDEFINED, Mpi::Rank(orig_comm),
+                 &root_comm);
+  if (root_comm != MPI_COMM_NULL)
+  {
+    int slen = static_cast<int>(so.length());
+    MFEM_VERIFY(so.length() == (std::size_t)slen,
+                "Overflow error redistributing parallel mesh!");
+    Mpi::Broadcast(1, &slen, 0, root_comm);
+    so.resize(slen);
+    MPI_Bcast(so.data(), slen, MPI_CHAR, 0, root_comm);
+    MPI_Comm_free(&root_comm);
+  }
+
+  // Partition the serial mesh on the root of the new communicator and distribute. The mesh
+  // is not marked for refinement again, in order to preserve the element vertex ordering.
+  constexpr bool generate_edges = false, refine = false, fix_orientation = false;
+  std::unique_ptr<mfem::Mesh> smesh;
+  std::unique_ptr<int[]> partitioning;
+  int ne = 0;
+  if (Mpi::Root(comm))
+  {
+    std::istringstream fi(so);
+    smesh = std::make_unique<mfem::Mesh>(fi, generate_edges, refine, fix_orientation);
+    std::string().swap(so);
+    partitioning = GetMeshPartitioning(*smesh, Mpi::Size(comm), "", false);
+    ne = smesh->GetNE();
+  }
+  Mpi::Broadcast(1, &ne, 0, comm);
+  if (!Mpi::Root(comm))
+  {
+    partitioning = std::make_unique<int[]>(ne);
+  }
+  Mpi::Broadcast(ne, partitioning.get(), 0, comm);
+  elem_map.clear();
+  for (int i = 0; i < ne; i++)
+  {
+    if (partitioning[i] == Mpi::Rank(comm))
+    {
+      elem_map.push_back(i);
+    }
+  }
+  return DistributeMesh(comm, smesh, partitioning.get(), "", refine);
+}
+
+std::vector<std::unique_ptr<mfem::ParMesh>>
+RedistributeMesh(const std::vector<const mfem::ParMesh *> &mesh, MPI_Comm comm,
+                 std::vector<int> &elem_map)
+{
+  MFEM_VERIFY(!mesh.empty(), "Mesh redistribution requires a nonempty mesh hierarchy!");
+  MPI_Comm orig_comm = mesh.back()->GetComm();
+  std::vector<std::unique_ptr<mfem::ParMesh>> new_mesh;
+
+  // Every element of each coarser mesh must be refined for the hierarchy to be a sequence
+  // of uniform refinements (region-based refinement leaves some elements unrefined).
+  bool uniform = true;
+  for (std::size_t l = 1; l < mesh.size() && uniform; l++)
+  {
+    if (mesh[l]->GetLastOperation() != mfem::Mesh::REFINE || mesh[l]->Nonconforming())
+    {
+      uniform = false;
+      break;
+    }
+    const auto &embeddings = mesh[l]->GetRefinementTransforms().embeddings;
+    std::vector<int> num_children(mesh[l - 1]->GetNE(), 0);
+    for (int i = 0; i < embeddings.Size(); i++)
+    {
+      num_children[embeddings[i].parent]++;
+    }
+    uniform = std::all_of(num_children.begin(), num_children.end(),
+                          [](int n) { return n > 1; });
+  }
+  Mpi::GlobalAnd(1, &uniform, orig_comm);
+  if (uniform && mesh.size() > 1)
+  {
+    std::vector<int> coarse_map;
+    new_mesh.push_back(RedistributeMesh(*mesh[0], comm, coarse_map));
+    for (std::size_t l = 1; l < mesh.size(); l++)
+    {
+      new_mesh.push_back(std::make_unique<mfem::ParMesh>(*new_mesh.back()));
+      new_mesh.back()->UniformRefinement();
+    }
+
+    // Bisection-based refinement of every element is not reproduced by uniform
+    // refinement, so also check the number of elements on each level.
+    std::vector<long long int> ne(mesh.size()), new_ne(mesh.size());
+    for (std::size_t l = 0; l < mesh.size(); l++)
+    {
+      ne[l] = mesh[l]->GetNE();
+      new_ne[l] = new_mesh[l]->GetNE();
+    }
+    Mpi::GlobalSum(static_cast<int>(ne.size()), ne.data(), orig_comm);
+    Mpi::GlobalSum(static_cast<int>(new_ne.size()), new_ne.data(), comm);
+    uniform = (ne == new_ne);
+    Mpi::GlobalAnd(1, &uniform, orig_comm);
+    if (uniform)
+    {
+      elem_map = MapRefinedElements(mesh, new_mesh, coarse_map);
+      return new_mesh;
+    }
+    new_mesh.clear();
+  }
+  if (mesh.size() > 1)
+  {
+    Mpi::Warning(orig_comm, "Mesh hierarchy is not obtained by uniform refinement, only "
+                            "the finest mesh is redistributed!\n");
+  }
+  new_mesh.push_back(RedistributeMesh(*mesh.back(), comm, elem_map));
+  return new_mesh;
+}
+
 }  // namespace mesh
 
 namespace
@@ -3202,14 +3350,14 @@ std::unique_ptr<int[]> GetMeshPartitioning(const mfem::Mesh &mesh, int size,
 std::unique_ptr<mfem::ParMesh> DistributeMesh(MPI_Comm comm,
                                               std::unique_ptr<mfem::Mesh> &smesh,
                                               const int *partitioning,
-                                              const std::string &output_dir)
+                                              const std::string &output_dir, bool refine)
 {
   // Take a serial mesh and partitioning on the root process and construct the global
   // parallel mesh. For now, prefer the MPI-based version to the file IO one. When
   // constructing the ParMesh, we mark for refinement since refinement flags are not copied
   // from the serial mesh. Beware that mfem::ParMesh constructor argument order is not the
   // same as mfem::Mesh! Each processor's component gets sent as a byte string.
-  constexpr bool generate_edges = false, refine = true, fix_orientation = false;
+  constexpr bool generate_edges = false, fix_orientation = false;
   std::unique_ptr<mfem::ParMesh> pmesh;
   if (Mpi::Root(comm))
   {
@@ -3306,6 +3454,133 @@ void RebalanceConformalMesh(std::unique_ptr<mfem::ParMesh> &pmesh)
   pmesh = DistributeMesh(comm, smesh, partitioning.get());
 }
 
+std::vector<int>
+MapRefinedElements(const std::vector<const mfem::ParMesh *> &mesh,
+                   const std::vector<std::unique_ptr<mfem::ParMesh>> &new_mesh,
+                   const std::vector<int> &coarse_map)
+{
+  // Identify each element of the finest mesh by the global index of its ancestor in the
+  // coarsest mesh and the sequence of child indices from the refinement embeddings, which
+  // are the same for both hierarchies since the element vertex ordering is preserved.
+  constexpr int max_children = 64;
+  MFEM_VERIFY(mesh.size() <= 10,
+              "Too many uniform refinement levels for mesh element mapping!");
+  auto GetAncestry = [](auto &&GetMesh, std::size_t levels, std::vector<int> ancestor)
+  {
+    std::vector<long long int> path(ancestor.size(), 0);
+    for (std::size_t l = 1; l < levels; l++)
+    {
+      const auto &embeddings = GetMesh(l).GetRefinementTransforms().embeddings;
+      std::vector<int> new_ancestor(embeddings.Size());
+      std::vector<long long int> new_path(embeddings.Size());
+      for (int i = 0; i < embeddings.Size(); i++)
+      {
+        const int matrix = static_cast<int>(embeddings[i].matrix);
+        MFEM_VERIFY(matrix < max_children,
+                    "Unexpected number of children for mesh element mapping!");
+        new_ancestor[i] = ancestor[embeddings[i].parent];
+        new_path[i] = path[embeddings[i].parent] * max_children + matrix;
+      }
+      ancestor = std::move(new_ancestor);
+      path = std::move(new_path);
+    }
+    return std::make_pair(std::move(ancestor), std::move(path));
+  };
+
+  // Global element offsets of the coarsest and finest original meshes. Uniform refinement
+  // is local, so each original finest element is owned by the owner of its ancestor.
+  MPI_Comm comm = mesh.back()->GetComm();
+  const int size = Mpi::Size(comm), rank = Mpi::Rank(comm);
+  std::vector<int> coarse_offsets(size + 1, 0), fine_offsets(size + 1, 0);
+  {
+    const int ne[2] = {mesh.front()->GetNE(), mesh.back()->GetNE()};
+    std::vector<int> recv(2 * size);
+    MPI_Allgather(ne, 2, MPI_INT, recv.data(), 2, MPI_INT, comm);
+    for (int p = 0; p < size; p++)
+    {
+      coarse_offsets[p + 1] = coarse_offsets[p] + recv[2 * p];
+      fine_offsets[p + 1] = fine_offsets[p] + recv[2 * p + 1];
+    }
+  }
+  std::vector<int> coarse_idx(mesh.front()->GetNE());
+  std::iota(coarse_idx.begin(), coarse_idx.end(), coarse_offsets[rank]);
+  const auto orig_keys =
+      GetAncestry([&mesh](std::size_t l) -> const mfem::ParMesh & { return *mesh[l]; },
+                  mesh.size(), std::move(coarse_idx));
+  const auto new_keys = GetAncestry(
+      [&new_mesh](std::size_t l) -> const mfem::ParMesh & { return *new_mesh[l]; },
+      new_mesh.size(), coarse_map);
+  const auto &ancestor = orig_keys.first, &path = orig_keys.second;
+  const auto &new_ancestor = new_keys.first, &new_path = new_keys.second;
+
+  // Send the keys of the new finest elements to the owners of their ancestors, grouped by
+  // owner.
+  const int ne = static_cast<int>(new_ancestor.size());
+  std::vector<int> owner(ne), perm(ne);
+  for (int i = 0; i < ne; i++)
+  {
+    owner[i] = static_cast<int>(std::upper_bound(coarse_offsets.begin(),
+                                                 coarse_offsets.end(), new_ancestor[i]) -
+                                coarse_offsets.begin()) -
+               1;
+  }
+  std::iota(perm.begin(), perm.end(), 0);
+  std::stable_sort(perm.begin(), perm.end(),
+                   [&owner](int a, int b) { return owner[a] < owner[b]; });
+  std::vector<int> send_counts(size, 0), send_displs(size + 1, 0);
+  std::vector<long long int> send_keys(2 * ne);
+  for (int k = 0; k < ne; k++)
+  {
+    send_counts[owner[perm[k]]] += 2;
+    send_keys[2 * k] = new_ancestor[perm[k]];
+    send_keys[2 * k + 1] = new_path[perm[k]];
+  }
+  std::partial_sum(send_counts.begin(), send_counts.end(), send_displs.begin() + 1);
+  std::vector<int> recv_counts(size), recv_displs(size + 1, 0);
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, comm);
+  std::partial_sum(recv_counts.begin(), recv_counts.end(), recv_displs.begin() + 1);
+  std::vector<long long int> recv_keys(recv_displs.back());
+  MPI_Alltoallv(send_keys.data(), send_counts.data(), send_displs.data(),
+                mpi::DataType<long long int>(), recv_keys.data(), recv_counts.data(),
+                recv_displs.data(), mpi::DataType<long long int>(), comm);
+
+  // Look up the requested keys among the local original finest elements and respond with
+  // their global indices.
+  std::vector<int> local(ancestor.size());
+  std::iota(local.begin(), local.end(), 0);
+  auto KeyLess = [&](int a, int b)
+  { return std::tie(ancestor[a], path[a]) < std::tie(ancestor[b], path[b]); };
+  std::sort(local.begin(), local.end(), KeyLess);
+  std::vector<int> send_idx(recv_keys.size() / 2);
+  for (std::size_t k = 0; k < send_idx.size(); k++)
+  {
+    const int anc = static_cast<int>(recv_keys[2 * k]);
+    const long long int key = recv_keys[2 * k + 1];
+    const auto it = std::lower_bound(
+        local.begin(), local.end(), std::make_pair(anc, key), [&](int a, const auto &b)
+        { return std::tie(ancestor[a], path[a]) < std::tie(b.first, b.second); });
+    MFEM_VERIFY(it != local.end() && ancestor[*it] == anc && path[*it] == key,
+                "Failed to match refined mesh elements during mesh redistribution!");
+    send_idx[k] = fine_offsets[rank] + *it;
+  }
+  for (int p = 0; p < size; p++)
+  {
+    send_counts[p] /= 2;
+    send_displs[p + 1] /= 2;
+    recv_counts[p] /= 2;
+    recv_displs[p + 1] /= 2;
+  }
+  std::vector<int> recv_idx(ne);
+  MPI_Alltoallv(send_idx.data(), recv_counts.data(), recv_displs.data(), MPI_INT,
+                recv_idx.data(), send_counts.data(), send_displs.data(), MPI_INT, comm);
+  std::vector<int> elem_map(ne);
+  for (int k = 0; k < ne; k++)
+  {
+    elem_map[perm[k]] = recv_idx[k];
+  }
+  return elem_map;
+}
+
 }  // namespace
 
 }  // namespace palace
@@ -238,6 +238,26 @@ inline double GetVolume(const mfem::ParMesh &mesh, int attr)
 // the intermediate stages to disk. Returns the imbalance ratio before rebalancing.
 double RebalanceMesh(std::unique_ptr<mfem::ParMesh> &mesh, const IoData &iodata);
 
+// Create a copy of a conforming parallel mesh which is distributed over the processes of
+// the communicator comm, usually one of a set of disjoint subcommunicators of the original
+// mesh communicator. The element ordering and element vertex ordering are preserved. On
+// return, elem_map contains for each local element of the new mesh the index of the same
+// element in the global ordering of the original mesh (elements ordered by rank).
+std::unique_ptr<mfem::ParMesh> RedistributeMesh(const mfem::ParMesh &mesh, MPI_Comm comm,
+                                                std::vector<int> &elem_map);
+
+// Create a copy of a hierarchy of conforming parallel meshes, where each mesh is a uniform
+// refinement of the previous one, distributed over the processes of the communicator comm.
+// Only the coarsest mesh is gathered and redistributed, and the uniform refinements are
+// repeated on the new communicator so that the new meshes are nested and can be used for
+// geometric multigrid. On return, elem_map contains for each local element of the new
+// finest mesh the index of the same element in the global ordering of the original finest
+// mesh (not necessarily increasing). If the hierarchy is not obtained by uniform
+// refinement, only the finest mesh is redistributed.
+std::vector<std::unique_ptr<mfem::ParMesh>>
+RedistributeMesh(const std::vector<const mfem::ParMesh *> &mesh, MPI_Comm comm,
+                 std::vector<int> &elem_map);
+
 }  // namespace mesh
 
 }  // namespace palace
@@ -425,6 +425,12 @@ void IoData::CheckConfiguration()
          problem.type == config::ProblemData::Type::MAGNETOSTATIC ||
          problem.type == config::ProblemData::Type::TRANSIENT);
   }
+  if (solver.driven.estimator_step < 0)
+  {
+    // Error estimation for driven simulations is only required for adaptive mesh
+    // refinement.
+    solver.driven.estimator_step = (model.refinement.max_it > 0);
+  }
 
   // Configure settings for quadrature rules and partial assembly.
   BilinearForm::pa_order_threshold = solver.pa_order_threshold;
@@ -545,6 +551,8 @@ void IoData::NondimensionalizeInputs(mfem::ParMesh &mesh)
 
   // For eigenmode simulations:
   solver.eigenmode.target *= 2.0 * M_PI * tc;
+  solver.eigenmode.slice_target_upper *= 2.0 * M_PI * tc;
+  solver.eigenmode.contour_target_upper *= 2.0 * M_PI * tc;
 
   // For driven simulations:
   solver.driven.min_f *= 2.0 * M_PI * tc;
@@ -63,6 +63,9 @@ class Palace(CMakePackage, CudaPackage, ROCmPackage):
     depends_on("hypre~openmp", when="~openmp")
 
     with when("+superlu-dist"):
+        # The single precision interface (psgssvx) is used directly by Palace for the
+        # "SuperLU-MP" mixed precision solver, which is always built with SuperLU_DIST
+        depends_on("superlu-dist@8:")
         depends_on("superlu-dist+shared", when="+shared")
         depends_on("superlu-dist~shared", when="~shared")
         depends_on("superlu-dist+int64", when="+int64")
@@ -85,7 +88,7 @@ class Palace(CMakePackage, CudaPackage, ROCmPackage):
         depends_on("sundials~openmp", when="~openmp")
 
     with when("+mumps"):
-        depends_on("mumps+metis+parmetis")
+        depends_on("mumps@5.3:+metis+parmetis+float")
         depends_on("mumps+shared", when="+shared")
         depends_on("mumps~shared", when="~shared")
         depends_on("mumps+openmp", when="+openmp")
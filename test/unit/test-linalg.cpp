@@ -0,0 +1,436 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <vector>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include "fem/bilinearform.hpp"
+#include "fem/fespace.hpp"
+#include "fem/integrator.hpp"
+#include "fem/mesh.hpp"
+#include "linalg/gaussseidel.hpp"
+#include "linalg/gmrespoly.hpp"
+#include "linalg/iterative.hpp"
+#include "linalg/jacobi.hpp"
+#include "linalg/krylovschur.hpp"
+#include "linalg/ksp.hpp"
+#include "linalg/operator.hpp"
+#include "linalg/rap.hpp"
+#include "linalg/ras.hpp"
+#include "linalg/solutionhistory.hpp"
+#include "linalg/solver.hpp"
+#include "linalg/vector.hpp"
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+using namespace std::complex_literals;
+
+namespace
+{
+
+// Process-local 1D Laplacian with a diagonal shift, tridiag(-1, 2 + s, -1), which is
+// symmetric positive definite for s > 0.
+class ShiftedLaplacianOperator : public Operator
+{
+private:
+  const double s;
+
+public:
+  ShiftedLaplacianOperator(int n, double s) : Operator(n), s(s) {}
+
+  void Mult(const Vector &x, Vector &y) const override
+  {
+    const int n = x.Size();
+    const double *X = x.HostRead();
+    double *Y = y.HostWrite();
+    for (int i = 0; i < n; i++)
+    {
+      Y[i] = (2.0 + s) * X[i];
+      if (i > 0)
+      {
+        Y[i] -= X[i - 1];
+      }
+      if (i < n - 1)
+      {
+        Y[i] -= X[i + 1];
+      }
+    }
+  }
+
+  void AssembleDiagonal(Vector &diag) const override { diag = 2.0 + s; }
+};
+
+// Parallel assembled operator for -Δ + I discretized with the given H1 space, which is
+// symmetric positive definite.
+std::unique_ptr<ParOperator> AssembleShiftedLaplacian(const FiniteElementSpace &fespace)
+{
+  BilinearForm a(fespace);
+  a.AddDomainIntegrator<DiffusionIntegrator>();
+  a.AddDomainIntegrator<MassIntegrator>();
+  return std::make_unique<ParOperator>(a.FullAssemble(false), fespace);
+}
+
+// Diagonal entries f(1), f(2), ..., f(P n) distributed cyclically over the P processes, for
+// diagonal eigenvalue problems with known eigenvalues.
+template <typename T>
+ComplexVector CyclicDiagonal(MPI_Comm comm, int n, T &&f)
+{
+  const int rank = Mpi::Rank(comm), size = Mpi::Size(comm);
+  ComplexVector d(n);
+  d = 0.0;
+  for (int i = 0; i < n; i++)
+  {
+    const std::complex<double> di = f(1.0 + rank + size * i);
+    d.Real()(i) = di.real();
+    d.Imag()(i) = di.imag();
+  }
+  return d;
+}
+
+auto Residual(MPI_Comm comm, const Operator &A, const Vector &b, const Vector &x)
+{
+  Vector r(b.Size());
+  A.Mult(x, r);
+  linalg::AXPBY(1.0, b, -1.0, r);
+  return linalg::Norml2(comm, r) / linalg::Norml2(comm, b);
+}
+
+}  // namespace
+
+TEST_CASE("Block CG", "[iterative][Serial][Parallel]")
+{
+  // Each right-hand side of the lockstep block solve follows the same iterates as a
+  // separate solve, and the iteration statistics count each right-hand side separately.
+  MPI_Comm comm = Mpi::World();
+  constexpr int n = 64, nrhs = 4;
+  constexpr double tol = 1.0e-10;
+  ShiftedLaplacianOperator A(n, 1.0e-2);
+  CgSolver<Operator> cg(comm, 0);
+  cg.SetOperator(A);
+  cg.SetRelTol(tol);
+  cg.SetMaxIter(1000);
+
+  std::vector<Vector> b(nrhs), x(nrhs);
+  for (int i = 0; i < nrhs; i++)
+  {
+    b[i].SetSize(n);
+    x[i].SetSize(n);
+    linalg::SetRandom(comm, b[i], i + 1);
+  }
+  cg.ArrayMult(b, x);
+  REQUIRE(cg.GetConverged());
+  const int block_it = cg.GetNumIterations(), block_total_it = cg.GetNumTotalIterations();
+
+  int max_it = 0, total_it = 0;
+  for (int i = 0; i < nrhs; i++)
+  {
+    Vector y(n);
+    cg.Mult(b[i], y);
+    REQUIRE(cg.GetConverged());
+    max_it = std::max(max_it, cg.GetNumIterations());
+    total_it += cg.GetNumIterations();
+    CHECK(Residual(comm, A, b[i], x[i]) < 10.0 * tol);
+    linalg::AXPY(-1.0, x[i], y);
+    CHECK(linalg::Norml2(comm, y) <= 1.0e-8 * linalg::Norml2(comm, x[i]));
+  }
+  CHECK(block_it == max_it);
+  CHECK(block_total_it == total_it);
+}
+
+TEST_CASE("Gauss-Seidel Smoother", "[gaussseidel][Serial][Parallel]")
+{
+  // The symmetric Gauss-Seidel smoother for an assembled operator is a symmetric positive
+  // definite preconditioner which accelerates CG.
+  MPI_Comm comm = Mpi::World();
+  auto smesh = mfem::Mesh::MakeCartesian2D(16, 16, mfem::Element::QUADRILATERAL);
+  REQUIRE(Mpi::Size(comm) <= smesh.GetNE());
+  Mesh mesh(comm, smesh);
+  mfem::H1_FECollection h1_fec(1, mesh.Dimension());
+  FiniteElementSpace fespace(mesh, &h1_fec);
+  auto A = AssembleShiftedLaplacian(fespace);
+  const int n = A->Height();
+  GaussSeidelSmoother<Operator> gs(comm, 1,
+                                   std::make_unique<JacobiSmoother<Operator>>(comm));
+  gs.SetInitialGuess(false);
+  gs.SetOperator(*A);
+
+  Vector x(n), z(n), Bx(n), Bz(n);
+  linalg::SetRandom(comm, x, 1);
+  linalg::SetRandom(comm, z, 2);
+  gs.Mult(x, Bx);
+  gs.Mult(z, Bz);
+  const double xBz = linalg::Dot(comm, x, Bz), zBx = linalg::Dot(comm, z, Bx);
+  CHECK(std::abs(xBz - zBx) <= 1.0e-12 * std::abs(xBz));
+  CHECK(linalg::Dot(comm, x, Bx) > 0.0);
+
+  constexpr double tol = 1.0e-8;
+  CgSolver<Operator> cg(comm, 0);
+  cg.SetOperator(*A);
+  cg.SetRelTol(tol);
+  cg.SetMaxIter(1000);
+  Vector b(n), y(n);
+  linalg::SetRandom(comm, b, 3);
+  cg.Mult(b, y);
+  REQUIRE(cg.GetConverged());
+  const int it = cg.GetNumIterations();
+  cg.SetPreconditioner(gs);
+  cg.Mult(b, y);
+  REQUIRE(cg.GetConverged());
+  CHECK(cg.GetNumIterations() < it);
+  CHECK(Residual(comm, *A, b, y) < 10.0 * tol);
+
+  // For operators which are not assembled, application is delegated to the fallback
+  // smoother.
+  ShiftedLaplacianOperator L(n, 1.0e-2);
+  JacobiSmoother<Operator> jacobi(comm);
+  jacobi.SetOperator(L);
+  gs.SetOperator(L);
+  gs.Mult(x, Bx);
+  jacobi.Mult(x, Bz);
+  linalg::AXPY(-1.0, Bx, Bz);
+  CHECK(linalg::Norml2(comm, Bz) <= 1.0e-12 * linalg::Norml2(comm, Bx));
+}
+
+TEST_CASE("GMRES Polynomial Smoother", "[gmrespoly][Serial][Parallel]")
+{
+  MPI_Comm comm = Mpi::World();
+  SECTION("Invariant Subspace")
+  {
+    // The diagonally-scaled operator has only n distinct eigenvalues, so the Arnoldi
+    // process finds an invariant subspace and the smoother is an exact solver.
+    constexpr int n = 6;
+    ShiftedLaplacianOperator A(n, 1.0e-2);
+    GmresPolynomialSmoother<Operator> pc(comm, 1, 10);
+    pc.SetOperator(A);
+    Vector b(n), x(n);
+    linalg::SetRandom(comm, b, 1);
+    pc.Mult(b, x);
+    CHECK(Residual(comm, A, b, x) < 1.0e-8);
+  }
+  SECTION("Preconditioner")
+  {
+    // As a preconditioner, the polynomial reduces the number of GMRES iterations.
+    constexpr int n = 200;
+    constexpr double tol = 1.0e-8;
+    ShiftedLaplacianOperator A(n, 1.0e-2);
+    GmresPolynomialSmoother<Operator> pc(comm, 1, 8);
+    pc.SetOperator(A);
+    GmresSolver<Operator> gmres(comm, 0);
+    gmres.SetOperator(A);
+    gmres.SetRelTol(tol);
+    gmres.SetMaxIter(1000);
+    gmres.SetRestartDim(n);
+    gmres.SetPrecSide(GmresSolverBase::PrecSide::RIGHT);
+    Vector b(n), x(n);
+    linalg::SetRandom(comm, b, 2);
+    gmres.Mult(b, x);
+    REQUIRE(gmres.GetConverged());
+    const int it = gmres.GetNumIterations();
+    gmres.SetPreconditioner(pc);
+    gmres.Mult(b, x);
+    REQUIRE(gmres.GetConverged());
+    CHECK(gmres.GetNumIterations() < it);
+    CHECK(Residual(comm, A, b, x) < 10.0 * tol);
+  }
+}
+
+TEST_CASE("RAS Preconditioner", "[ras][Serial][Parallel]")
+{
+  // RAS accelerates GMRES for any overlap and interface shift, and is an exact solver on a
+  // single process where the subdomain is the whole domain. The subdomain problems are
+  // solved with a tight tolerance iterative solver in place of a sparse direct solver.
+  const int overlap = GENERATE(0, 1, 2);
+  const double shift_coeff = GENERATE(0.0, 0.5);
+  MPI_Comm comm = Mpi::World();
+  auto smesh = mfem::Mesh::MakeCartesian2D(16, 16, mfem::Element::QUADRILATERAL);
+  REQUIRE(Mpi::Size(comm) <= smesh.GetNE());
+  Mesh mesh(comm, smesh);
+  mfem::H1_FECollection h1_fec(1, mesh.Dimension());
+  FiniteElementSpace fespace(mesh, &h1_fec);
+  auto A = AssembleShiftedLaplacian(fespace);
+  const int n = A->Height();
+  auto local_solver = std::make_unique<mfem::CGSolver>(MPI_COMM_SELF);
+  local_solver->SetRelTol(1.0e-12);
+  local_solver->SetMaxIter(1000);
+  MfemWrapperSolver<Operator> pc(
+      std::make_unique<RasSolver>(comm, overlap, shift_coeff, std::move(local_solver), 0));
+  pc.SetOperator(*A);
+
+  constexpr double tol = 1.0e-8;
+  GmresSolver<Operator> gmres(comm, 0);
+  gmres.SetOperator(*A);
+  gmres.SetRelTol(tol);
+  gmres.SetMaxIter(1000);
+  gmres.SetRestartDim(1000);
+  gmres.SetPrecSide(GmresSolverBase::PrecSide::RIGHT);
+  Vector b(n), x(n);
+  linalg::SetRandom(comm, b, 1);
+  gmres.Mult(b, x);
+  REQUIRE(gmres.GetConverged());
+  const int it = gmres.GetNumIterations();
+  gmres.SetPreconditioner(pc);
+  gmres.Mult(b, x);
+  REQUIRE(gmres.GetConverged());
+  CHECK(gmres.GetNumIterations() < it);
+  CHECK(Residual(comm, *A, b, x) < 10.0 * tol);
+  if (Mpi::Size(comm) == 1)
+  {
+    CHECK(gmres.GetNumIterations() <= 2);
+  }
+}
+
+TEST_CASE("Block Krylov-Schur Eigenvalue Solver", "[krylovschur][Serial][Parallel]")
+{
+  // Diagonal linear and quadratic eigenvalue problems with known eigenvalues, where the
+  // eigenvalues nearest to the shift are computed using shift-and-invert.
+  const int block_size = GENERATE(1, 2);
+  MPI_Comm comm = Mpi::World();
+  constexpr int n = 50;
+  constexpr double tol = 1.0e-8;
+  BlockKrylovSchurSolver eigen(comm, 0);
+  eigen.SetBlockSize(block_size);
+  eigen.SetTol(tol);
+  eigen.SetWhichEigenpairs(EigenvalueSolver::WhichType::LARGEST_MAGNITUDE);
+  auto CheckEigenpairs = [&eigen](const std::vector<std::complex<double>> &lambda_ref)
+  {
+    const int nev = static_cast<int>(lambda_ref.size());
+    REQUIRE(eigen.Solve() >= nev);
+    std::vector<std::complex<double>> lambda(nev);
+    for (int i = 0; i < nev; i++)
+    {
+      lambda[i] = eigen.GetEigenvalue(i);
+      CHECK(eigen.GetError(i, EigenvalueSolver::ErrorType::BACKWARD) < 1.0e-6);
+    }
+    for (const auto &l : lambda_ref)
+    {
+      CHECK(std::any_of(lambda.begin(), lambda.end(),
+                        [&l](auto z) { return std::abs(z - l) <= 1.0e-6 * std::abs(l); }));
+    }
+  };
+
+  SECTION("Linear")
+  {
+    // K x = λ x with K = diag(1, 2, ..., P n).
+    const std::complex<double> sigma = 0.5;
+    auto dk = CyclicDiagonal(comm, n, [](double d) { return d; });
+    auto dm = CyclicDiagonal(comm, n, [](double) { return 1.0; });
+    auto da = CyclicDiagonal(comm, n, [&sigma](double d) { return d - sigma; });
+    ComplexDiagonalOperator K(dk), M(dm), A(da);
+    auto cg = std::make_unique<CgSolver<ComplexOperator>>(comm, 0);
+    cg->SetRelTol(1.0e-12);
+    cg->SetMaxIter(1000);
+    ComplexKspSolver ksp(std::move(cg), nullptr);
+    ksp.SetOperators(A, A);
+    eigen.SetOperators(K, M, EigenvalueSolver::ScaleType::NONE);
+    eigen.SetLinearSolver(ksp);
+    eigen.SetNumModes(4);
+    eigen.SetShiftInvert(sigma);
+    CheckEigenpairs({1.0, 2.0, 3.0, 4.0});
+  }
+  SECTION("Quadratic")
+  {
+    // (K + λ C + λ² M) x = 0 with K = diag(1, 4, ..., (P n)²), C = c I, and M = I, with
+    // eigenvalues λ = -c/2 ± i √(d² - c²/4).
+    constexpr double c = 0.2;
+    const std::complex<double> sigma(0.0, 0.6);
+    auto dk = CyclicDiagonal(comm, n, [](double d) { return d * d; });
+    auto dc = CyclicDiagonal(comm, n, [](double) { return c; });
+    auto dm = CyclicDiagonal(comm, n, [](double) { return 1.0; });
+    auto da = CyclicDiagonal(comm, n, [&sigma](double d)
+                             { return d * d + sigma * c + sigma * sigma; });
+    ComplexDiagonalOperator K(dk), C(dc), M(dm), A(da);
+    auto gmres = std::make_unique<GmresSolver<ComplexOperator>>(comm, 0);
+    gmres->SetRelTol(1.0e-12);
+    gmres->SetMaxIter(1000);
+    gmres->SetRestartDim(1000);
+    ComplexKspSolver ksp(std::move(gmres), nullptr);
+    ksp.SetOperators(A, A);
+    eigen.SetOperators(K, C, M, EigenvalueSolver::ScaleType::NONE);
+    eigen.SetLinearSolver(ksp);
+    eigen.SetNumModes(2);
+    eigen.SetShiftInvert(sigma);
+    auto Lambda = [](double d)
+    { return std::complex<double>(-0.5 * c, std::sqrt(d * d - 0.25 * c * c)); };
+    CheckEigenpairs({Lambda(1.0), Lambda(2.0)});
+  }
+}
+
+TEST_CASE("Solution History Initial Guess", "[solutionhistory][Serial][Parallel]")
+{
+  // The initial guess minimizes the residual for A(ω) = K + iω C - ω² M + A2 over the span
+  // of the stored solutions, combining the products with K, C, and M cached when each
+  // solution is added. Stored solutions which are linearly dependent on the previous ones
+  // are skipped.
+  const bool use_C = GENERATE(false, true);
+  const bool use_A2 = GENERATE(false, true);
+  MPI_Comm comm = Mpi::World();
+  constexpr int n = 20, m = 4;
+  constexpr double omega = 1.3;
+  auto dk = CyclicDiagonal(comm, n, [](double d) { return 2.0 + d; });
+  auto dc = CyclicDiagonal(comm, n, [](double d) { return 0.1 * d; });
+  auto dm = CyclicDiagonal(comm, n, [](double d) { return 1.0 / d; });
+  auto da2 = CyclicDiagonal(comm, n, [](double d) { return 1i * std::sin(d); });
+  ComplexDiagonalOperator K(dk), C(dc), M(dm), A2(da2);
+  auto ApplyA = [&](const ComplexVector &x, ComplexVector &y)
+  {
+    K.Mult(x, y);
+    if (use_C)
+    {
+      C.AddMult(x, y, 1i * omega);
+    }
+    M.AddMult(x, y, -omega * omega);
+    if (use_A2)
+    {
+      A2.AddMult(x, y);
+    }
+  };
+
+  SolutionHistory history(comm, m, K, use_C ? &C : nullptr, M);
+  std::vector<ComplexVector> X(m);
+  for (int j = 0; j < m; j++)
+  {
+    X[j].SetSize(n);
+    X[j].UseDevice(true);
+    if (j < m - 1)
+    {
+      linalg::SetRandom(comm, X[j], j + 1);
+    }
+    else
+    {
+      X[j] = X[0];
+      X[j].Add(1i, X[1]);
+    }
+    history.AddSolution(X[j]);
+  }
+
+  // A right-hand side in the range of A X is solved exactly.
+  ComplexVector x(n), x0(n), b(n), r(n), y(n);
+  x = X[0];
+  x.Add(-2.0, X[2]);
+  ApplyA(x, b);
+  history.GetInitialGuess(omega, use_A2 ? &A2 : nullptr, b, x0);
+  x0.Add(-1.0, x);
+  CHECK(linalg::Norml2(comm, x0) <= 1.0e-8 * linalg::Norml2(comm, x));
+
+  // Otherwise, the residual is orthogonal to the range of A X.
+  linalg::SetRandom(comm, b, m + 1);
+  history.GetInitialGuess(omega, use_A2 ? &A2 : nullptr, b, x0);
+  ApplyA(x0, r);
+  r.Add(-1.0, b);
+  const double norm_b = linalg::Norml2(comm, b);
+  CHECK(linalg::Norml2(comm, r) < norm_b);
+  for (int j = 0; j < m; j++)
+  {
+    ApplyA(X[j], y);
+    CHECK(std::abs(linalg::Dot(comm, r, y)) <= 1.0e-10 * linalg::Norml2(comm, y) * norm_b);
+  }
+}
+
+}  // namespace palace
@@ -0,0 +1,185 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+#include <Eigen/Dense>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include "linalg/iterative.hpp"
+#include "linalg/vector.hpp"
+#include "models/romoperator.hpp"
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+using namespace std::complex_literals;
+
+TEST_CASE("PROM Residual QR Decomposition", "[romoperator][Serial][Parallel]")
+{
+  // The columns of W are added to the QR decomposition W = Q R one at a time, where columns
+  // in the span of the previous ones do not add a column to Q. The residual norm ||W θ|| is
+  // then given by ||R θ|| for any θ.
+  const auto type =
+      GENERATE(GmresSolverBase::OrthogType::MGS, GmresSolverBase::OrthogType::CGS,
+               GmresSolverBase::OrthogType::CGS2);
+  MPI_Comm comm = Mpi::World();
+  constexpr int n = 20, m = 6;
+  std::vector<ComplexVector> W(m), Q(m);
+  for (int k = 0; k < m; k++)
+  {
+    W[k].SetSize(n);
+    W[k].UseDevice(true);
+    Q[k].SetSize(n);
+    Q[k].UseDevice(true);
+  }
+  linalg::SetRandom(comm, W[0], 1);
+  linalg::SetRandom(comm, W[1], 2);
+  linalg::SetRandom(comm, W[2], 3);
+  W[3] = W[0];
+  W[3].Add(2.0i, W[1]);
+  linalg::SetRandom(comm, W[4], 4);
+  W[5] = W[2];
+  W[5].Add(-0.5, W[4]);
+
+  Eigen::MatrixXcd R = Eigen::MatrixXcd::Zero(m, m);
+  std::size_t dim_Q = 0;
+  for (int k = 0; k < m; k++)
+  {
+    Q[dim_Q] = W[k];
+    RomOperator::OrthonormalizeColumn(type, comm, Q, dim_Q, R.col(k).data());
+  }
+  REQUIRE(dim_Q == 4);
+  for (std::size_t i = 0; i < dim_Q; i++)
+  {
+    for (std::size_t j = 0; j < dim_Q; j++)
+    {
+      const std::complex<double> dot = linalg::Dot(comm, Q[i], Q[j]);
+      CHECK(std::abs(dot - ((i == j) ? 1.0 : 0.0)) < 1.0e-12);
+    }
+  }
+
+  ComplexVector r(n);
+  r.UseDevice(true);
+  for (int k = 0; k < m; k++)
+  {
+    r = W[k];
+    for (std::size_t i = 0; i < dim_Q; i++)
+    {
+      r.Add(-R(i, k), Q[i]);
+    }
+    CHECK(linalg::Norml2(comm, r) <= 1.0e-12 * linalg::Norml2(comm, W[k]));
+  }
+  Eigen::VectorXcd theta(m);
+  r = 0.0;
+  for (int k = 0; k < m; k++)
+  {
+    theta(k) = std::complex<double>(k + 1.0, m - k);
+    r.Add(theta(k), W[k]);
+  }
+  const double res = linalg::Norml2(comm, r);
+  CHECK(std::abs((R * theta).norm() - res) <= 1.0e-12 * res);
+}
+
+TEST_CASE("PROM Interpolation Weights", "[romoperator][Serial]")
+{
+  // The interpolant through the four sample points nearest to x reproduces cubic
+  // polynomials, including when extrapolating, and selects the sample value at a sample
+  // point.
+  const std::vector<double> xk = {0.0, 1.0, 3.0, 3.5, 6.0, 10.0};
+  auto f = [](double x) { return 2.0 - x + 0.5 * x * x - 0.1 * x * x * x; };
+  for (double x : {-1.0, 2.0, 3.2, 7.5, 12.0})
+  {
+    const auto w = RomOperator::InterpolationWeights(xk, x);
+    REQUIRE(w.size() == xk.size());
+    CHECK(std::count_if(w.begin(), w.end(), [](double wk) { return wk != 0.0; }) == 4);
+    double fx = 0.0;
+    for (std::size_t k = 0; k < xk.size(); k++)
+    {
+      fx += w[k] * f(xk[k]);
+    }
+    CHECK(std::abs(fx - f(x)) <= 1.0e-12 * std::max(1.0, std::abs(f(x))));
+  }
+  const auto w = RomOperator::InterpolationWeights(xk, xk[3]);
+  for (std::size_t k = 0; k < xk.size(); k++)
+  {
+    CHECK(std::abs(w[k] - ((k == 3) ? 1.0 : 0.0)) < 1.0e-14);
+  }
+
+  // With fewer than four sample points, the interpolant has correspondingly lower degree.
+  const auto w2 = RomOperator::InterpolationWeights({1.0, 2.0}, 4.0);
+  REQUIRE(w2.size() == 2);
+  CHECK(std::abs(w2[0] * 2.0 + w2[1] * 5.0 - 11.0) < 1.0e-12);
+  const auto w1 = RomOperator::InterpolationWeights({1.0}, 4.0);
+  REQUIRE(w1.size() == 1);
+  CHECK(w1[0] == 1.0);
+
+  // The guarded weights reject points which are not bracketed by the sample points used,
+  // and the error estimate vanishes for polynomials reproduced by the lower-degree
+  // interpolant.
+  std::vector<double> wg, dw;
+  CHECK(!RomOperator::GetInterpolationWeights(xk, -1.0, wg, dw));
+  CHECK(!RomOperator::GetInterpolationWeights(xk, 12.0, wg, dw));
+  CHECK(!RomOperator::GetInterpolationWeights({0.0, 5.0, 5.1, 5.2, 5.3}, 4.9, wg, dw));
+  REQUIRE(RomOperator::GetInterpolationWeights(xk, 3.2, wg, dw));
+  auto g = [](double x) { return 1.0 + 2.0 * x - 0.3 * x * x; };
+  double gx = 0.0, dgx = 0.0, dfx = 0.0;
+  for (std::size_t k = 0; k < xk.size(); k++)
+  {
+    gx += wg[k] * g(xk[k]);
+    dgx += dw[k] * g(xk[k]);
+    dfx += dw[k] * f(xk[k]);
+  }
+  CHECK(std::abs(gx - g(3.2)) <= 1.0e-12 * std::abs(g(3.2)));
+  CHECK(std::abs(dgx) <= 1.0e-12 * std::abs(g(3.2)));
+  CHECK(std::abs(dfx) > 1.0e-3);
+  REQUIRE(RomOperator::GetInterpolationWeights({1.0}, 1.0, wg, dw));
+  CHECK(wg[0] == 1.0);
+  CHECK(dw[0] == 0.0);
+}
+
+TEST_CASE("PROM Affine Coefficients", "[romoperator][Serial]")
+{
+  // Coefficient vectors in the span of the snapshots are fit exactly, while those with a
+  // component outside of the span larger than the tolerance are rejected.
+  constexpr int n = 8, m = 3;
+  constexpr double tol = 1.0e-6;
+  Eigen::MatrixXd C(n, m);
+  for (int i = 0; i < n; i++)
+  {
+    for (int k = 0; k < m; k++)
+    {
+      C(i, k) = std::cos((i + 1.0) * (k + 1.0));
+    }
+  }
+  const Eigen::MatrixXd G = C.transpose() * C;
+  const Eigen::VectorXd a = Eigen::Vector3d(1.0, -2.0, 0.5);
+  const Eigen::VectorXd c = C * a;
+  Eigen::VectorXd theta;
+  REQUIRE(RomOperator::GetAffineCoefficients(G, C.transpose() * c, c.squaredNorm(), tol,
+                                             theta));
+  CHECK((theta - a).norm() <= 1.0e-10 * a.norm());
+
+  // Unit vector orthogonal to the span of the snapshots.
+  Eigen::VectorXd u = Eigen::VectorXd::Unit(n, 0);
+  u -= C * G.ldlt().solve(C.transpose() * u);
+  u.normalize();
+  for (double s : {1.0e-8, 1.0e-3})
+  {
+    const Eigen::VectorXd d = c + s * c.norm() * u;
+    CHECK(RomOperator::GetAffineCoefficients(G, C.transpose() * d, d.squaredNorm(), tol,
+                                             theta) == (s < tol));
+  }
+
+  // Without any snapshots, only the zero vector is in the span.
+  const Eigen::MatrixXd G0(0, 0);
+  const Eigen::VectorXd b0(0);
+  CHECK(RomOperator::GetAffineCoefficients(G0, b0, 0.0, tol, theta));
+  CHECK(!RomOperator::GetAffineCoefficients(G0, b0, 1.0, tol, theta));
+}
+
+}  // namespace palace
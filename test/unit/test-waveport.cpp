@@ -0,0 +1,139 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cmath>
+#include <vector>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include "models/waveportoperator.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+// Rotation by the angle t about the unit axis a (Rodrigues' formula).
+mfem::DenseMatrix Rotation(const double a[3], double t)
+{
+  mfem::DenseMatrix R(3);
+  const double c = std::cos(t), s = std::sin(t);
+  for (int i = 0; i < 3; i++)
+  {
+    for (int j = 0; j < 3; j++)
+    {
+      R(i, j) = (1.0 - c) * a[i] * a[j] + ((i == j) ? c : 0.0);
+    }
+  }
+  R(0, 1) -= s * a[2];
+  R(0, 2) += s * a[1];
+  R(1, 0) += s * a[2];
+  R(1, 2) -= s * a[0];
+  R(2, 0) -= s * a[1];
+  R(2, 1) += s * a[0];
+  return R;
+}
+
+double Distance(const mfem::DenseMatrix &A, const mfem::DenseMatrix &B)
+{
+  mfem::DenseMatrix D(A);
+  D -= B;
+  return D.MaxMaxNorm();
+}
+
+}  // namespace
+
+TEST_CASE("Congruent Wave Port Rotations", "[waveport][Serial]")
+{
+  // Principal axes of a port (normal last) and of a congruent port, related by a rigid
+  // motion Q which is a rotation or a reflection. The principal axes are only defined up to
+  // sign, so the axes of the second port are flipped arbitrarily.
+  const bool reflect = GENERATE(false, true);
+  const int flip = GENERATE(0, 1, 2, 3, 4, 5, 6, 7);
+  const double a[3] = {1.0 / std::sqrt(3.0), -1.0 / std::sqrt(3.0), 1.0 / std::sqrt(3.0)};
+  const double b[3] = {0.0, 0.6, 0.8};
+  const mfem::DenseMatrix U = Rotation(a, 0.7);
+  mfem::DenseMatrix Q = Rotation(b, 2.1);
+  if (reflect)
+  {
+    // Reflection through the plane spanned by the major axis and the normal.
+    mfem::DenseMatrix P(3), QP(3);
+    P = 0.0;
+    for (int i = 0; i < 3; i++)
+    {
+      P(i, i) = 1.0;
+      for (int j = 0; j < 3; j++)
+      {
+        P(i, j) -= 2.0 * U(i, 1) * U(j, 1);
+      }
+    }
+    mfem::Mult(Q, P, QP);
+    Q = QP;
+  }
+  mfem::DenseMatrix V(3);
+  mfem::Mult(Q, U, V);
+  for (int k = 0; k < 3; k++)
+  {
+    if (flip & (1 << k))
+    {
+      for (int i = 0; i < 3; i++)
+      {
+        V(i, k) *= -1.0;
+      }
+    }
+  }
+
+  // All candidates are proper rotations mapping the normal of the first port to the normal
+  // of the second port up to sign.
+  const auto rotations = WavePortData::GetCongruentRotations(U, V);
+  REQUIRE(rotations.size() == 4);
+  for (const auto &R : rotations)
+  {
+    CHECK(std::abs(R.Det() - 1.0) < 1.0e-12);
+    mfem::DenseMatrix RtR(3), I(3);
+    mfem::MultAtB(R, R, RtR);
+    I = 0.0;
+    for (int i = 0; i < 3; i++)
+    {
+      I(i, i) = 1.0;
+    }
+    CHECK(Distance(RtR, I) < 1.0e-12);
+    double n[3] = {0.0};
+    for (int i = 0; i < 3; i++)
+    {
+      for (int j = 0; j < 3; j++)
+      {
+        n[i] += R(i, j) * U(j, 2);
+      }
+    }
+    CHECK(std::abs(std::abs(n[0] * V(0, 2) + n[1] * V(1, 2) + n[2] * V(2, 2)) - 1.0) <
+          1.0e-12);
+  }
+
+  // One of the candidates agrees with the rigid motion on the port plane: Q itself if it is
+  // a rotation, otherwise Q composed with the reflection through the port plane.
+  mfem::DenseMatrix Q_proper(Q);
+  if (reflect)
+  {
+    mfem::DenseMatrix N(3);
+    N = 0.0;
+    for (int i = 0; i < 3; i++)
+    {
+      N(i, i) = 1.0;
+      for (int j = 0; j < 3; j++)
+      {
+        N(i, j) -= 2.0 * U(i, 2) * U(j, 2);
+      }
+    }
+    mfem::Mult(Q, N, Q_proper);
+  }
+  int found = 0;
+  for (const auto &R : rotations)
+  {
+    found += (Distance(R, Q_proper) < 1.0e-12);
+  }
+  CHECK(found == 1);
+}
+
+}  // namespace palace